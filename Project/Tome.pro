@@ -18,6 +18,9 @@ VERSION_NAME = Griffin
 DEFINES += APP_VERSION=\\\"$$VERSION\\\"
 DEFINES += APP_VERSION_NAME=\\\"$$VERSION_NAME\\\"
 
+# Uncomment for compiling out all performance trace points (see Tracer).
+# DEFINES += TOME_NO_TRACING
+
 RC_ICONS = ../Media/Icons/Tome.ico
 ICON = ../Media/Icons/Tome.icns
 
@@ -60,17 +63,26 @@ SOURCES += ../Source/Tome/main.cpp \
     ../Source/Tome/Core/controller.cpp \
     ../Source/Tome/Features/Export/Controller/exportcontroller.cpp \
     ../Source/Tome/Features/Records/Controller/recordscontroller.cpp \
+    ../Source/Tome/Features/Records/Controller/thumbnailcontroller.cpp \
     ../Source/Tome/Features/Fields/Controller/fielddefinitionscontroller.cpp \
     ../Source/Tome/Features/Types/Controller/typescontroller.cpp \
     ../Source/Tome/Features/Settings/Controller/settingscontroller.cpp \
-    ../Source/Tome/Features/Records/View/recordtreewidgetitem.cpp \
+    ../Source/Tome/Features/Records/View/recordlistmodel.cpp \
+    ../Source/Tome/Features/Records/View/recordpickerwidget.cpp \
+    ../Source/Tome/Features/Records/View/recordtreemodel.cpp \
     ../Source/Tome/Features/Records/View/recordtreewidget.cpp \
+    ../Source/Tome/Features/Server/Controller/serverclient.cpp \
+    ../Source/Tome/Features/Server/Controller/servercontroller.cpp \
     ../Source/Tome/Features/Tasks/Controller/task.cpp \
+    ../Source/Tome/Features/Tasks/Controller/taskresultserializer.cpp \
     ../Source/Tome/Features/Tasks/Controller/taskscontroller.cpp \
     ../Source/Tome/Features/Tasks/Model/taskcontext.cpp \
     ../Source/Tome/Features/Integrity/Controller/fieldtypedoesnotexisttask.cpp \
     ../Source/Tome/Features/Integrity/Controller/listitemtypedoesnotexisttask.cpp \
     ../Source/Tome/Features/Tasks/View/errorlistdockwidget.cpp \
+    ../Source/Tome/Features/Tasks/View/errorlistfilterproxymodel.cpp \
+    ../Source/Tome/Features/Tasks/View/errorlistmodel.cpp \
+    ../Source/Tome/Features/Records/View/recordfieldstablemodel.cpp \
     ../Source/Tome/Features/Records/View/recordfieldstablewidget.cpp \
     ../Source/Tome/Features/Fields/View/vector2iwidget.cpp \
     ../Source/Tome/Features/Fields/View/vector3iwidget.cpp \
@@ -92,6 +104,7 @@ SOURCES += ../Source/Tome/main.cpp \
     ../Source/Tome/Features/Types/Controller/customtypesetserializer.cpp \
     ../Source/Tome/Features/Export/Controller/exporttemplateserializer.cpp \
     ../Source/Tome/Features/Search/Controller/findrecordcontroller.cpp \
+    ../Source/Tome/Features/Search/View/findfieldvaluewindow.cpp \
     ../Source/Tome/Features/Search/View/findrecordwindow.cpp \
     ../Source/Tome/Features/Projects/View/projectoverviewwindow.cpp \
     ../Source/Tome/Features/Settings/View/usersettingswindow.cpp \
@@ -107,10 +120,13 @@ SOURCES += ../Source/Tome/main.cpp \
     ../Source/Tome/Features/Records/Controller/recordnamevalidator.cpp \
     ../Source/Tome/Features/Diagnostics/Controller/messagehandlers.cpp \
     ../Source/Tome/Features/Diagnostics/Controller/filemessagehandler.cpp \
+    ../Source/Tome/Features/Diagnostics/Controller/logcategories.cpp \
+    ../Source/Tome/Features/Diagnostics/Controller/tracer.cpp \
     ../Source/Tome/Features/Diagnostics/View/outputdockwidget.cpp \
     ../Source/Tome/Features/Types/View/derivedtypewindow.cpp \
     ../Source/Tome/Features/Integrity/Controller/typefacetviolatedtask.cpp \
     ../Source/Tome/Features/Records/Controller/Commands/updaterecordfieldvaluecommand.cpp \
+    ../Source/Tome/Features/Records/Controller/Commands/updaterecordfieldvaluescommand.cpp \
     ../Source/Tome/Features/Undo/Controller/undocontroller.cpp \
     ../Source/Tome/Features/Components/Controller/Commands/addcomponentcommand.cpp \
     ../Source/Tome/Features/Components/Controller/Commands/removecomponentcommand.cpp \
@@ -133,7 +149,7 @@ SOURCES += ../Source/Tome/main.cpp \
     ../Source/Tome/Features/Records/Controller/Commands/updaterecordcommand.cpp \
     ../Source/Tome/Features/Records/Controller/Commands/duplicaterecordcommand.cpp \
     ../Source/Tome/Features/Records/Controller/Commands/revertrecordcommand.cpp \
-    ../Source/Tome/Features/Records/Controller/Commands/reparentrecordcommand.cpp \
+    ../Source/Tome/Features/Records/Controller/Commands/reparentrecordscommand.cpp \
     ../Source/Tome/Features/Records/Controller/Commands/removerecordcommand.cpp \
     ../Source/Tome/Features/Import/Controller/importcontroller.cpp \
     ../Source/Tome/Features/Import/Controller/recorddatasource.cpp \
@@ -148,6 +164,7 @@ SOURCES += ../Source/Tome/main.cpp \
     ../Source/Tome/Features/Integrity/Controller/referencedrecorddoesnotexisttask.cpp \
     ../Source/Tome/Features/Integrity/Controller/fieldalwayshasitsdefaultvaluetask.cpp \
     ../Source/Tome/Features/Fields/View/filepickerwidget.cpp \
+    ../Source/Tome/Features/Projects/Controller/filewatchercontroller.cpp \
     ../Source/Tome/Features/Projects/Controller/projectcontroller.cpp \
     ../Source/Tome/Features/Facets/Controller/removedfileprefixfacet.cpp \
     ../Source/Tome/Features/Facets/Controller/removedfilesuffixfacet.cpp \
@@ -189,6 +206,7 @@ HEADERS  += ../Source/Tome/Core/mainwindow.h \
     ../Source/Tome/Features/Components/Model/componentlist.h \
     ../Source/Tome/Features/Export/Controller/exportcontroller.h \
     ../Source/Tome/Features/Records/Controller/recordscontroller.h \
+    ../Source/Tome/Features/Records/Controller/thumbnailcontroller.h \
     ../Source/Tome/Features/Records/Model/recordlist.h \
     ../Source/Tome/Features/Records/Model/recordsetlist.h \
     ../Source/Tome/Features/Fields/Controller/fielddefinitionscontroller.h \
@@ -197,24 +215,39 @@ HEADERS  += ../Source/Tome/Core/mainwindow.h \
     ../Source/Tome/Features/Types/Controller/typescontroller.h \
     ../Source/Tome/Features/Types/Model/customtypelist.h \
     ../Source/Tome/Features/Settings/Controller/settingscontroller.h \
+    ../Source/Tome/Util/hashutils.h \
     ../Source/Tome/Util/listutils.h \
     ../Source/Tome/Features/Export/Model/recordexporttemplatemap.h \
     ../Source/Tome/Util/memoryutils.h \
+    ../Source/Tome/Util/progressreporter.h \
+    ../Source/Tome/Util/stringreplacer.h \
+    ../Source/Tome/Util/trigramindex.h \
+    ../Source/Tome/Util/fulltextindex.h \
     ../Source/Tome/Util/stringutils.h \
-    ../Source/Tome/Features/Records/View/recordtreewidgetitem.h \
+    ../Source/Tome/Features/Records/View/recordlistmodel.h \
+    ../Source/Tome/Features/Records/View/recordpickerwidget.h \
+    ../Source/Tome/Features/Records/View/recordtreemodel.h \
     ../Source/Tome/Features/Records/View/recordtreewidget.h \
     ../Source/Tome/Features/Records/Model/recordfieldvaluemap.h \
     ../Source/Tome/Features/Records/Model/recordfieldstate.h \
+    ../Source/Tome/Features/Server/Controller/serverclient.h \
+    ../Source/Tome/Features/Server/Controller/servercontroller.h \
     ../Source/Tome/Features/Tasks/Controller/task.h \
+    ../Source/Tome/Features/Tasks/Controller/taskresultserializer.h \
     ../Source/Tome/Features/Tasks/Controller/taskscontroller.h \
     ../Source/Tome/Features/Tasks/Model/message.h \
     ../Source/Tome/Features/Tasks/Model/messagelist.h \
     ../Source/Tome/Features/Tasks/Model/severity.h \
     ../Source/Tome/Features/Tasks/Model/targetsitetype.h \
     ../Source/Tome/Features/Tasks/Model/taskcontext.h \
+    ../Source/Tome/Features/Tasks/Model/taskresult.h \
+    ../Source/Tome/Features/Tasks/Model/taskresultlist.h \
     ../Source/Tome/Features/Integrity/Controller/fieldtypedoesnotexisttask.h \
     ../Source/Tome/Features/Integrity/Controller/listitemtypedoesnotexisttask.h \
     ../Source/Tome/Features/Tasks/View/errorlistdockwidget.h \
+    ../Source/Tome/Features/Tasks/View/errorlistfilterproxymodel.h \
+    ../Source/Tome/Features/Tasks/View/errorlistmodel.h \
+    ../Source/Tome/Features/Records/View/recordfieldstablemodel.h \
     ../Source/Tome/Features/Records/View/recordfieldstablewidget.h \
     ../Source/Tome/Features/Types/Model/vector.h \
     ../Source/Tome/Features/Fields/View/vector2iwidget.h \
@@ -244,6 +277,7 @@ HEADERS  += ../Source/Tome/Core/mainwindow.h \
     ../Source/Tome/Features/Export/Controller/exporttemplateserializer.h \
     ../Source/Tome/Features/Export/Model/recordexporttemplatelist.h \
     ../Source/Tome/Features/Search/Controller/findrecordcontroller.h \
+    ../Source/Tome/Features/Search/View/findfieldvaluewindow.h \
     ../Source/Tome/Features/Search/View/findrecordwindow.h \
     ../Source/Tome/Features/Projects/View/projectoverviewwindow.h \
     ../Source/Tome/Features/Settings/View/usersettingswindow.h \
@@ -259,10 +293,14 @@ HEADERS  += ../Source/Tome/Core/mainwindow.h \
     ../Source/Tome/Features/Records/Controller/recordnamevalidator.h \
     ../Source/Tome/Features/Diagnostics/Controller/messagehandlers.h \
     ../Source/Tome/Features/Diagnostics/Controller/filemessagehandler.h \
+    ../Source/Tome/Features/Diagnostics/Controller/logcategories.h \
+    ../Source/Tome/Features/Diagnostics/Controller/tracer.h \
     ../Source/Tome/Features/Diagnostics/View/outputdockwidget.h \
     ../Source/Tome/Features/Types/View/derivedtypewindow.h \
     ../Source/Tome/Features/Integrity/Controller/typefacetviolatedtask.h \
     ../Source/Tome/Features/Records/Controller/Commands/updaterecordfieldvaluecommand.h \
+    ../Source/Tome/Features/Records/Controller/Commands/updaterecordfieldvaluescommand.h \
+    ../Source/Tome/Features/Undo/Controller/sizedundocommand.h \
     ../Source/Tome/Features/Undo/Controller/undocontroller.h \
     ../Source/Tome/Features/Components/Controller/Commands/addcomponentcommand.h \
     ../Source/Tome/Features/Components/Controller/Commands/removecomponentcommand.h \
@@ -285,7 +323,7 @@ HEADERS  += ../Source/Tome/Core/mainwindow.h \
     ../Source/Tome/Features/Records/Controller/Commands/updaterecordcommand.h \
     ../Source/Tome/Features/Records/Controller/Commands/duplicaterecordcommand.h \
     ../Source/Tome/Features/Records/Controller/Commands/revertrecordcommand.h \
-    ../Source/Tome/Features/Records/Controller/Commands/reparentrecordcommand.h \
+    ../Source/Tome/Features/Records/Controller/Commands/reparentrecordscommand.h \
     ../Source/Tome/Features/Records/Controller/Commands/removerecordcommand.h \
     ../Source/Tome/Features/Import/Model/recordtableimporttemplate.h \
     ../Source/Tome/Features/Import/Model/tabletype.h \
@@ -303,6 +341,7 @@ HEADERS  += ../Source/Tome/Core/mainwindow.h \
     ../Source/Tome/Features/Integrity/Controller/referencedrecorddoesnotexisttask.h \
     ../Source/Tome/Features/Integrity/Controller/fieldalwayshasitsdefaultvaluetask.h \
     ../Source/Tome/Features/Fields/View/filepickerwidget.h \
+    ../Source/Tome/Features/Projects/Controller/filewatchercontroller.h \
     ../Source/Tome/Features/Projects/Controller/projectcontroller.h \
     ../Source/Tome/Features/Facets/Controller/removedfileprefixfacet.h \
     ../Source/Tome/Features/Facets/Controller/removedfilesuffixfacet.h \
@@ -328,6 +367,7 @@ FORMS    += ../Source/Tome/Core/mainwindow.ui \
     ../Source/Tome/Features/Records/View/duplicaterecordwindow.ui \
     ../Source/Tome/Features/Types/View/mapwindow.ui \
     ../Source/Tome/Features/Fields/View/mapitemwindow.ui \
+    ../Source/Tome/Features/Search/View/findfieldvaluewindow.ui \
     ../Source/Tome/Features/Search/View/findrecordwindow.ui \
     ../Source/Tome/Features/Projects/View/projectoverviewwindow.ui \
     ../Source/Tome/Features/Settings/View/usersettingswindow.ui \
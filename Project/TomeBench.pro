@@ -0,0 +1,21 @@
+#-------------------------------------------------
+#
+# Benchmarks for loading, saving, exporting, importing,
+# searching and checking synthetic projects.
+#
+#-------------------------------------------------
+
+include(Tome.pro)
+
+
+TARGET = TomeBench
+
+SOURCES -= ../Source/Tome/main.cpp
+
+HEADERS += ../Source/Tome/Benchmarks/benchmarkrunner.h \
+    ../Source/Tome/Benchmarks/syntheticprojectgenerator.h \
+    ../Source/Tome/Benchmarks/syntheticprojectoptions.h
+
+SOURCES += ../Source/Tome/benchmain.cpp \
+    ../Source/Tome/Benchmarks/benchmarkrunner.cpp \
+    ../Source/Tome/Benchmarks/syntheticprojectgenerator.cpp
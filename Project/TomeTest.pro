@@ -11,9 +11,27 @@ QT += testlib
 
 SOURCES -= ../Source/Tome/main.cpp
 
-HEADERS += ../Source/Tome/Tests/testlistutils.h \
-    ../Source/Tome/Tests/teststringutils.h
+HEADERS += ../Source/Tome/Tests/testfilewatchercontroller.h \
+    ../Source/Tome/Tests/testfulltextindex.h \
+    ../Source/Tome/Tests/testhashutils.h \
+    ../Source/Tome/Tests/testlistutils.h \
+    ../Source/Tome/Tests/testmemoryutils.h \
+    ../Source/Tome/Tests/testprogressreporter.h \
+    ../Source/Tome/Tests/testprojectfixture.h \
+    ../Source/Tome/Tests/teststringreplacer.h \
+    ../Source/Tome/Tests/teststringutils.h \
+    ../Source/Tome/Tests/testtrigramindex.h \
+    ../Source/Tome/Tests/testupdaterecordfieldvaluescommand.h
 
 SOURCES += ../Source/Tome/testmain.cpp \
+    ../Source/Tome/Tests/testfilewatchercontroller.cpp \
+    ../Source/Tome/Tests/testfulltextindex.cpp \
+    ../Source/Tome/Tests/testhashutils.cpp \
     ../Source/Tome/Tests/testlistutils.cpp \
-    ../Source/Tome/Tests/teststringutils.cpp
+    ../Source/Tome/Tests/testmemoryutils.cpp \
+    ../Source/Tome/Tests/testprogressreporter.cpp \
+    ../Source/Tome/Tests/testprojectfixture.cpp \
+    ../Source/Tome/Tests/teststringreplacer.cpp \
+    ../Source/Tome/Tests/teststringutils.cpp \
+    ../Source/Tome/Tests/testtrigramindex.cpp \
+    ../Source/Tome/Tests/testupdaterecordfieldvaluescommand.cpp
@@ -0,0 +1,86 @@
+#include "benchmarkrunner.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <QElapsedTimer>
+#include <QVector>
+
+
+BenchmarkRunner::BenchmarkRunner(int iterations)
+    : iterations(qMax(1, iterations)),
+      failed(false)
+{
+}
+
+void BenchmarkRunner::run(const QString& name, std::function<void()> benchmark, std::function<void()> setup)
+{
+    qInfo(qUtf8Printable(QString("Running benchmark %1.").arg(name)));
+
+    QVector<double> durations;
+    QJsonObject result;
+    result["name"] = name;
+
+    try
+    {
+        for (int i = 0; i < this->iterations; ++i)
+        {
+            if (setup)
+            {
+                setup();
+            }
+
+            QElapsedTimer timer;
+            timer.start();
+
+            benchmark();
+
+            durations << timer.nsecsElapsed() / 1000000.0;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        qCritical(qUtf8Printable(QString("Benchmark %1 failed: %2").arg(name, e.what())));
+        result["error"] = QString(e.what());
+        this->failed = true;
+    }
+
+    result["iterations"] = durations.count();
+
+    if (!durations.isEmpty())
+    {
+        std::sort(durations.begin(), durations.end());
+
+        double sum = 0.0;
+
+        for (double duration : durations)
+        {
+            sum += duration;
+        }
+
+        const int middle = durations.count() / 2;
+        const double median = durations.count() % 2 == 0
+                ? (durations[middle - 1] + durations[middle]) / 2
+                : durations[middle];
+
+        result["minimumMilliseconds"] = durations.first();
+        result["medianMilliseconds"] = median;
+        result["meanMilliseconds"] = sum / durations.count();
+        result["maximumMilliseconds"] = durations.last();
+
+        qInfo(qUtf8Printable(QString("Benchmark %1 took %2 ms (median of %3 iterations).")
+              .arg(name, QString::number(median), QString::number(durations.count()))));
+    }
+
+    this->results.append(result);
+}
+
+const QJsonArray& BenchmarkRunner::getResults() const
+{
+    return this->results;
+}
+
+bool BenchmarkRunner::hasFailed() const
+{
+    return this->failed;
+}
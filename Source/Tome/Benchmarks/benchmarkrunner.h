@@ -0,0 +1,55 @@
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <functional>
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QString>
+
+
+/**
+ * @brief Runs benchmarks several times, and collects their timings for comparing them across runs.
+ */
+class BenchmarkRunner
+{
+    public:
+        /**
+         * @brief Constructs a new runner for benchmarks.
+         * @param iterations Number of times to run each benchmark.
+         */
+        BenchmarkRunner(int iterations);
+
+        /**
+         * @brief Runs the specified benchmark and records its timings.
+         *
+         * If the benchmark throws, it is recorded as failed, and all other benchmarks keep running.
+         *
+         * @param name Name of the benchmark to run.
+         * @param benchmark Operation to measure.
+         * @param setup Optional operation to run before every iteration, which is not measured.
+         */
+        void run(const QString& name, std::function<void()> benchmark, std::function<void()> setup = std::function<void()>());
+
+        /**
+         * @brief Gets the timings of all benchmarks that have been run so far.
+         *
+         * Every result contains the name of the benchmark, the number of iterations, and the minimum, median, mean and maximum duration in milliseconds.
+         *
+         * @return Timings of all benchmarks that have been run so far.
+         */
+        const QJsonArray& getResults() const;
+
+        /**
+         * @brief Checks whether any benchmark has thrown.
+         * @return true, if any benchmark has thrown, and false otherwise.
+         */
+        bool hasFailed() const;
+
+    private:
+        int iterations;
+        bool failed;
+        QJsonArray results;
+};
+
+#endif // BENCHMARKRUNNER_H
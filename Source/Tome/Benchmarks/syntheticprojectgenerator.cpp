@@ -0,0 +1,462 @@
+#include "syntheticprojectgenerator.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+
+#include "../Core/controller.h"
+#include "../Features/Components/Controller/componentscontroller.h"
+#include "../Features/Fields/Controller/fielddefinitionscontroller.h"
+#include "../Features/Import/Controller/importcontroller.h"
+#include "../Features/Projects/Controller/projectcontroller.h"
+#include "../Features/Records/Controller/recordscontroller.h"
+#include "../Features/Types/Controller/typescontroller.h"
+#include "../Features/Types/Model/builtintype.h"
+
+using namespace Tome;
+
+
+namespace
+{
+    const QString ProjectName = "Benchmark";
+    const QString ImportTemplateName = "Benchmark Import";
+    const QString ImportRootRecordId = "ImportedRecords";
+    const QString ListTypeName = "IntegerList";
+    const QString MapTypeName = "StringIntegerMap";
+}
+
+
+SyntheticProjectGenerator::SyntheticProjectGenerator(Controller& controller)
+    : controller(controller),
+      recordCount(0)
+{
+}
+
+void SyntheticProjectGenerator::generateProject(const QString& projectPath, const SyntheticProjectOptions& options)
+{
+    qInfo(qUtf8Printable(QString("Generating synthetic project with %1 records at %2.")
+          .arg(QString::number(options.recordCount), projectPath)));
+
+    this->random.seed(options.seed);
+    this->fieldIds.clear();
+    this->fieldTypes.clear();
+    this->recordIds.clear();
+    this->typeNames.clear();
+    this->enumerations.clear();
+    this->recordCount = options.recordCount;
+
+    QDir().mkpath(projectPath);
+
+    // Create empty project with a single set of each kind.
+    this->controller.getProjectController().createProject(ProjectName, projectPath, RecordIdType::String);
+
+    this->generateCustomTypes(options, ProjectName);
+    this->generateFields(options, ProjectName);
+    this->generateRecords(options, ProjectName);
+    this->generateImportFile(options, projectPath);
+    this->generateExportTemplate();
+
+    // Import template is part of the project, export template files are not.
+    this->controller.getImportController().addRecordImportTemplate(this->importTemplate);
+
+    this->controller.getProjectController().saveProject();
+}
+
+const RecordExportTemplate& SyntheticProjectGenerator::getExportTemplate() const
+{
+    return this->exportTemplate;
+}
+
+const QStringList& SyntheticProjectGenerator::getFieldIds() const
+{
+    return this->fieldIds;
+}
+
+const QString& SyntheticProjectGenerator::getImportFilePath() const
+{
+    return this->importFilePath;
+}
+
+const RecordTableImportTemplate& SyntheticProjectGenerator::getImportTemplate() const
+{
+    return this->importTemplate;
+}
+
+const QStringList& SyntheticProjectGenerator::getRecordIds() const
+{
+    return this->recordIds;
+}
+
+const QStringList& SyntheticProjectGenerator::getTypeNames() const
+{
+    return this->typeNames;
+}
+
+void SyntheticProjectGenerator::generateCustomTypes(const SyntheticProjectOptions& options, const QString& setName)
+{
+    TypesController& typesController = this->controller.getTypesController();
+
+    // Add collection types.
+    if (options.listFieldDensity > 0)
+    {
+        typesController.addList(ListTypeName, BuiltInType::Integer, setName);
+        this->typeNames << ListTypeName;
+    }
+
+    if (options.mapFieldDensity > 0)
+    {
+        typesController.addMap(MapTypeName, BuiltInType::String, BuiltInType::Integer, setName);
+        this->typeNames << MapTypeName;
+    }
+
+    // Alternate between enumerations and derived types with facets to validate.
+    for (int i = 0; i < options.customTypeCount; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            const QString name = QString("Enumeration%1").arg(i);
+            QStringList enumeration;
+
+            for (int j = 0; j < 5; ++j)
+            {
+                enumeration << QString("Value%1_%2").arg(QString::number(i), QString::number(j));
+            }
+
+            typesController.addEnumeration(name, enumeration, setName);
+            this->enumerations.insert(name, enumeration);
+            this->typeNames << name;
+        }
+        else
+        {
+            const QString name = QString("RangedInteger%1").arg(i);
+
+            QVariantMap facets;
+            facets["Min"] = 0;
+            facets["Max"] = 100;
+
+            typesController.addDerivedType(name, BuiltInType::Integer, facets, setName);
+            this->typeNames << name;
+        }
+    }
+}
+
+void SyntheticProjectGenerator::generateExportTemplate()
+{
+    // Same as the JSON export template of the example project.
+    this->exportTemplate = RecordExportTemplate();
+    this->exportTemplate.name = "Benchmark Export";
+    this->exportTemplate.fileExtension = ".json";
+    this->exportTemplate.exportRoots = true;
+    this->exportTemplate.exportInnerNodes = true;
+    this->exportTemplate.exportLeafs = true;
+    this->exportTemplate.exportAsTable = false;
+    this->exportTemplate.exportLocalizedFieldsOnly = false;
+    this->exportTemplate.recordFileTemplate = "{\n  \"hash\": \"$HASH$\",\n  \"records\": [\n$RECORDS$\n  ]\n}";
+    this->exportTemplate.recordTemplate = "    {\n      \"id\": \"$RECORD_ID$\",\n      \"attributes\": {\n$RECORD_FIELDS$\n      },\n"
+            "      \"components\": [\n$RECORD_COMPONENTS$\n      ],\n      \"parent_id\": \"$RECORD_PARENT$\"\n    }";
+    this->exportTemplate.recordDelimiter = ",\n";
+    this->exportTemplate.componentTemplate = "        \"$COMPONENT_NAME$\"";
+    this->exportTemplate.componentDelimiter = ",\n";
+    this->exportTemplate.fieldValueTemplate = "        \"$FIELD_ID$\": \"$FIELD_VALUE$\"";
+    this->exportTemplate.fieldValueDelimiter = ",\n";
+    this->exportTemplate.localizedFieldValueTemplate = "        \"$FIELD_ID$\": \"$RECORD_ROOT$.$RECORD_ID$.$FIELD_ID$\"";
+    this->exportTemplate.listTemplate = "        \"$FIELD_ID$\": [$FIELD_VALUE$]";
+    this->exportTemplate.listItemTemplate = "\"$LIST_ITEM$\"";
+    this->exportTemplate.listItemDelimiter = ", ";
+    this->exportTemplate.mapTemplate = "        \"$FIELD_ID$\": {\n$FIELD_VALUE$\n        }";
+    this->exportTemplate.mapItemTemplate = "            \"$FIELD_KEY$\": \"$FIELD_VALUE$\"";
+    this->exportTemplate.mapItemDelimiter = ",\n";
+}
+
+void SyntheticProjectGenerator::generateFields(const SyntheticProjectOptions& options, const QString& setName)
+{
+    ComponentsController& componentsController = this->controller.getComponentsController();
+    FieldDefinitionsController& fieldDefinitionsController = this->controller.getFieldDefinitionsController();
+
+    const int listFieldCount = qRound(options.fieldsPerRecord * options.listFieldDensity);
+    const int mapFieldCount = qRound(options.fieldsPerRecord * options.mapFieldDensity);
+    const int referenceFieldCount = qRound(options.fieldsPerRecord * options.referenceFieldDensity);
+
+    // Cycle through built-in types and generated enumerations and derived types for all other fields.
+    QStringList scalarTypes;
+    scalarTypes << BuiltInType::Integer << BuiltInType::Real << BuiltInType::String << BuiltInType::Boolean;
+
+    for (const QString& typeName : this->typeNames)
+    {
+        if (typeName != ListTypeName && typeName != MapTypeName)
+        {
+            scalarTypes << typeName;
+        }
+    }
+
+    for (int i = 0; i < options.fieldsPerRecord; ++i)
+    {
+        QString fieldType;
+
+        if (i < listFieldCount)
+        {
+            fieldType = ListTypeName;
+        }
+        else if (i < listFieldCount + mapFieldCount)
+        {
+            fieldType = MapTypeName;
+        }
+        else if (i < listFieldCount + mapFieldCount + referenceFieldCount)
+        {
+            fieldType = BuiltInType::Reference;
+        }
+        else
+        {
+            fieldType = scalarTypes[i % scalarTypes.count()];
+        }
+
+        // Group fields in components of five.
+        const QString component = QString("Component%1").arg(i / 5);
+
+        if (i % 5 == 0)
+        {
+            componentsController.addComponent(component, setName);
+        }
+
+        const QString fieldId = QString("Field%1").arg(i);
+
+        fieldDefinitionsController.addFieldDefinition(fieldId,
+                                                      QString("Field %1").arg(i),
+                                                      fieldType,
+                                                      this->getDefaultFieldValue(fieldType),
+                                                      component,
+                                                      QString("Synthetic %1 field.").arg(fieldType),
+                                                      setName);
+
+        this->fieldIds << fieldId;
+        this->fieldTypes << fieldType;
+    }
+}
+
+void SyntheticProjectGenerator::generateImportFile(const SyntheticProjectOptions& options, const QString& projectPath)
+{
+    // Import into the first string and integer fields, if any.
+    const int stringFieldIndex = this->fieldTypes.indexOf(BuiltInType::String);
+    const int integerFieldIndex = this->fieldTypes.indexOf(BuiltInType::Integer);
+
+    QStringList headers;
+    headers << "Id" << "DisplayName";
+
+    if (stringFieldIndex >= 0)
+    {
+        headers << this->fieldIds[stringFieldIndex];
+    }
+
+    if (integerFieldIndex >= 0)
+    {
+        headers << this->fieldIds[integerFieldIndex];
+    }
+
+    this->importFilePath = QDir(projectPath).absoluteFilePath("Benchmark Import.csv");
+
+    QFile file(this->importFilePath);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        QString errorMessage = QObject::tr("Destination file could not be written:\r\n") + this->importFilePath;
+        throw std::runtime_error(errorMessage.toStdString());
+    }
+
+    QTextStream textStream(&file);
+    textStream.setCodec("UTF-8");
+    textStream << headers.join(";") << "\n";
+
+    // Update existing records with every other row, and add new ones with all others.
+    for (int i = 0; i < options.importRowCount; ++i)
+    {
+        QStringList row;
+
+        if (i % 2 == 0 && !this->recordIds.isEmpty())
+        {
+            const QString& recordId = this->recordIds[(i / 2) % this->recordIds.count()];
+            row << recordId << QString("%1 (Imported)").arg(recordId);
+        }
+        else
+        {
+            row << QString("Imported%1").arg(i) << QString("Imported Record %1").arg(i);
+        }
+
+        if (stringFieldIndex >= 0)
+        {
+            row << QString("Imported Value %1").arg(i);
+        }
+
+        if (integerFieldIndex >= 0)
+        {
+            row << QString::number(this->randomInt(0, 1000));
+        }
+
+        textStream << row.join(";") << "\n";
+    }
+
+    // Setup import template.
+    this->importTemplate = RecordTableImportTemplate();
+    this->importTemplate.name = ImportTemplateName;
+    this->importTemplate.path = ImportTemplateName;
+    this->importTemplate.idColumn = "Id";
+    this->importTemplate.displayNameColumn = "DisplayName";
+    this->importTemplate.sourceType = TableType::Csv;
+    this->importTemplate.rootRecordId = ImportRootRecordId;
+    this->importTemplate.parameters["Delimiter"] = ";";
+}
+
+void SyntheticProjectGenerator::generateRecords(const SyntheticProjectOptions& options, const QString& setName)
+{
+    RecordsController& recordsController = this->controller.getRecordsController();
+
+    // Choose the number of children per record that fills the requested number of hierarchy levels.
+    int childrenPerRecord = 0;
+
+    if (options.hierarchyDepth > 1 && options.recordCount > 1)
+    {
+        childrenPerRecord = qMax(2, static_cast<int>(std::ceil(std::pow(options.recordCount, 1.0 / (options.hierarchyDepth - 1)))));
+    }
+
+    for (int i = 0; i < options.recordCount; ++i)
+    {
+        const QString recordId = QString("Record%1").arg(i);
+        const bool isRoot = childrenPerRecord == 0 || i == 0;
+
+        // Roots define all fields, their descendants inherit them.
+        recordsController.addRecord(recordId,
+                                    QString("Record %1").arg(i),
+                                    QString(),
+                                    isRoot ? this->fieldIds : QStringList(),
+                                    setName);
+
+        if (!isRoot)
+        {
+            recordsController.reparentRecord(recordId, this->recordIds[(i - 1) / childrenPerRecord]);
+        }
+
+        this->recordIds << recordId;
+
+        // Override some of the field values.
+        const int overrideThreshold = qRound(options.overriddenFieldDensity * 1000);
+
+        for (int j = 0; j < this->fieldIds.count(); ++j)
+        {
+            if (this->randomInt(0, 999) < overrideThreshold)
+            {
+                recordsController.updateRecordFieldValue(recordId, this->fieldIds[j], this->generateFieldValue(this->fieldTypes[j]));
+            }
+        }
+    }
+}
+
+const QVariant SyntheticProjectGenerator::generateFieldValue(const QString& fieldType)
+{
+    if (fieldType == BuiltInType::Integer)
+    {
+        return this->randomInt(0, 1000);
+    }
+
+    if (fieldType == BuiltInType::Real)
+    {
+        return this->randomInt(0, 100000) / 100.0;
+    }
+
+    if (fieldType == BuiltInType::String)
+    {
+        return QString("Value %1").arg(this->randomInt(0, 1000000));
+    }
+
+    if (fieldType == BuiltInType::Boolean)
+    {
+        return this->randomInt(0, 1) == 1;
+    }
+
+    if (fieldType == BuiltInType::Reference)
+    {
+        return QString("Record%1").arg(this->randomInt(0, this->recordCount - 1));
+    }
+
+    if (fieldType == ListTypeName)
+    {
+        QVariantList list;
+        const int itemCount = this->randomInt(1, 5);
+
+        for (int i = 0; i < itemCount; ++i)
+        {
+            list << this->randomInt(0, 1000);
+        }
+
+        return list;
+    }
+
+    if (fieldType == MapTypeName)
+    {
+        QVariantMap map;
+        const int itemCount = this->randomInt(1, 5);
+
+        for (int i = 0; i < itemCount; ++i)
+        {
+            map[QString("Key%1").arg(i)] = this->randomInt(0, 1000);
+        }
+
+        return map;
+    }
+
+    if (this->enumerations.contains(fieldType))
+    {
+        const QStringList& enumeration = this->enumerations[fieldType];
+        return enumeration[this->randomInt(0, enumeration.count() - 1)];
+    }
+
+    // Derived types are restricted to a range of integers.
+    return this->randomInt(0, 100);
+}
+
+const QVariant SyntheticProjectGenerator::getDefaultFieldValue(const QString& fieldType) const
+{
+    if (fieldType == BuiltInType::Integer)
+    {
+        return 0;
+    }
+
+    if (fieldType == BuiltInType::Real)
+    {
+        return 0.0;
+    }
+
+    if (fieldType == BuiltInType::String || fieldType == BuiltInType::Reference)
+    {
+        return QString();
+    }
+
+    if (fieldType == BuiltInType::Boolean)
+    {
+        return false;
+    }
+
+    if (fieldType == ListTypeName)
+    {
+        return QVariantList();
+    }
+
+    if (fieldType == MapTypeName)
+    {
+        return QVariantMap();
+    }
+
+    if (this->enumerations.contains(fieldType))
+    {
+        return this->enumerations[fieldType].first();
+    }
+
+    return 0;
+}
+
+int SyntheticProjectGenerator::randomInt(int minimum, int maximum)
+{
+    std::uniform_int_distribution<int> distribution(minimum, maximum);
+    return distribution(this->random);
+}
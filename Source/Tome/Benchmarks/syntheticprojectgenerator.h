@@ -0,0 +1,108 @@
+#ifndef SYNTHETICPROJECTGENERATOR_H
+#define SYNTHETICPROJECTGENERATOR_H
+
+#include <random>
+
+#include <QMap>
+#include <QStringList>
+#include <QVariant>
+
+#include "syntheticprojectoptions.h"
+#include "../Features/Export/Model/recordexporttemplate.h"
+#include "../Features/Import/Model/recordtableimporttemplate.h"
+
+namespace Tome
+{
+    class Controller;
+}
+
+
+/**
+ * @brief Generates projects of configurable size for benchmarking loading, saving, exporting, importing, searching and checking data.
+ *
+ * All content is derived from a fixed seed, so that every run generates the same project.
+ */
+class SyntheticProjectGenerator
+{
+    public:
+        /**
+         * @brief Constructs a new generator for synthetic projects.
+         * @param controller Main controller to generate the project with.
+         */
+        SyntheticProjectGenerator(Tome::Controller& controller);
+
+        /**
+         * @brief Creates a new project at the specified path, fills it with generated types, fields and records, and saves it to disk.
+         *
+         * Also creates an export template and an import template with a matching CSV file, which are not added to the project files.
+         *
+         * @exception std::runtime_error if any of the project files could not be written.
+         *
+         * @param projectPath Path to write the project files to.
+         * @param options Size and shape of the project to generate.
+         */
+        void generateProject(const QString& projectPath, const SyntheticProjectOptions& options);
+
+        /**
+         * @brief Gets the template for exporting all records of the generated project as JSON.
+         * @return Template for exporting all records of the generated project.
+         */
+        const Tome::RecordExportTemplate& getExportTemplate() const;
+
+        /**
+         * @brief Gets the ids of all generated fields.
+         * @return Ids of all generated fields.
+         */
+        const QStringList& getFieldIds() const;
+
+        /**
+         * @brief Gets the absolute path of the generated CSV file to import.
+         * @return Absolute path of the generated CSV file to import.
+         */
+        const QString& getImportFilePath() const;
+
+        /**
+         * @brief Gets the template for importing the generated CSV file.
+         * @return Template for importing the generated CSV file.
+         */
+        const Tome::RecordTableImportTemplate& getImportTemplate() const;
+
+        /**
+         * @brief Gets the ids of all generated records.
+         * @return Ids of all generated records.
+         */
+        const QStringList& getRecordIds() const;
+
+        /**
+         * @brief Gets the names of all generated custom types.
+         * @return Names of all generated custom types.
+         */
+        const QStringList& getTypeNames() const;
+
+    private:
+        Tome::Controller& controller;
+
+        std::mt19937 random;
+
+        Tome::RecordExportTemplate exportTemplate;
+        Tome::RecordTableImportTemplate importTemplate;
+        QString importFilePath;
+
+        QStringList fieldIds;
+        QStringList fieldTypes;
+        QStringList recordIds;
+        QStringList typeNames;
+        QMap<QString, QStringList> enumerations;
+        int recordCount;
+
+        void generateCustomTypes(const SyntheticProjectOptions& options, const QString& setName);
+        void generateExportTemplate();
+        void generateFields(const SyntheticProjectOptions& options, const QString& setName);
+        void generateImportFile(const SyntheticProjectOptions& options, const QString& projectPath);
+        void generateRecords(const SyntheticProjectOptions& options, const QString& setName);
+        const QVariant generateFieldValue(const QString& fieldType);
+        const QVariant getDefaultFieldValue(const QString& fieldType) const;
+        int randomInt(int minimum, int maximum);
+};
+
+#endif // SYNTHETICPROJECTGENERATOR_H
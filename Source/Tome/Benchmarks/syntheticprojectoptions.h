@@ -0,0 +1,84 @@
+#ifndef SYNTHETICPROJECTOPTIONS_H
+#define SYNTHETICPROJECTOPTIONS_H
+
+#include <QJsonObject>
+
+
+/**
+ * @brief Size and shape of a synthetic project to generate for benchmarking.
+ */
+class SyntheticProjectOptions
+{
+    public:
+        /**
+         * @brief Number of records to generate.
+         */
+        int recordCount = 1000;
+
+        /**
+         * @brief Number of levels of the record hierarchy. One level creates a flat list of records.
+         */
+        int hierarchyDepth = 4;
+
+        /**
+         * @brief Number of fields every record has.
+         */
+        int fieldsPerRecord = 20;
+
+        /**
+         * @brief Share of fields with list types, between 0 and 1.
+         */
+        double listFieldDensity = 0.1;
+
+        /**
+         * @brief Share of fields with map types, between 0 and 1.
+         */
+        double mapFieldDensity = 0.05;
+
+        /**
+         * @brief Share of fields referencing other records, between 0 and 1.
+         */
+        double referenceFieldDensity = 0.1;
+
+        /**
+         * @brief Share of field values of every record that differ from the inherited value, between 0 and 1.
+         */
+        double overriddenFieldDensity = 0.5;
+
+        /**
+         * @brief Number of enumeration and derived types to generate.
+         */
+        int customTypeCount = 10;
+
+        /**
+         * @brief Number of rows of the table to import, half of them updating existing records.
+         */
+        int importRowCount = 100;
+
+        /**
+         * @brief Seed of the random number generator, for generating the same project in every run.
+         */
+        unsigned int seed = 42;
+
+        /**
+         * @brief Converts these options to JSON, for telling which project benchmark results belong to.
+         * @return JSON object containing all options.
+         */
+        QJsonObject toJson() const
+        {
+            QJsonObject json;
+            json["recordCount"] = this->recordCount;
+            json["hierarchyDepth"] = this->hierarchyDepth;
+            json["fieldsPerRecord"] = this->fieldsPerRecord;
+            json["listFieldDensity"] = this->listFieldDensity;
+            json["mapFieldDensity"] = this->mapFieldDensity;
+            json["referenceFieldDensity"] = this->referenceFieldDensity;
+            json["overriddenFieldDensity"] = this->overriddenFieldDensity;
+            json["customTypeCount"] = this->customTypeCount;
+            json["importRowCount"] = this->importRowCount;
+            json["seed"] = static_cast<qint64>(this->seed);
+            return json;
+        }
+};
+
+#endif // SYNTHETICPROJECTOPTIONS_H
@@ -14,6 +14,75 @@ void CommandLineOptions::parse(int argc, char* argv[])
             continue;
         }
 
+        // Parse integrity check, which never needs a window.
+        if (!qstrcmp(argv[i], "-check"))
+        {
+            this->check = true;
+            this->noGui = true;
+            continue;
+        }
+
+        if (!qstrcmp(argv[i], "-check-format") && (i + 1 < argc))
+        {
+            this->checkFormat = QString(argv[i + 1]).toLower();
+            i = i + 1;
+            continue;
+        }
+
+        if (!qstrcmp(argv[i], "-check-output") && (i + 1 < argc))
+        {
+            this->checkOutputPath = QString(argv[i + 1]);
+            i = i + 1;
+            continue;
+        }
+
+        // Parse server, which never needs a window.
+        if (!qstrcmp(argv[i], "-serve"))
+        {
+            this->serve = true;
+            this->noGui = true;
+            continue;
+        }
+
+        if (!qstrcmp(argv[i], "-server-name") && (i + 1 < argc))
+        {
+            this->serverName = QString(argv[i + 1]);
+            i = i + 1;
+            continue;
+        }
+
+        // Parse client command, followed by its arguments.
+        if (!qstrcmp(argv[i], "-client") && (i + 1 < argc))
+        {
+            this->clientCommand = QString(argv[i + 1]);
+            this->noGui = true;
+            i = i + 1;
+
+            while (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                this->clientArguments << QString(argv[i + 1]);
+                i = i + 1;
+            }
+
+            continue;
+        }
+
+        // Parse log filter rules.
+        if (!qstrcmp(argv[i], "-log-rules") && (i + 1 < argc))
+        {
+            this->logRules = QString(argv[i + 1]);
+            i = i + 1;
+            continue;
+        }
+
+        // Parse performance trace.
+        if (!qstrcmp(argv[i], "-trace") && (i + 1 < argc))
+        {
+            this->traceOutputPath = QString(argv[i + 1]);
+            i = i + 1;
+            continue;
+        }
+
         // Parse project path.
         if (!qstrcmp(argv[i], "-project") && (i + 1 < argc))
         {
@@ -22,10 +91,10 @@ void CommandLineOptions::parse(int argc, char* argv[])
             continue;
         }
 
-        // Parse export.
+        // Parse export, allowing a comma-separated list of templates.
         if (!qstrcmp(argv[i], "-export") && (i + 2 < argc))
         {
-            this->exportTemplateName = QString(argv[i + 1]);
+            this->exportTemplateNames = QString(argv[i + 1]).split(',', QString::SkipEmptyParts);
             this->exportPath = QString(argv[i + 2]);
             i = i + 2;
             continue;
@@ -2,6 +2,7 @@
 #define COMMANDLINEOPTIONS_H
 
 #include <QString>
+#include <QStringList>
 
 namespace Tome
 {
@@ -28,15 +29,45 @@ namespace Tome
              */
             char** argv = nullptr;
 
+            /**
+             * @brief Whether to run all integrity checks on the project without opening a window, instead of editing it.
+             */
+            bool check = false;
+
+            /**
+             * @brief Format to write integrity check results in, either json or junit.
+             */
+            QString checkFormat = "json";
+
+            /**
+             * @brief Path of the file to write integrity check results to, or empty for writing them to the standard output.
+             */
+            QString checkOutputPath;
+
+            /**
+             * @brief Arguments of the command to send to a running Tome server.
+             */
+            QStringList clientArguments;
+
+            /**
+             * @brief Command to send to a running Tome server instead of opening the project, if any.
+             */
+            QString clientCommand;
+
             /**
              * @brief Path to export all data to.
              */
             QString exportPath;
 
             /**
-             * @brief Name of the export template to use for the export.
+             * @brief Names of the export templates to use for the export, each writing its own file.
+             */
+            QStringList exportTemplateNames;
+
+            /**
+             * @brief Semicolon-separated rules for enabling or disabling log messages by category and severity (e.g. tome.records.info=true).
              */
-            QString exportTemplateName;
+            QString logRules;
 
             /**
              * @brief Whether to prevent Tome from opening a window.
@@ -47,6 +78,21 @@ namespace Tome
              * @brief Project to open.
              */
             QString projectPath;
+
+            /**
+             * @brief Whether to keep the project loaded and serve requests from other processes, instead of editing it.
+             */
+            bool serve = false;
+
+            /**
+             * @brief Name of the local socket to serve requests at, or to send requests to. Derived from the project path if empty.
+             */
+            QString serverName;
+
+            /**
+             * @brief Path of the file to write a performance trace to, or empty for not recording a trace.
+             */
+            QString traceOutputPath;
     };
 }
 
@@ -3,7 +3,11 @@
 #include <stdexcept>
 
 #include <QApplication>
+#include <QFile>
 #include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QLoggingCategory>
 #include <QSysInfo>
 
 #include "commandlineoptions.h"
@@ -11,6 +15,7 @@
 #include "../Features/Components/Controller/componentscontroller.h"
 #include "../Features/Diagnostics/Controller/filemessagehandler.h"
 #include "../Features/Diagnostics/Controller/messagehandlers.h"
+#include "../Features/Diagnostics/Controller/tracer.h"
 #include "../Features/Export/Controller/exportcontroller.h"
 #include "../Features/Facets/Controller/facetscontroller.h"
 #include "../Features/Facets/Controller/localizedstringfacet.h"
@@ -38,12 +43,17 @@
 #include "../Features/Integrity/Controller/referencedrecorddoesnotexisttask.h"
 #include "../Features/Integrity/Controller/typefacetviolatedtask.h"
 #include "../Features/Integrity/Controller/typeisneverusedtask.h"
+#include "../Features/Projects/Controller/filewatchercontroller.h"
 #include "../Features/Projects/Controller/projectcontroller.h"
 #include "../Features/Projects/Model/project.h"
 #include "../Features/Records/Controller/recordscontroller.h"
+#include "../Features/Records/Controller/thumbnailcontroller.h"
 #include "../Features/Search/Controller/findrecordcontroller.h"
 #include "../Features/Search/Controller/findusagescontroller.h"
+#include "../Features/Server/Controller/serverclient.h"
+#include "../Features/Server/Controller/servercontroller.h"
 #include "../Features/Settings/Controller/settingscontroller.h"
+#include "../Features/Tasks/Controller/taskresultserializer.h"
 #include "../Features/Tasks/Controller/taskscontroller.h"
 #include "../Features/Types/Controller/typescontroller.h"
 #include "../Features/Undo/Controller/undocontroller.h"
@@ -65,8 +75,11 @@ Controller::Controller(CommandLineOptions* options) :
     settingsController(new SettingsController()),
     tasksController(new TasksController(*this->componentsController, *this->facetsController, *this->fieldDefinitionsController, *this->projectController, *this->recordsController, *this->typesController)),
     findUsagesController(new FindUsagesController(*this->fieldDefinitionsController, *this->recordsController, *this->typesController)),
-    findRecordController(new FindRecordController(*this->recordsController)),
+    findRecordController(new FindRecordController(*this->fieldDefinitionsController, *this->recordsController, *this->typesController)),
     importController(new ImportController(*this->fieldDefinitionsController, *this->recordsController, *this->typesController)),
+    thumbnailController(new ThumbnailController()),
+    fileWatcherController(new FileWatcherController(*this->fieldDefinitionsController, *this->projectController, *this->recordsController, *this->typesController)),
+    serverController(0),
     mainWindow(0)
 {
     // Setup tasks.
@@ -124,8 +137,18 @@ Controller::~Controller()
     delete this->findRecordController;
     delete this->facetsController;
     delete this->importController;
+    delete this->thumbnailController;
+    delete this->fileWatcherController;
+
+    if (this->serverController != 0)
+    {
+        delete this->serverController;
+    }
 
     delete this->options;
+
+    // Write performance trace, if any.
+    Tracer::stop();
 }
 
 ProjectController&Controller::getProjectController() const
@@ -193,8 +216,24 @@ ImportController&Controller::getImportController() const
     return *this->importController;
 }
 
+ThumbnailController& Controller::getThumbnailController() const
+{
+    return *this->thumbnailController;
+}
+
+FileWatcherController& Controller::getFileWatcherController() const
+{
+    return *this->fileWatcherController;
+}
+
 int Controller::start()
 {
+    // Filter log messages before they're formatted.
+    if (!this->options->logRules.isEmpty())
+    {
+        QLoggingCategory::setFilterRules(this->options->logRules.split(';', QString::SkipEmptyParts).join('\n'));
+    }
+
     // Install message handlers.
     if (FileMessageHandler::init())
     {
@@ -209,6 +248,25 @@ int Controller::start()
     qInfo(qUtf8Printable(QString("OS: %1 %2").arg(QSysInfo::prettyProductName(), QSysInfo::kernelVersion())));
     qInfo(qUtf8Printable(QString("Machine Host Name: %1").arg(QSysInfo::machineHostName())));
 
+    // Record performance trace, if requested.
+    if (!this->options->traceOutputPath.isEmpty())
+    {
+        Tracer::start(this->options->traceOutputPath);
+    }
+    else if (this->settingsController->getRecordPerformanceTrace())
+    {
+        Tracer::start(Tracer::defaultFileName);
+    }
+
+    // Limit undo history.
+    this->undoController->setMemoryLimit(qint64(this->settingsController->getUndoMemoryLimit()) * 1024 * 1024);
+
+    // Send command to running server instead of loading the project again.
+    if (!this->options->clientCommand.isEmpty())
+    {
+        return this->runClient();
+    }
+
     if (!this->options->noGui)
     {
         qInfo("Setting up main window.");
@@ -226,7 +284,8 @@ int Controller::start()
     {
         try
         {
-            this->projectController->openProject(this->options->projectPath);
+            // Templates are not required for checking data only.
+            this->projectController->openProject(this->options->projectPath, !this->options->check);
         }
         catch (std::runtime_error& e)
         {
@@ -235,33 +294,190 @@ int Controller::start()
         }
     }
 
-    if (!this->options->exportTemplateName.isEmpty() &&
+    if (this->options->check)
+    {
+        return this->runChecks();
+    }
+
+    if (this->options->serve)
+    {
+        return this->serve();
+    }
+
+    if (!this->options->exportTemplateNames.isEmpty() &&
             !this->options->exportPath.isEmpty() &&
             this->projectController->isProjectLoaded())
     {
-        if (!this->exportController->hasRecordExportTemplate(this->options->exportTemplateName))
+        // Export records with all templates at once, skipping files that are up-to-date.
+        try
+        {
+            this->exportController->exportChangedRecords(this->options->exportTemplateNames, this->options->exportPath);
+        }
+        catch (std::exception& e)
         {
-            qCritical(QString("Export template not found: %1").arg(this->options->exportTemplateName).toUtf8().constData());
+            qCritical(e.what());
             return 1;
         }
+    }
 
-        // Get export template.
-        const Tome::RecordExportTemplate& exportTemplate =
-                this->exportController->getRecordExportTemplate(this->options->exportTemplateName);
+    return 0;
+}
 
-        // Build export file path.
-        const QString filePath = this->options->exportPath + exportTemplate.fileExtension;
+int Controller::runChecks()
+{
+    if (!this->projectController->isProjectLoaded())
+    {
+        qCritical("No project to check.");
+        return 1;
+    }
 
-        // Export records.
-        try
+    if (this->options->checkFormat != "json" && this->options->checkFormat != "junit")
+    {
+        qCritical(qUtf8Printable(QString("Unknown check output format: %1").arg(this->options->checkFormat)));
+        return 1;
+    }
+
+    // Run tasks.
+    const TaskResultList results = this->tasksController->runAllTasksInParallel();
+
+    // Report timings.
+    int errors = 0;
+
+    for (const TaskResult& result : results)
+    {
+        qInfo(qUtf8Printable(QString("%1: %2 ms, %3 message(s)")
+                             .arg(result.taskName, QString::number(result.elapsedMilliseconds), QString::number(result.messages.count()))));
+
+        for (const Message& message : result.messages)
         {
-            this->exportController->exportRecords(exportTemplate, filePath);
+            if (message.severity == Severity::Error)
+            {
+                ++errors;
+            }
         }
-        catch (std::runtime_error& e)
+    }
+
+    // Write results.
+    QFile outputFile;
+    bool outputOpened;
+
+    if (this->options->checkOutputPath.isEmpty())
+    {
+        outputOpened = outputFile.open(stdout, QIODevice::WriteOnly);
+    }
+    else
+    {
+        outputFile.setFileName(this->options->checkOutputPath);
+        outputOpened = outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    }
+
+    if (!outputOpened)
+    {
+        qCritical(qUtf8Printable(QString("Check results could not be written: %1").arg(this->options->checkOutputPath)));
+        return 1;
+    }
+
+    TaskResultSerializer taskResultSerializer;
+
+    if (this->options->checkFormat == "junit")
+    {
+        taskResultSerializer.serializeJUnit(outputFile, results);
+    }
+    else
+    {
+        taskResultSerializer.serializeJson(outputFile, results);
+    }
+
+    // Fail on errors.
+    if (errors > 0)
+    {
+        qCritical(qUtf8Printable(QString("Check failed with %1 error(s).").arg(errors)));
+        return 1;
+    }
+
+    return 0;
+}
+
+int Controller::runClient()
+{
+    const QString serverName = this->options->serverName.isEmpty()
+            ? ServerController::getDefaultServerName(this->options->projectPath)
+            : this->options->serverName;
+
+    // Build request.
+    const QString& command = this->options->clientCommand;
+    const QStringList& arguments = this->options->clientArguments;
+
+    QJsonObject request;
+    request[ServerController::KeyCommand] = command;
+
+    if (command == ServerController::CommandExport)
+    {
+        if (arguments.count() < 2)
         {
-            qCritical(e.what());
+            qCritical("Usage: -client export <template>[,<template>...] <path>");
             return 1;
         }
+
+        request[ServerController::KeyExportTemplates] =
+                QJsonArray::fromStringList(arguments[0].split(',', QString::SkipEmptyParts));
+        request[ServerController::KeyExportPath] = arguments[1];
+    }
+    else if (command == ServerController::CommandQuery && !arguments.isEmpty())
+    {
+        request[ServerController::KeyRecordId] = arguments[0];
+    }
+
+    // Send request.
+    QJsonObject response;
+
+    try
+    {
+        response = ServerClient().sendRequest(serverName, request);
+    }
+    catch (const std::runtime_error& e)
+    {
+        qCritical(e.what());
+        return 1;
+    }
+
+    // Print response.
+    QFile output;
+
+    if (output.open(stdout, QIODevice::WriteOnly))
+    {
+        output.write(QJsonDocument(response).toJson());
+    }
+
+    return response.value(ServerController::KeyExitCode).toInt(1);
+}
+
+int Controller::serve()
+{
+    if (!this->projectController->isProjectLoaded())
+    {
+        qCritical("No project to serve.");
+        return 1;
+    }
+
+    const QString serverName = this->options->serverName.isEmpty()
+            ? ServerController::getDefaultServerName(this->options->projectPath)
+            : this->options->serverName;
+
+    this->serverController = new ServerController(*this->exportController,
+                                                  *this->fileWatcherController,
+                                                  *this->projectController,
+                                                  *this->recordsController,
+                                                  *this->tasksController);
+
+    try
+    {
+        this->serverController->listen(serverName);
+    }
+    catch (const std::runtime_error& e)
+    {
+        qCritical(e.what());
+        return 1;
     }
 
     return 0;
@@ -285,4 +501,10 @@ void Controller::onProjectChanged(QSharedPointer<Project> project)
 
     // Reset undo stack.
     this->undoController->clear();
+
+    // Reload files changed outside of Tome while editing.
+    if (this->mainWindow != 0)
+    {
+        this->fileWatcherController->watchProjectFiles();
+    }
 }
@@ -11,6 +11,7 @@ namespace Tome
     class ComponentsController;
     class ExportController;
     class FacetsController;
+    class FileWatcherController;
     class FieldDefinitionsController;
     class FindRecordController;
     class FindUsagesController;
@@ -18,8 +19,10 @@ namespace Tome
     class Project;
     class ProjectController;
     class RecordsController;
+    class ServerController;
     class SettingsController;
     class TasksController;
+    class ThumbnailController;
     class TypesController;
     class UndoController;
 
@@ -116,6 +119,18 @@ namespace Tome
              */
             ImportController& getImportController() const;
 
+            /**
+             * @brief Gets the controller for loading thumbnails of image files in the background.
+             * @return Controller for loading thumbnails of image files in the background.
+             */
+            ThumbnailController& getThumbnailController() const;
+
+            /**
+             * @brief Gets the controller for watching project files for changes made outside of Tome.
+             * @return Controller for watching project files for changes made outside of Tome.
+             */
+            FileWatcherController& getFileWatcherController() const;
+
             /**
              * @brief Applies all command-line options and sets up the main window.
              * @return Zero, if all operations were successful, and another number otherwise.
@@ -141,8 +156,16 @@ namespace Tome
             FindUsagesController* findUsagesController;
             FindRecordController* findRecordController;
             ImportController* importController;
+            ThumbnailController* thumbnailController;
+            FileWatcherController* fileWatcherController;
+
+            ServerController* serverController;
 
             MainWindow* mainWindow;
+
+            int runChecks();
+            int runClient();
+            int serve();
     };
 }
 
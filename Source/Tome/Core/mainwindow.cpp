@@ -19,6 +19,7 @@
 #include "controller.h"
 #include "../Features/Components/View/componentswindow.h"
 #include "../Features/Components/Controller/componentscontroller.h"
+#include "../Features/Diagnostics/Controller/tracer.h"
 #include "../Features/Diagnostics/View/outputdockwidget.h"
 #include "../Features/Export/Controller/exportcontroller.h"
 #include "../Features/Facets/Controller/facet.h"
@@ -31,6 +32,7 @@
 #include "../Features/Import/Controller/importcontroller.h"
 #include "../Features/Import/Model/recordtableimporttemplatelist.h"
 #include "../Features/Projects/Model/project.h"
+#include "../Features/Projects/Controller/filewatchercontroller.h"
 #include "../Features/Projects/Controller/projectcontroller.h"
 #include "../Features/Projects/Controller/projectserializer.h"
 #include "../Features/Projects/View/newprojectwindow.h"
@@ -39,19 +41,20 @@
 #include "../Features/Records/Controller/recordsetserializer.h"
 #include "../Features/Records/Controller/Commands/addrecordcommand.h"
 #include "../Features/Records/Controller/Commands/duplicaterecordcommand.h"
-#include "../Features/Records/Controller/Commands/reparentrecordcommand.h"
+#include "../Features/Records/Controller/Commands/reparentrecordscommand.h"
 #include "../Features/Records/Controller/Commands/removerecordcommand.h"
 #include "../Features/Records/Controller/Commands/revertrecordcommand.h"
 #include "../Features/Records/Controller/Commands/updaterecordcommand.h"
 #include "../Features/Records/Controller/Commands/updaterecordfieldvaluecommand.h"
+#include "../Features/Records/Controller/Commands/updaterecordfieldvaluescommand.h"
 #include "../Features/Records/Model/recordfieldstate.h"
 #include "../Features/Records/View/recordfieldstablewidget.h"
 #include "../Features/Records/View/recordtreewidget.h"
-#include "../Features/Records/View/recordtreewidgetitem.h"
 #include "../Features/Records/View/recordwindow.h"
 #include "../Features/Records/View/duplicaterecordwindow.h"
 #include "../Features/Search/Controller/findrecordcontroller.h"
 #include "../Features/Search/Controller/findusagescontroller.h"
+#include "../Features/Search/View/findfieldvaluewindow.h"
 #include "../Features/Search/View/findrecordwindow.h"
 #include "../Features/Search/View/searchresultsdockwidget.h"
 #include "../Features/Settings/Controller/settingscontroller.h"
@@ -66,6 +69,7 @@
 #include "../Features/Undo/Controller/undocontroller.h"
 #include "../Util/listutils.h"
 #include "../Util/pathutils.h"
+#include "../Util/progressreporter.h"
 #include "../Util/stringutils.h"
 
 
@@ -84,10 +88,12 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
     newProjectWindow(0),
     recordWindow(0),
     duplicateRecordWindow(0),
+    findFieldValueWindow(0),
     findRecordWindow(0),
     projectOverviewWindow(0),
     userSettingsWindow(0),
     progressDialog(0),
+    progressCancelable(false),
     refreshRecordTreeAfterReparent(true)
 {
     ui->setupUi(this);
@@ -97,7 +103,8 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
                                                   this->controller->getFacetsController(),
                                                   this->controller->getFieldDefinitionsController(),
                                                   this->controller->getProjectController(),
-                                                  this->controller->getSettingsController());
+                                                  this->controller->getSettingsController(),
+                                                  this->controller->getThumbnailController());
     this->ui->splitter->addWidget(this->recordTreeWidget);
 
     // Setup record tree context menu.
@@ -118,7 +125,8 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
                 this->controller->getFacetsController(),
                 this->controller->getProjectController(),
                 this->controller->getRecordsController(),
-                this->controller->getTypesController());
+                this->controller->getTypesController(),
+                this->controller->getThumbnailController());
 
     this->ui->splitter->addWidget(this->recordFieldTableWidget);
 
@@ -149,6 +157,12 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
                 SLOT(onProjectChanged(QSharedPointer<Tome::Project>))
                 );
 
+    connect(
+                &this->controller->getFileWatcherController(),
+                SIGNAL(projectFilesChanged(const QStringList&)),
+                SLOT(onProjectFilesChanged(const QStringList&))
+                );
+
     connect(
                 &this->controller->getRecordsController(),
                 SIGNAL(recordAdded(const QVariant&, const QString&, const QVariant&)),
@@ -173,6 +187,12 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
                 SLOT(onRecordReparented(const QVariant&, const QVariant&, const QVariant&))
                 );
 
+    connect(
+                &this->controller->getRecordsController(),
+                SIGNAL(recordsReparented(const QVariantList&)),
+                SLOT(onRecordsReparented(const QVariantList&))
+                );
+
     connect(
                 &this->controller->getRecordsController(),
                 SIGNAL(recordSetsChanged()),
@@ -241,8 +261,8 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
 
     connect(
                 this->recordTreeWidget,
-                SIGNAL(recordReparented(const QVariant&, const QVariant&)),
-                SLOT(treeWidgetRecordReparented(const QVariant&, const QVariant&))
+                SIGNAL(recordsReparented(const QVariantList&, const QVariant&)),
+                SLOT(treeWidgetRecordsReparented(const QVariantList&, const QVariant&))
                 );
 
     connect(
@@ -299,18 +319,6 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
                 SLOT(onProgressChanged(QString, QString, int, int))
                 );
 
-    connect(
-                this->recordTreeWidget,
-                SIGNAL(progressChanged(QString,QString,int,int)),
-                SLOT(onProgressChanged(QString,QString,int,int))
-                );
-
-    connect(
-                this->errorListDockWidget,
-                SIGNAL(progressChanged(QString,QString,int,int)),
-                SLOT(onProgressChanged(QString,QString,int,int))
-                );
-
     connect(
                 this->errorListDockWidget,
                 SIGNAL(recordLinkActivated(const QString&)),
@@ -384,6 +392,12 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent) :
     this->progressDialog->setMaximum(1);
     this->progressDialog->setValue(1);
 
+    connect(
+                this->progressDialog,
+                SIGNAL(canceled()),
+                SLOT(onProgressCanceled())
+                );
+
     // Setup undo.
     this->ui->menuProject->addSeparator();
     this->ui->mainToolBar->addSeparator();
@@ -417,6 +431,7 @@ MainWindow::~MainWindow()
     delete this->fieldValueWindow;
     delete this->newProjectWindow;
     delete this->recordWindow;
+    delete this->findFieldValueWindow;
     delete this->findRecordWindow;
     delete this->projectOverviewWindow;
     delete this->userSettingsWindow;
@@ -1138,6 +1153,12 @@ void MainWindow::on_actionFindRecord_triggered()
     if (!this->findRecordWindow)
     {
         this->findRecordWindow = new FindRecordWindow();
+
+        connect(
+                    this->findRecordWindow,
+                    SIGNAL(searchPatternChanged(const QString&)),
+                    SLOT(onFindRecordSearchPatternChanged(const QString&))
+                    );
     }
 
     int result = this->findRecordWindow->exec();
@@ -1152,6 +1173,32 @@ void MainWindow::on_actionFindRecord_triggered()
     this->controller->getFindRecordController().findRecord(searchPattern);
 }
 
+void MainWindow::on_actionFindFieldValue_triggered()
+{
+    // Show window.
+    if (!this->findFieldValueWindow)
+    {
+        this->findFieldValueWindow = new FindFieldValueWindow();
+    }
+
+    // Fields and types may have changed since the window has been shown last.
+    const FindRecordController& findRecordController = this->controller->getFindRecordController();
+    this->findFieldValueWindow->setFieldIds(findRecordController.getSearchableFieldIds());
+    this->findFieldValueWindow->setTypeNames(findRecordController.getSearchableTypeNames());
+
+    int result = this->findFieldValueWindow->exec();
+
+    if (result != QDialog::Accepted)
+    {
+        return;
+    }
+
+    // Find field value.
+    findRecordController.findFieldValue(this->findFieldValueWindow->getQuery(),
+                                        this->findFieldValueWindow->getFieldId(),
+                                        this->findFieldValueWindow->getTypeName());
+}
+
 void MainWindow::on_actionFind_Usages_triggered()
 {
     // Find usages.
@@ -1197,6 +1244,21 @@ void MainWindow::on_actionUser_Settings_triggered()
     settingsController.setShowDescriptionColumnInsteadOfFieldTooltips(this->userSettingsWindow->getShowDescriptionColumnInsteadOfFieldTooltips());
     settingsController.setExpandRecordTreeOnRefresh(this->userSettingsWindow->getExpandRecordTreeOnRefresh());
     settingsController.setShowComponentNamesInRecordTable(this->userSettingsWindow->getShowComponentNamesInRecordTable());
+    settingsController.setRecordPerformanceTrace(this->userSettingsWindow->getRecordPerformanceTrace());
+    settingsController.setUndoMemoryLimit(this->userSettingsWindow->getUndoMemoryLimit());
+
+    // Start or stop recording performance trace.
+    if (settingsController.getRecordPerformanceTrace() && !Tracer::isEnabled())
+    {
+        Tracer::start(Tracer::defaultFileName);
+    }
+    else if (!settingsController.getRecordPerformanceTrace() && Tracer::isEnabled())
+    {
+        Tracer::stop();
+    }
+
+    // Limit undo history.
+    this->controller->getUndoController().setMemoryLimit(qint64(settingsController.getUndoMemoryLimit()) * 1024 * 1024);
 
     // Refresh view with updated settings.
     this->refreshRecordTable();
@@ -1376,15 +1438,13 @@ void MainWindow::revertFieldValue()
     QVariant recordId = this->recordTreeWidget->getSelectedRecordId();
 
     // Get field to revert.
-    auto selectedItems = this->recordFieldTableWidget->selectedItems();
+    const QString fieldId = this->recordFieldTableWidget->getSelectedFieldId();
 
-    if (selectedItems.empty())
+    if (fieldId.isEmpty())
     {
         return;
     }
 
-    const QString fieldId = selectedItems.first()->data(Qt::UserRole).toString();
-
     // Get inherited field value.
     QVariant valueToRevertTo = this->controller->getRecordsController().getInheritedFieldValue(recordId, fieldId);
 
@@ -1416,12 +1476,10 @@ void MainWindow::tableWidgetDoubleClicked(const QModelIndex &index)
     QVariantList ids = this->recordTreeWidget->getSelectedRecordIds();
     QVariant id = ids.first();
 
-    const RecordFieldValueMap fieldValues =
-            this->controller->getRecordsController().getRecordFieldValues(id);
-
     // Get current field data.
     const QString fieldId = index.data(Qt::UserRole).toString();
-    const QVariant fieldValue = fieldValues[fieldId];
+    const QVariant fieldValue =
+            this->controller->getRecordsController().getRecordFieldValue(id, fieldId);
 
     const FieldDefinition& field =
             this->controller->getFieldDefinitionsController().getFieldDefinition(fieldId);
@@ -1487,10 +1545,16 @@ void MainWindow::tableWidgetDoubleClicked(const QModelIndex &index)
         QVariant fieldValue = this->fieldValueWindow->getFieldValue();
 
         // Update model of all selected records.
-        for (int i = 0; i < ids.count(); ++i)
+        if (ids.count() == 1)
         {
             UpdateRecordFieldValueCommand* command =
-                    new UpdateRecordFieldValueCommand(this->controller->getRecordsController(), ids[i], fieldId, fieldValue);
+                    new UpdateRecordFieldValueCommand(this->controller->getRecordsController(), id, fieldId, fieldValue);
+            this->controller->getUndoController().doCommand(command);
+        }
+        else
+        {
+            UpdateRecordFieldValuesCommand* command =
+                    new UpdateRecordFieldValuesCommand(this->controller->getRecordsController(), ids, fieldId, fieldValue);
             this->controller->getUndoController().doCommand(command);
         }
 
@@ -1505,28 +1569,48 @@ void MainWindow::treeWidgetDoubleClicked(const QModelIndex &index)
     this->on_actionEdit_Record_triggered();
 }
 
-void MainWindow::treeWidgetRecordReparented(const QVariant& recordId, const QVariant& newParentId)
+void MainWindow::treeWidgetRecordsReparented(const QVariantList& recordIds, const QVariant& newParentId)
 {
-    // Check if allowed.
-    if (recordId == newParentId ||
-            this->controller->getRecordsController().isAncestorOf(recordId, newParentId))
+    RecordsController& recordsController = this->controller->getRecordsController();
+    QVariantList reparentedRecordIds;
+
+    // Validate all moves first.
+    for (const QVariant& recordId : recordIds)
     {
-        return;
-    }
+        // Check if allowed.
+        if (recordId == newParentId ||
+                recordsController.isAncestorOf(recordId, newParentId))
+        {
+            continue;
+        }
 
-    // Check if read-only.
-    const Record& record = this->controller->getRecordsController().getRecord(recordId);
+        // Check if anything to do.
+        if (recordsController.getParentId(recordId) == newParentId)
+        {
+            continue;
+        }
 
-    if (record.readOnly && !this->controller->getProjectController().getProjectIgnoreReadOnly())
+        // Check if read-only.
+        const Record& record = recordsController.getRecord(recordId);
+
+        if (record.readOnly && !this->controller->getProjectController().getProjectIgnoreReadOnly())
+        {
+            this->showReadOnlyMessage(recordId);
+            return;
+        }
+
+        reparentedRecordIds << recordId;
+    }
+
+    if (reparentedRecordIds.empty())
     {
-        this->showReadOnlyMessage(recordId);
         return;
     }
 
     // Update model.
-    ReparentRecordCommand* command = new ReparentRecordCommand(
-                this->controller->getRecordsController(),
-                recordId,
+    ReparentRecordsCommand* command = new ReparentRecordsCommand(
+                recordsController,
+                reparentedRecordIds,
                 newParentId);
     this->controller->getUndoController().doCommand(command);
 }
@@ -1639,6 +1723,17 @@ void MainWindow::onFileLinkActivated(const QString& filePath)
     showFileInExplorerOrFinder(filePath);
 }
 
+void MainWindow::onFindRecordSearchPatternChanged(const QString& searchPattern)
+{
+    // Search as the user types.
+    this->controller->getFindRecordController().findRecord(searchPattern);
+}
+
+void MainWindow::onProgressCanceled()
+{
+    ProgressReporter::cancelCurrent();
+}
+
 void MainWindow::onProgressChanged(const QString title, const QString text, const int currentValue, const int maximumValue)
 {
     // Check if finished.
@@ -1648,6 +1743,16 @@ void MainWindow::onProgressChanged(const QString title, const QString text, cons
         return;
     }
 
+    // Allow canceling only if the current operation supports it.
+    ProgressReporter* progress = ProgressReporter::current();
+    const bool cancelable = progress != nullptr && progress->isCancelable();
+
+    if (cancelable != this->progressCancelable)
+    {
+        this->progressDialog->setCancelButtonText(cancelable ? tr("Cancel") : QString());
+        this->progressCancelable = cancelable;
+    }
+
     // Setup dialog.
     this->progressDialog->setWindowTitle(title);
     this->progressDialog->setLabelText(text);
@@ -1670,8 +1775,7 @@ void MainWindow::onProjectChanged(QSharedPointer<Project> project)
     this->updateMenus();
 
     // Setup tree view.
-    this->recordTreeWidget->clear();
-    this->recordFieldTableWidget->setRowCount(0);
+    this->recordFieldTableWidget->setRecord(QVariant());
 
     this->refreshRecordTree();
 
@@ -1694,6 +1798,57 @@ void MainWindow::onProjectChanged(QSharedPointer<Project> project)
     }
 }
 
+void MainWindow::onProjectFilesChanged(const QStringList& filePaths)
+{
+    // Ask user whether they want to lose their unsaved changes.
+    if (!this->controller->getUndoController().isClean())
+    {
+        QMessageBox::StandardButton result = QMessageBox::question(this,
+                                                                   tr("Project Files Changed"),
+                                                                   tr("The following files have been changed outside of Tome:\r\n\r\n%1\r\n\r\nDo you want to reload them? Your unsaved changes to these files will be lost, and the undo history will be discarded.")
+                                                                   .arg(filePaths.join("\r\n")),
+                                                                   QMessageBox::Yes | QMessageBox::No,
+                                                                   QMessageBox::Yes);
+        if (result != QMessageBox::Yes)
+        {
+            return;
+        }
+    }
+
+    // Apply changes without resetting the record tree, keeping selection.
+    const QVariant selectedRecordId = this->recordTreeWidget->getSelectedRecordId();
+    const bool wasClean = this->controller->getUndoController().isClean();
+
+    if (!this->controller->getFileWatcherController().reloadChangedFiles())
+    {
+        this->on_actionReload_Project_triggered();
+        return;
+    }
+
+    // Discard undo history, as commands refer to records and values from before the reload.
+    // Keep unsaved changes to other files marked as such.
+    this->controller->getUndoController().clear();
+
+    if (!wasClean)
+    {
+        this->controller->getUndoController().resetClean();
+    }
+
+    if (this->recordTreeWidget->getSelectedRecordId() != selectedRecordId &&
+            this->controller->getRecordsController().hasRecord(selectedRecordId))
+    {
+        this->recordTreeWidget->selectRecord(selectedRecordId, false);
+    }
+
+    this->refreshRecordTable();
+
+    // Run integrity checks.
+    if (this->controller->getSettingsController().getRunIntegrityChecksOnLoad())
+    {
+        this->on_actionRun_Integrity_Checks_triggered();
+    }
+}
+
 void MainWindow::onRecordAdded(const QVariant& recordId, const QString& recordDisplayName, const QVariant& parentId)
 {
     // Update view.
@@ -1717,7 +1872,6 @@ void MainWindow::onRecordRemoved(const QVariant& recordId)
 void MainWindow::onRecordReparented(const QVariant& recordId, const QVariant& oldParentId, const QVariant& newParentId)
 {
     Q_UNUSED(oldParentId)
-    Q_UNUSED(newParentId)
 
     if (!this->refreshRecordTreeAfterReparent)
     {
@@ -1725,10 +1879,26 @@ void MainWindow::onRecordReparented(const QVariant& recordId, const QVariant& ol
     }
 
     // Update view.
-    this->refreshRecordTree();
+    this->recordTreeWidget->reparentRecord(recordId, newParentId);
     this->recordTreeWidget->selectRecord(recordId, true);
 }
 
+void MainWindow::onRecordsReparented(const QVariantList& recordIds)
+{
+    if (!this->refreshRecordTreeAfterReparent)
+    {
+        return;
+    }
+
+    // Update view.
+    this->recordTreeWidget->reparentRecords(recordIds);
+
+    if (recordIds.count() == 1)
+    {
+        this->recordTreeWidget->selectRecord(recordIds.first(), true);
+    }
+}
+
 void MainWindow::onRecordSetsChanged()
 {
     this->refreshRecordTree();
@@ -1797,7 +1967,8 @@ void MainWindow::refreshImportMenu()
 
 void MainWindow::refreshRecordTree()
 {
-    this->recordTreeWidget->setRecords(this->controller->getRecordsController().getRecords());
+    TOME_TRACE("View", "refreshRecordTree");
+    this->recordTreeWidget->refreshRecords();
 }
 
 void MainWindow::refreshRecordTable()
@@ -1807,7 +1978,7 @@ void MainWindow::refreshRecordTable()
     if (id.isNull() || !this->controller->getRecordsController().hasRecord(id))
     {
         // Clear table.
-        this->recordFieldTableWidget->setRowCount(0);
+        this->recordFieldTableWidget->setRecord(QVariant());
         return;
     }
 
@@ -18,6 +18,7 @@ class NewProjectWindow;
 class RecordWindow;
 class CustomTypesWindow;
 class DuplicateRecordWindow;
+class FindFieldValueWindow;
 class FindRecordWindow;
 class ProjectOverviewWindow;
 class UserSettingsWindow;
@@ -34,7 +35,6 @@ namespace Tome
     class Project;
     class RecordFieldsTableWidget;
     class RecordTreeWidget;
-    class RecordTreeWidgetItem;
     class SearchResultsDockWidget;
 }
 
@@ -83,6 +83,7 @@ class MainWindow : public QMainWindow
         void on_actionRemove_Record_triggered();
 
         void on_actionFindRecord_triggered();
+        void on_actionFindFieldValue_triggered();
         void on_actionFind_Usages_triggered();
 
         void on_actionRun_Integrity_Checks_triggered();
@@ -109,12 +110,16 @@ class MainWindow : public QMainWindow
         void onImportStarted();
         void onImportTemplatesChanged();
         void onFileLinkActivated(const QString& filePath);
+        void onFindRecordSearchPatternChanged(const QString& searchPattern);
+        void onProgressCanceled();
         void onProgressChanged(const QString title, const QString text, const int currentValue, const int maximumValue);
         void onProjectChanged(QSharedPointer<Tome::Project> project);
+        void onProjectFilesChanged(const QStringList& filePaths);
         void onRecordAdded(const QVariant& recordId, const QString& recordDisplayName, const QVariant& parentId);
         void onRecordFieldsChanged(const QVariant& recordId);
         void onRecordRemoved(const QVariant& recordId);
         void onRecordReparented(const QVariant& recordId, const QVariant& oldParentId, const QVariant& newParentId);
+        void onRecordsReparented(const QVariantList& recordIds);
         void onRecordSetsChanged();
         void onRecordUpdated(const QVariant& oldId,
                              const QString& oldDisplayName,
@@ -129,7 +134,7 @@ class MainWindow : public QMainWindow
         void searchResultChanged(const QString& title, const Tome::SearchResultList results);
         void tableWidgetDoubleClicked(const QModelIndex &index);
         void treeWidgetDoubleClicked(const QModelIndex &index);
-        void treeWidgetRecordReparented(const QVariant& recordId, const QVariant& newParentId);
+        void treeWidgetRecordsReparented(const QVariantList& recordIds, const QVariant& newParentId);
         void treeWidgetSelectionChanged(const QItemSelection& selected, const QItemSelection& deselected);
 
     private:
@@ -151,11 +156,13 @@ class MainWindow : public QMainWindow
         NewProjectWindow *newProjectWindow;
         RecordWindow* recordWindow;
         DuplicateRecordWindow* duplicateRecordWindow;
+        FindFieldValueWindow* findFieldValueWindow;
         FindRecordWindow* findRecordWindow;
         ProjectOverviewWindow* projectOverviewWindow;
         UserSettingsWindow* userSettingsWindow;
 
         QProgressDialog* progressDialog;
+        bool progressCancelable;
 
         QList<QDockWidget*> dockWidgets;
 
@@ -3,6 +3,7 @@
 #include <QXmlStreamWriter>
 
 #include "../Model/componentset.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../../IO/xmlreader.h"
 
 using namespace Tome;
@@ -18,6 +19,8 @@ ComponentSetSerializer::ComponentSetSerializer()
 
 void ComponentSetSerializer::serialize(QIODevice& device, const Tome::ComponentSet& componentSet) const
 {
+    TOME_TRACE("Serialization", "serializeComponentSet");
+
     // Open device stream.
     QXmlStreamWriter writer(&device);
     writer.setAutoFormatting(true);
@@ -44,6 +47,8 @@ void ComponentSetSerializer::serialize(QIODevice& device, const Tome::ComponentS
 
 void ComponentSetSerializer::deserialize(QIODevice& device, ComponentSet& componentSet) const
 {
+    TOME_TRACE("Serialization", "deserializeComponentSet");
+
     // Open device stream.
     XmlReader reader(&device);
 
@@ -1,20 +1,112 @@
 #include "filemessagehandler.h"
 
-#include <QTextStream>
+#include <QCoreApplication>
+#include <QMutexLocker>
+#include <QThread>
 
 using namespace Tome;
 
 
+namespace Tome
+{
+    /**
+     * @brief Writes all messages queued by the FileMessageHandler to the log file, until shut down.
+     */
+    class LogWriterThread : public QThread
+    {
+        protected:
+            void run() Q_DECL_OVERRIDE
+            {
+                FileMessageHandler::isWriterThread = true;
+
+                while (FileMessageHandler::running.load(std::memory_order_acquire))
+                {
+                    int count;
+
+                    {
+                        QMutexLocker locker(&FileMessageHandler::logFileMutex);
+                        count = FileMessageHandler::writeQueuedMessages();
+                    }
+
+                    if (count == 0)
+                    {
+                        // Nothing to write. Wait for more messages instead of spinning.
+                        QThread::msleep(IdleMilliseconds);
+                    }
+                }
+            }
+
+        private:
+            static const unsigned long IdleMilliseconds = 10;
+    };
+}
+
+
 const QString FileMessageHandler::logfileName = "output.log";
 
+// Must be a power of two, for mapping positions to buffer indices.
+const quint64 FileMessageHandler::bufferSize = 4096;
+
 bool FileMessageHandler::initialized = false;
 QFile FileMessageHandler::logFile(logfileName);
+// Recursive, for writing messages logged by the writer thread while writing.
+QMutex FileMessageHandler::logFileMutex(QMutex::Recursive);
+
+FileMessageHandler::LogEntry* FileMessageHandler::buffer = nullptr;
+std::atomic<quint64> FileMessageHandler::enqueuePosition(0);
+quint64 FileMessageHandler::dequeuePosition = 0;
+
+std::atomic<bool> FileMessageHandler::running(false);
+LogWriterThread* FileMessageHandler::writerThread = nullptr;
+thread_local bool FileMessageHandler::isWriterThread = false;
 
 
 bool FileMessageHandler::init()
 {
     initialized = logFile.open(QIODevice::ReadWrite | QIODevice::Truncate);
-    return initialized;
+
+    if (!initialized)
+    {
+        return false;
+    }
+
+    // Setup ring buffer. Each entry stores the position it can be written at next.
+    buffer = new LogEntry[bufferSize];
+
+    for (quint64 i = 0; i < bufferSize; ++i)
+    {
+        buffer[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    enqueuePosition.store(0, std::memory_order_relaxed);
+    dequeuePosition = 0;
+
+    // Start writing in background.
+    running.store(true, std::memory_order_release);
+    writerThread = new LogWriterThread();
+    writerThread->start(QThread::LowPriority);
+
+    // Make sure all messages are written on exit.
+    qAddPostRoutine(shutdown);
+
+    return true;
+}
+
+void FileMessageHandler::shutdown()
+{
+    if (!running.exchange(false))
+    {
+        return;
+    }
+
+    writerThread->wait();
+    delete writerThread;
+    writerThread = nullptr;
+
+    // Write all messages queued after the writer thread has finished.
+    QMutexLocker locker(&logFileMutex);
+    writeQueuedMessages();
+    logFile.flush();
 }
 
 void FileMessageHandler::handleMessage(QtMsgType type, const QMessageLogContext& context, const QString& msg)
@@ -24,8 +116,121 @@ void FileMessageHandler::handleMessage(QtMsgType type, const QMessageLogContext&
         return;
     }
 
+    // The application is about to abort. Write everything that happened before.
+    if (type == QtFatalMsg)
+    {
+        shutdown();
+    }
+
+    // The writer thread would wait for itself if the buffer is full.
+    while (!isWriterThread && running.load(std::memory_order_acquire))
+    {
+        if (enqueueMessage(type, context, msg))
+        {
+            // Shutdown might have written all queued messages before this one was published.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (!running.load(std::memory_order_acquire))
+            {
+                QMutexLocker locker(&logFileMutex);
+                writeQueuedMessages();
+                logFile.flush();
+            }
+
+            return;
+        }
+
+        // Buffer is full. Wait for the writer thread to catch up.
+        QThread::yieldCurrentThread();
+    }
+
+    // Not writing in background, write immediately, after any messages queued before.
+    QMutexLocker locker(&logFileMutex);
+
+    if (!isWriterThread)
+    {
+        writeQueuedMessages();
+    }
+
     QTextStream stream(&logFile);
+    writeMessage(stream, type, context.file, context.line, msg);
+    stream.flush();
+}
 
+bool FileMessageHandler::enqueueMessage(QtMsgType type, const QMessageLogContext& context, const QString& msg)
+{
+    quint64 position = enqueuePosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        LogEntry& entry = buffer[position & (bufferSize - 1)];
+        const quint64 sequence = entry.sequence.load(std::memory_order_acquire);
+        const qint64 difference = static_cast<qint64>(sequence) - static_cast<qint64>(position);
+
+        if (difference == 0)
+        {
+            // Entry is free. Try to claim it.
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                entry.type = type;
+                entry.file = context.file;
+                entry.line = context.line;
+                entry.message = msg;
+
+                // Publish entry to the writer thread.
+                entry.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Entry hasn't been written yet: Buffer is full.
+            return false;
+        }
+        else
+        {
+            // Another thread has claimed this entry first.
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+int FileMessageHandler::writeQueuedMessages()
+{
+    // Callers must hold logFileMutex, as queued messages may be written by several threads after shutdown.
+    QTextStream stream(&logFile);
+    int count = 0;
+
+    for (;;)
+    {
+        LogEntry& entry = buffer[dequeuePosition & (bufferSize - 1)];
+        const quint64 sequence = entry.sequence.load(std::memory_order_acquire);
+
+        if (sequence != dequeuePosition + 1)
+        {
+            // Entry hasn't been published yet.
+            break;
+        }
+
+        writeMessage(stream, entry.type, entry.file, entry.line, entry.message);
+        entry.message.clear();
+
+        // Free entry for the next round through the buffer.
+        entry.sequence.store(dequeuePosition + bufferSize, std::memory_order_release);
+        ++dequeuePosition;
+        ++count;
+    }
+
+    if (count > 0)
+    {
+        stream.flush();
+    }
+
+    return count;
+}
+
+void FileMessageHandler::writeMessage(QTextStream& stream, QtMsgType type, const char* file, int line, const QString& msg)
+{
     switch (type)
     {
         case QtDebugMsg:
@@ -45,5 +250,5 @@ void FileMessageHandler::handleMessage(QtMsgType type, const QMessageLogContext&
             break;
     }
 
-    stream << context.file << ":" << context.line << " - " << msg << endl;
+    stream << file << ":" << line << " - " << msg << "\n";
 }
@@ -1,25 +1,44 @@
 #ifndef FILEMESSAGEHANDLER_H
 #define FILEMESSAGEHANDLER_H
 
+#include <atomic>
+
 #include <QFile>
+#include <QMutex>
+#include <QString>
+#include <QTextStream>
 #include <QtMessageHandler>
 
 namespace Tome
 {
+    class LogWriterThread;
+
     /**
      * @brief Writes Qt messages (e.g. qInfo or qCritical) to a log file.
+     *
+     * Messages are queued in a lock-free ring buffer and written by a background thread, so logging never waits for
+     * file I/O unless the buffer is full. Fatal messages and shutdown flush all queued messages first.
      */
     class FileMessageHandler
     {
+        friend class LogWriterThread;
+
         public:
             /**
-             * @brief Opens and clears the log file for writing.
+             * @brief Opens and clears the log file for writing, and starts writing queued messages in the background.
              * @return true, if opening the log file was successful, and false otherwise.
              */
             static bool init();
 
             /**
-             * @brief Writes the passed message to the log file.
+             * @brief Writes all queued messages to the log file, and stops writing messages in the background.
+             *
+             * Messages handled afterwards are written immediately.
+             */
+            static void shutdown();
+
+            /**
+             * @brief Queues the passed message for writing it to the log file.
              * @param type Severity of the message to write.
              * @param context Source code file and line number of the message origin.
              * @param msg Message to write.
@@ -32,8 +51,32 @@ namespace Tome
             static const QString logfileName;
 
         private:
+            struct LogEntry
+            {
+                std::atomic<quint64> sequence;
+                QtMsgType type;
+                const char* file;
+                int line;
+                QString message;
+            };
+
+            static const quint64 bufferSize;
+
             static bool initialized;
             static QFile logFile;
+            static QMutex logFileMutex;
+
+            static LogEntry* buffer;
+            static std::atomic<quint64> enqueuePosition;
+            static quint64 dequeuePosition;
+
+            static std::atomic<bool> running;
+            static LogWriterThread* writerThread;
+            static thread_local bool isWriterThread;
+
+            static bool enqueueMessage(QtMsgType type, const QMessageLogContext &context, const QString &msg);
+            static int writeQueuedMessages();
+            static void writeMessage(QTextStream& stream, QtMsgType type, const char* file, int line, const QString &msg);
     };
 }
 
@@ -0,0 +1,8 @@
+#include "logcategories.h"
+
+namespace Tome
+{
+    // Messages of these categories are emitted once per record, so they're only formatted if explicitly enabled.
+    Q_LOGGING_CATEGORY(logRecords, "tome.records", QtWarningMsg)
+    Q_LOGGING_CATEGORY(logImport, "tome.import", QtWarningMsg)
+}
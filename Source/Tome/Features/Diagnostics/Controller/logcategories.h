@@ -0,0 +1,21 @@
+#ifndef LOGCATEGORIES_H
+#define LOGCATEGORIES_H
+
+#include <QLoggingCategory>
+
+namespace Tome
+{
+    /**
+     * @brief Messages about single records (e.g. adding, updating or removing them). Informational messages are disabled by default.
+     *
+     * Enable with the -log-rules command-line option or the QT_LOGGING_RULES environment variable, e.g. "tome.records.info=true".
+     */
+    Q_DECLARE_LOGGING_CATEGORY(logRecords)
+
+    /**
+     * @brief Messages about single imported records. Informational messages are disabled by default.
+     */
+    Q_DECLARE_LOGGING_CATEGORY(logImport)
+}
+
+#endif // LOGCATEGORIES_H
@@ -0,0 +1,120 @@
+#include "tracer.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QThread>
+
+using namespace Tome;
+
+
+const QString Tracer::defaultFileName = "trace.json";
+
+std::atomic<bool> Tracer::enabled(false);
+QElapsedTimer Tracer::clock;
+QMutex Tracer::mutex;
+QString Tracer::fileName;
+QVector<Tracer::TraceEvent> Tracer::events;
+QHash<Qt::HANDLE, int> Tracer::threadIds;
+
+
+void Tracer::start(const QString& fileName)
+{
+    QMutexLocker locker(&mutex);
+
+    Tracer::fileName = fileName;
+    events.clear();
+    threadIds.clear();
+    clock.start();
+
+    enabled.store(true, std::memory_order_relaxed);
+
+    qInfo(qUtf8Printable(QString("Recording performance trace to %1.").arg(fileName)));
+}
+
+bool Tracer::stop()
+{
+    if (!enabled.exchange(false))
+    {
+        return false;
+    }
+
+    QVector<TraceEvent> recordedEvents;
+
+    {
+        QMutexLocker locker(&mutex);
+        recordedEvents.swap(events);
+        threadIds.clear();
+    }
+
+    // Write Chrome trace event format, with complete events only.
+    const qint64 processId = QCoreApplication::applicationPid();
+    QJsonArray traceEvents;
+
+    for (const TraceEvent& event : recordedEvents)
+    {
+        QJsonObject traceEvent;
+        traceEvent["name"] = event.name;
+        traceEvent["cat"] = QString::fromLatin1(event.category);
+        traceEvent["ph"] = QString("X");
+        traceEvent["ts"] = event.start;
+        traceEvent["dur"] = event.duration;
+        traceEvent["pid"] = processId;
+        traceEvent["tid"] = event.threadId;
+        traceEvents.append(traceEvent);
+    }
+
+    QJsonObject trace;
+    trace["traceEvents"] = traceEvents;
+    trace["displayTimeUnit"] = QString("ms");
+
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qCritical(qUtf8Printable(QString("Performance trace could not be written: %1").arg(fileName)));
+        return false;
+    }
+
+    file.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+
+    qInfo(qUtf8Printable(QString("Performance trace with %1 events written to %2.")
+                         .arg(QString::number(recordedEvents.count()), fileName)));
+    return true;
+}
+
+qint64 Tracer::now()
+{
+    return clock.nsecsElapsed() / 1000;
+}
+
+void Tracer::addEvent(const char* category, const QString& name, qint64 startMicroseconds, qint64 durationMicroseconds)
+{
+    QMutexLocker locker(&mutex);
+
+    if (!enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // Number threads in order of appearance, for keeping the trace viewer readable.
+    const Qt::HANDLE threadHandle = QThread::currentThreadId();
+    int threadId = threadIds.value(threadHandle, -1);
+
+    if (threadId < 0)
+    {
+        threadId = threadIds.count() + 1;
+        threadIds.insert(threadHandle, threadId);
+    }
+
+    TraceEvent event;
+    event.category = category;
+    event.name = name;
+    event.start = startMicroseconds;
+    event.duration = durationMicroseconds;
+    event.threadId = threadId;
+    events.append(event);
+}
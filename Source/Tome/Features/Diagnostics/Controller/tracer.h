@@ -0,0 +1,150 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <atomic>
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+namespace Tome
+{
+    /**
+     * @brief Records how long operations take, and writes them as Chrome trace events (e.g. for chrome://tracing).
+     *
+     * Use the TOME_TRACE macro for timing a scope. Tracing can be disabled at compile time by defining TOME_NO_TRACING,
+     * and is disabled at runtime until started.
+     */
+    class Tracer
+    {
+        public:
+            /**
+             * @brief Name of the file to write the trace to, if not specified otherwise.
+             */
+            static const QString defaultFileName;
+
+            /**
+             * @brief Starts recording trace events, discarding all previous events.
+             * @param fileName Path to the file to write the trace to when stopping.
+             */
+            static void start(const QString& fileName);
+
+            /**
+             * @brief Stops recording trace events, and writes all recorded events to the trace file.
+             * @return true, if the trace file has been written, and false otherwise.
+             */
+            static bool stop();
+
+            /**
+             * @brief Checks whether trace events are being recorded.
+             * @return true, if trace events are being recorded, and false otherwise.
+             */
+            static inline bool isEnabled()
+            {
+                return enabled.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Gets the time since recording trace events has started.
+             * @return Time since recording trace events has started, in microseconds.
+             */
+            static qint64 now();
+
+            /**
+             * @brief Records an operation that has completed.
+             * @param category Category of the operation (e.g. "Export").
+             * @param name Name of the operation.
+             * @param startMicroseconds Time the operation has started at, as returned by now.
+             * @param durationMicroseconds Time the operation has taken.
+             */
+            static void addEvent(const char* category, const QString& name, qint64 startMicroseconds, qint64 durationMicroseconds);
+
+        private:
+            struct TraceEvent
+            {
+                const char* category;
+                QString name;
+                qint64 start;
+                qint64 duration;
+                int threadId;
+            };
+
+            static std::atomic<bool> enabled;
+            static QElapsedTimer clock;
+            static QMutex mutex;
+            static QString fileName;
+            static QVector<TraceEvent> events;
+            static QHash<Qt::HANDLE, int> threadIds;
+    };
+
+    /**
+     * @brief Records the time between its construction and destruction as trace event, if tracing is enabled.
+     */
+    class ScopedTrace
+    {
+        public:
+            /**
+             * @brief Starts timing an operation with a fixed name.
+             * @param category Category of the operation.
+             * @param name Name of the operation. Must outlive this object.
+             */
+            inline ScopedTrace(const char* category, const char* name)
+                : category(category),
+                  name(name),
+                  active(Tracer::isEnabled()),
+                  start(active ? Tracer::now() : 0)
+            {
+            }
+
+            /**
+             * @brief Starts timing an operation with a name that is known at runtime only (e.g. task or file name).
+             * @param category Category of the operation.
+             * @param name Name of the operation.
+             */
+            inline ScopedTrace(const char* category, const QString& name)
+                : category(category),
+                  name(nullptr),
+                  active(Tracer::isEnabled()),
+                  start(active ? Tracer::now() : 0)
+            {
+                if (this->active)
+                {
+                    this->dynamicName = name;
+                }
+            }
+
+            inline ~ScopedTrace()
+            {
+                if (this->active)
+                {
+                    Tracer::addEvent(this->category,
+                                     this->name != nullptr ? QString::fromLatin1(this->name) : this->dynamicName,
+                                     this->start,
+                                     Tracer::now() - this->start);
+                }
+            }
+
+        private:
+            const char* category;
+            const char* name;
+            QString dynamicName;
+            bool active;
+            qint64 start;
+    };
+}
+
+#ifdef TOME_NO_TRACING
+#define TOME_TRACE(category, name)
+#else
+#define TOME_TRACE_CONCAT_IMPL(a, b) a##b
+#define TOME_TRACE_CONCAT(a, b) TOME_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Records the time until the end of the current scope as trace event, if tracing is enabled.
+ */
+#define TOME_TRACE(category, name) Tome::ScopedTrace TOME_TRACE_CONCAT(tomeScopedTrace, __LINE__)(category, name)
+#endif
+
+#endif // TRACER_H
@@ -2,11 +2,17 @@
 
 #include <stdexcept>
 
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDateTime>
 #include <QFile>
+#include <QFileInfo>
+#include <QSet>
+#include <QSharedPointer>
 #include <QStringBuilder>
 #include <QTextStream>
 
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../Facets/Controller/facetscontroller.h"
 #include "../../Facets/Controller/localizedstringfacet.h"
 #include "../../Fields//Controller/fielddefinitionscontroller.h"
@@ -15,9 +21,13 @@
 #include "../../Types/Controller/typescontroller.h"
 #include "../../Types/Model/builtintype.h"
 #include "../../Types/Model/vector.h"
+#include "../../../Util/progressreporter.h"
+#include "../../../Util/stringreplacer.h"
 
 using namespace Tome;
 
+const QString ExportController::FingerprintFileExtension = ".fingerprint";
+
 const QString ExportController::PlaceholderAppVersion = "$APP_VERSION$";
 const QString ExportController::PlaceholderAppVersionName = "$APP_VERSION_NAME$";
 const QString ExportController::PlaceholderComponents = "$RECORD_COMPONENTS$";
@@ -122,513 +132,914 @@ void ExportController::exportRecords(const RecordExportTemplate& exportTemplate,
 
 void ExportController::exportRecords(const RecordExportTemplate& exportTemplate, QIODevice& device) const
 {
-    qInfo(qUtf8Printable(QString("Exporting records with template %1.").arg(exportTemplate.name)));
+    RecordExportTemplateList exportTemplates;
+    exportTemplates << exportTemplate;
+
+    QList<QIODevice*> devices;
+    devices << &device;
+
+    this->exportRecords(exportTemplates, devices);
+}
+
+void ExportController::exportRecords(const RecordExportTemplateList& exportTemplates, const QStringList& filePaths) const
+{
+    if (exportTemplates.count() != filePaths.count())
+    {
+        QString errorMessage = QObject::tr("Number of export templates doesn't match number of destination files.");
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::runtime_error(errorMessage.toStdString());
+    }
+
+    // Open all files before exporting anything.
+    QList<QSharedPointer<QFile>> files;
+    QList<QIODevice*> devices;
+
+    for (const QString& filePath : filePaths)
+    {
+        QSharedPointer<QFile> file = QSharedPointer<QFile>::create(filePath);
+
+        qInfo(qUtf8Printable(QString("Opening file %1 for record export.").arg(filePath)));
+
+        if (!file->open(QIODevice::ReadWrite | QIODevice::Truncate))
+        {
+            QString errorMessage = QObject::tr("Destination file could not be written:\r\n") + filePath;
+            qCritical(qUtf8Printable(errorMessage));
+            throw std::runtime_error(errorMessage.toStdString());
+        }
+
+        files << file;
+        devices << file.data();
+    }
+
+    this->exportRecords(exportTemplates, devices);
+}
 
-    // Build record file string.
-    QString recordsString;
+void ExportController::exportRecords(const RecordExportTemplateList& exportTemplates, const QList<QIODevice*>& devices) const
+{
+    TOME_TRACE("Export", "exportRecords");
+
+    for (const RecordExportTemplate& exportTemplate : exportTemplates)
+    {
+        qInfo(qUtf8Printable(QString("Exporting records with template %1.").arg(exportTemplate.name)));
+    }
 
     const RecordSetList& recordSets = this->recordsController.getRecordSets();
     const FieldDefinitionList& fields = this->fieldDefinitionsController.getFieldDefinitions();
 
-    for (int i = 0; i < recordSets.size(); ++i)
+    // Resolve field types once for all records and templates.
+    QHash<QString, ExportedField> exportedFields;
+    QStringList allComponents;
+
     {
-        const RecordSet& recordSet = recordSets[i];
+        TOME_TRACE("Export", "resolveFieldTypes");
 
-        for (int j = 0; j < recordSet.records.size(); ++j)
+        for (const FieldDefinition& field : fields)
         {
-            const Record& record = recordSet.records[j];
+            ExportedField exportedField;
+            exportedField.fieldDefinition = field;
 
-            // Report progress.
-            emit this->progressChanged(tr("Exporting Data"), record.displayName, j, recordSet.records.size());
+            const QString& fieldType = field.fieldType;
 
-            // Check if should export.
-            if (record.parentId.isNull())
+            if (this->typesController.isCustomType(fieldType))
             {
-                // Root node.
-                if (!exportTemplate.exportRoots)
+                const CustomType& customType = this->typesController.getCustomType(fieldType);
+
+                if (customType.isList())
                 {
-                    continue;
+                    exportedField.valueKind = ExportedField::List;
+                    exportedField.itemType = customType.getItemType();
+                }
+                else if (customType.isMap())
+                {
+                    exportedField.valueKind = ExportedField::Map;
+                    exportedField.keyType = customType.getKeyType();
+                    exportedField.valueType = customType.getValueType();
+                }
+                else if (customType.isDerivedType())
+                {
+                    exportedField.derivedType = true;
                 }
             }
-            else
+            else if (fieldType == BuiltInType::Vector2I || fieldType == BuiltInType::Vector2R ||
+                     fieldType == BuiltInType::Vector3I || fieldType == BuiltInType::Vector3R)
             {
-                if (this->recordsController.getChildren(record.id).empty())
+                exportedField.valueKind = ExportedField::Vector;
+                exportedField.integerVector = fieldType == BuiltInType::Vector2I || fieldType == BuiltInType::Vector3I;
+            }
+
+            QVariant localized = this->facetsController.getFacetValue(fieldType, LocalizedStringFacet::FacetKey);
+            exportedField.localized = localized.isValid() && localized.toBool();
+
+            // Tables fill up missing fields with empty values.
+            exportedField.emptyValueItems = this->getFieldValueItems(exportedField, QVariant(""));
+
+            exportedFields.insert(field.id, exportedField);
+        }
+    }
+
+    // Collect components of all fields, in the same order as they're collected for single records.
+    RecordFieldValueMap allFieldIds;
+
+    {
+        TOME_TRACE("Export", "collectComponents");
+
+        for (const FieldDefinition& field : fields)
+        {
+            allFieldIds.insert(field.id, QVariant());
+        }
+
+        for (RecordFieldValueMap::const_iterator itFields = allFieldIds.cbegin();
+             itFields != allFieldIds.cend();
+             ++itFields)
+        {
+            const QString& component = this->getExportedField(exportedFields, itFields.key()).fieldDefinition.component;
+
+            if (!component.isEmpty() && !allComponents.contains(component))
+            {
+                allComponents.append(component);
+            }
+        }
+    }
+
+    // Build record file strings, compiling string replacements once per template.
+    QStringList recordsStrings;
+    QList<StringReplacer> stringReplacers;
+
+    for (const RecordExportTemplate& exportTemplate : exportTemplates)
+    {
+        recordsStrings << QString();
+        stringReplacers << StringReplacer(exportTemplate.stringReplacementMap);
+    }
+
+    // Decide which records to export with which template up front.
+    ExportPlan plan;
+
+    {
+        TOME_TRACE("Export", "planExport");
+        plan = this->planExport(exportTemplates);
+    }
+
+    // Remember which parents aren't empty, because resolving their inherited values is expensive.
+    QHash<QString, bool> parentHasFieldValues;
+
+    // Report progress across all record sets.
+    const int recordCount = plan.recordOrdinals.count();
+
+    ProgressReporter progress(tr("Exporting Data"), recordCount, ProgressReporter::forSignal(this, &ExportController::progressChanged));
+
+    int recordIndex = 0;
+
+    {
+        TOME_TRACE("Export", "exportRecordData");
+
+        for (int i = 0; i < recordSets.size(); ++i)
+        {
+            const RecordSet& recordSet = recordSets[i];
+
+            for (int j = 0; j < recordSet.records.size(); ++j)
+            {
+                const Record& record = recordSet.records[j];
+
+                // Report progress.
+                const int ordinal = recordIndex++;
+                progress.update(ordinal, record.displayName);
+
+                // Skip records that aren't exported with any template.
+                bool exported = false;
+
+                for (const QBitArray& exportedRecords : plan.exportedRecords)
                 {
-                    // Leaf node.
-                    if (!exportTemplate.exportLeafs)
+                    if (exportedRecords.testBit(ordinal))
                     {
-                        continue;
+                        exported = true;
+                        break;
                     }
                 }
-                else
+
+                if (!exported)
+                {
+                    continue;
+                }
+
+                // Resolve record data once for all templates.
+                ExportedRecord exportedRecord;
+                exportedRecord.record = &record;
+                exportedRecord.recordRoot = plan.recordRoots[ordinal];
+
+                if (!record.parentId.isNull())
                 {
-                    // Inner node.
-                    if (!exportTemplate.exportInnerNodes)
+                    const QString parentId = record.parentId.toString();
+
+                    if (!parentHasFieldValues.contains(parentId))
                     {
-                        continue;
+                        parentHasFieldValues.insert(parentId, !this->recordsController.getRecordFieldValues(record.parentId).empty());
+                    }
+
+                    if (parentHasFieldValues[parentId])
+                    {
+                        // Only export record parent if that parent isn't empty.
+                        exportedRecord.recordParent = record.parentId;
                     }
                 }
-            }
 
-            // Check if whitelisted.
-            if (!exportTemplate.includedRecords.isEmpty())
-            {
-                bool whitelisted = exportTemplate.includedRecords.contains(record.id.toString());
+                exportedRecord.fieldValues = this->recordsController.getRecordFieldValues(record.id);
 
-                if (!whitelisted)
+                for (RecordFieldValueMap::const_iterator itFields = exportedRecord.fieldValues.cbegin();
+                     itFields != exportedRecord.fieldValues.cend();
+                     ++itFields)
                 {
-                    // Check if any ancestor whitelisted.
-                    RecordList ancestors = this->recordsController.getAncestors(record.id);
+                    const ExportedField& exportedField = this->getExportedField(exportedFields, itFields.key());
 
-                    for (int i = 0; i < ancestors.size(); ++i)
+                    if (exportedField.valueKind != ExportedField::Plain)
                     {
-                        if (exportTemplate.includedRecords.contains(ancestors[i].id.toString()))
-                        {
-                            whitelisted = true;
-                            break;
-                        }
+                        exportedRecord.fieldValueItems.insert(itFields.key(), this->getFieldValueItems(exportedField, itFields.value()));
+                    }
+
+                    const QString& component = exportedField.fieldDefinition.component;
+
+                    if (!component.isEmpty() && !exportedRecord.components.contains(component))
+                    {
+                        exportedRecord.components.append(component);
                     }
                 }
 
-                if (!whitelisted)
+                // Apply all templates.
+                for (int t = 0; t < exportTemplates.count(); ++t)
                 {
-                    continue;
+                    if (!plan.exportedRecords[t].testBit(ordinal))
+                    {
+                        continue;
+                    }
+
+                    const RecordExportTemplate& exportTemplate = exportTemplates[t];
+                    const QString recordString =
+                            this->exportRecord(exportTemplate, stringReplacers[t], exportedRecord, exportedFields, fields, allComponents);
+
+                    QString& recordsString = recordsStrings[t];
+
+                    if (!recordsString.isEmpty() && !recordString.isEmpty())
+                    {
+                        // Any previous record export succeeded (e.g. wasn't skipped). Add delimiter.
+                        recordsString.append(exportTemplate.recordDelimiter);
+                    }
+
+                    recordsString.append(recordString);
                 }
             }
+        }
+    }
 
-            // Check if ignored.
-            if (exportTemplate.ignoredRecords.contains(record.id.toString()))
-            {
-                continue;
-            }
+    // Apply record file templates.
+    const QString exportTime = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    QString hash;
+
+    for (int t = 0; t < exportTemplates.count() && t < devices.count(); ++t)
+    {
+        TOME_TRACE("Export", "applyRecordFileTemplate");
+
+        const RecordExportTemplate& exportTemplate = exportTemplates[t];
 
-            // Check if any ancestor ignored.
-            RecordList ancestors = this->recordsController.getAncestors(record.id);
-            bool anyAncestorIgnored = false;
+        QString recordFileString = exportTemplate.recordFileTemplate;
+        recordFileString = recordFileString.replace(PlaceholderRecords, recordsStrings[t]);
+        recordFileString = recordFileString.replace(PlaceholderAppVersion, APP_VERSION);
+        recordFileString = recordFileString.replace(PlaceholderAppVersionName, APP_VERSION_NAME);
+        recordFileString = recordFileString.replace(PlaceholderExportTime, exportTime);
 
-            for (int i = 0; i < ancestors.size(); ++i)
+        if (recordFileString.contains(PlaceholderHash))
+        {
+            if (hash.isEmpty())
             {
-                if (exportTemplate.ignoredRecords.contains(ancestors[i].id.toString()))
-                {
-                    anyAncestorIgnored = true;
-                    break;
-                }
+                hash = this->recordsController.computeRecordsHash();
             }
 
-            if (anyAncestorIgnored)
+            recordFileString = recordFileString.replace(PlaceholderHash, hash);
+        }
+
+        // Write record file.
+        TOME_TRACE("Export", "writeRecordFile");
+        QTextStream textStream(devices[t]);
+        textStream.setCodec("UTF-8");
+        textStream << recordFileString;
+    }
+
+    // Report finish.
+    progress.finish();
+}
+
+int ExportController::exportChangedRecords(const RecordExportTemplateList& exportTemplates, const QStringList& filePaths) const
+{
+    if (exportTemplates.count() != filePaths.count())
+    {
+        QString errorMessage = QObject::tr("Number of export templates doesn't match number of destination files.");
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::runtime_error(errorMessage.toStdString());
+    }
+
+    const QString recordsHash = this->recordsController.computeRecordsHash();
+
+    // Find outdated files.
+    RecordExportTemplateList changedExportTemplates;
+    QStringList changedFilePaths;
+    QStringList changedFingerprints;
+
+    for (int i = 0; i < exportTemplates.count(); ++i)
+    {
+        const RecordExportTemplate& exportTemplate = exportTemplates[i];
+        const QString& filePath = filePaths[i];
+        const QString fingerprint = this->computeExportFingerprint(exportTemplate, recordsHash);
+
+        if (QFileInfo(filePath).exists())
+        {
+            QFile fingerprintFile(filePath + FingerprintFileExtension);
+
+            if (fingerprintFile.open(QIODevice::ReadOnly) &&
+                    QString::fromUtf8(fingerprintFile.readAll()).trimmed() == fingerprint)
             {
+                qInfo(qUtf8Printable(QString("Skipping export with template %1, %2 is up-to-date.")
+                                     .arg(exportTemplate.name, filePath)));
                 continue;
             }
+        }
 
-            // Build field values string.
-            QString fieldValuesString;
+        changedExportTemplates << exportTemplate;
+        changedFilePaths << filePath;
+        changedFingerprints << fingerprint;
+    }
 
-            // Get fields to export.
-            RecordFieldValueMap fieldValues = recordsController.getRecordFieldValues(record.id);
+    if (changedExportTemplates.empty())
+    {
+        return 0;
+    }
 
-            if (exportTemplate.exportAsTable)
-            {
-                // Build field table, filling up with empty values.
-                for (int k = 0; k < fields.count(); ++k)
-                {
-                    const FieldDefinition& field = fields[k];
+    // Export records.
+    this->exportRecords(changedExportTemplates, changedFilePaths);
 
-                    if (!fieldValues.contains(field.id))
-                    {
-                        fieldValues[field.id] = "";
-                    }
-                }
-            }
+    // Store fingerprints.
+    for (int i = 0; i < changedFilePaths.count(); ++i)
+    {
+        QFile fingerprintFile(changedFilePaths[i] + FingerprintFileExtension);
+
+        if (fingerprintFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            fingerprintFile.write(changedFingerprints[i].toUtf8());
+        }
+        else
+        {
+            // Not fatal, the file will just be exported again next time.
+            qWarning(qUtf8Printable(QString("Export fingerprint could not be written: %1").arg(fingerprintFile.fileName())));
+        }
+    }
+
+    return changedFilePaths.count();
+}
+
+int ExportController::exportChangedRecords(const QStringList& exportTemplateNames, const QString& exportPath) const
+{
+    RecordExportTemplateList exportTemplates;
+    QStringList filePaths;
+
+    for (const QString& exportTemplateName : exportTemplateNames)
+    {
+        // Get export template.
+        const RecordExportTemplate exportTemplate = this->getRecordExportTemplate(exportTemplateName);
+
+        // Build export file path.
+        const QString filePath = exportPath + exportTemplate.fileExtension;
+
+        if (filePaths.contains(filePath))
+        {
+            QString errorMessage = QObject::tr("Export templates would overwrite each other: %1").arg(filePath);
+            qCritical(qUtf8Printable(errorMessage));
+            throw std::runtime_error(errorMessage.toStdString());
+        }
+
+        exportTemplates << exportTemplate;
+        filePaths << filePath;
+    }
+
+    return this->exportChangedRecords(exportTemplates, filePaths);
+}
 
-            // Do not export empty records.
-            if (fieldValues.empty())
+bool ExportController::removeExportTemplate(const QString& name)
+{
+    qInfo(qUtf8Printable(QString("Removing export template %1.").arg(name)));
+
+    // Update model.
+    for (RecordExportTemplateList::iterator it = this->model->begin();
+         it != this->model->end();
+         ++it)
+    {
+        if (it->name == name)
+        {
+            this->model->erase(it);
+
+            // Notify listeners.
+            emit this->exportTemplatesChanged();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ExportController::setRecordExportTemplates(RecordExportTemplateList& exportTemplates)
+{
+    this->model = &exportTemplates;
+}
+
+const QString ExportController::computeExportFingerprint(const RecordExportTemplate& exportTemplate, const QString& recordsHash) const
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+
+    // Application version.
+    stream << QString(APP_VERSION) << QString(APP_VERSION_NAME);
+
+    // Record data.
+    stream << recordsHash;
+
+    // Field definitions and types, which affect exported names, types and templates.
+    const FieldDefinitionList& fields = this->fieldDefinitionsController.getFieldDefinitions();
+
+    for (const FieldDefinition& field : fields)
+    {
+        stream << field.id << field.displayName << field.description << field.component << field.fieldType;
+    }
+
+    const CustomTypeList customTypes = this->typesController.getCustomTypes();
+
+    for (const CustomType& customType : customTypes)
+    {
+        stream << customType.name << customType.fundamentalFacets << customType.constrainingFacets;
+    }
+
+    // Export template.
+    stream << exportTemplate.name
+           << exportTemplate.componentDelimiter
+           << exportTemplate.componentTemplate
+           << exportTemplate.exportAsTable
+           << exportTemplate.exportRoots
+           << exportTemplate.exportInnerNodes
+           << exportTemplate.exportLeafs
+           << exportTemplate.exportLocalizedFieldsOnly
+           << exportTemplate.fieldValueDelimiter
+           << exportTemplate.fieldValueTemplate
+           << exportTemplate.fileExtension
+           << exportTemplate.listTemplate
+           << exportTemplate.listItemTemplate
+           << exportTemplate.listItemDelimiter
+           << exportTemplate.localizedFieldValueTemplate
+           << exportTemplate.mapTemplate
+           << exportTemplate.mapItemTemplate
+           << exportTemplate.mapItemDelimiter
+           << exportTemplate.recordDelimiter
+           << exportTemplate.recordFileTemplate
+           << exportTemplate.recordTemplate
+           << exportTemplate.stringReplacementMap
+           << exportTemplate.typeMap
+           << exportTemplate.includedRecords
+           << exportTemplate.ignoredRecords
+           << exportTemplate.ignoredFields;
+
+    return QString::fromLatin1(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
+}
+
+const QString ExportController::exportRecord(const RecordExportTemplate& exportTemplate,
+                                             const StringReplacer& stringReplacer,
+                                             const ExportedRecord& exportedRecord,
+                                             const QHash<QString, ExportedField>& exportedFields,
+                                             const FieldDefinitionList& fields,
+                                             const QStringList& allComponents) const
+{
+    const Record& record = *exportedRecord.record;
+
+    // Get fields to export.
+    RecordFieldValueMap fieldValues = exportedRecord.fieldValues;
+
+    if (exportTemplate.exportAsTable)
+    {
+        // Build field table, filling up with empty values.
+        for (int k = 0; k < fields.count(); ++k)
+        {
+            const FieldDefinition& field = fields[k];
+
+            if (!fieldValues.contains(field.id))
             {
-                continue;
+                fieldValues[field.id] = "";
             }
+        }
+    }
 
-            // Get record data.
-            QVariant recordRoot = this->recordsController.getRootRecordId(record.id);
-            QVariant recordParent;
+    // Do not export empty records.
+    if (fieldValues.empty())
+    {
+        return QString();
+    }
 
-            if (!record.parentId.isNull())
-            {
-                RecordFieldValueMap parentFieldValues = recordsController.getRecordFieldValues(record.parentId);
+    // Build field value text representations.
+    QMap<QString, QString> fieldValueTexts;
 
-                if (!parentFieldValues.empty())
-                {
-                    // Only export record parent if that parent isn't empty.
-                    recordParent = record.parentId;
-                }
-            }
+    for (RecordFieldValueMap::const_iterator itFields = fieldValues.cbegin();
+         itFields != fieldValues.cend();
+         ++itFields)
+    {
+        const QString& fieldId = itFields.key();
+        const ExportedField& exportedField = this->getExportedField(exportedFields, fieldId);
 
-            // Build field value text representations.
-            QMap<QString, QString> fieldValueTexts;
+        const QStringList fieldValueItems = exportedRecord.fieldValues.contains(fieldId)
+                ? exportedRecord.fieldValueItems.value(fieldId)
+                : exportedField.emptyValueItems;
 
-            for (RecordFieldValueMap::iterator itFields = fieldValues.begin();
-                 itFields != fieldValues.end();
-                 ++itFields)
-            {
-                QString fieldId = itFields.key();
-                QVariant fieldValue = itFields.value();
-                QString fieldValueText = fieldValue.toString();
+        fieldValueTexts[fieldId] = this->getFieldValueText(exportTemplate, stringReplacer, exportedField, itFields.value(), fieldValueItems);
+    }
 
-                const FieldDefinition& fieldDefinition = this->fieldDefinitionsController.getFieldDefinition(fieldId);
+    // Apply record template.
+    QString recordString = exportTemplate.recordTemplate;
 
-                // Get field type name.
-                QString fieldType = fieldDefinition.fieldType;
+    // Use regular expressions to match specific fields.
+    QRegExp regEx("\\$FIELD_VALUE:([a-zA-Z]*)\\$");
+    QStringList matchedSpecificFields;
 
-                // Check if list.
-                if (this->typesController.isCustomType(fieldType))
-                {
-                    const CustomType& customType = this->typesController.getCustomType(fieldType);
+    int pos = 0;
+    while ((pos = regEx.indexIn(recordString, pos)) != -1)
+    {
+        QString fieldId = regEx.cap(1);
+        QString fieldValue = fieldValueTexts[fieldId];
 
-                    if (customType.isList())
-                    {
-                        QString itemType = customType.getItemType();
-                        QString exportedItemType = exportTemplate.typeMap.value(itemType, itemType);
-                        // Build list string.
-                        fieldValueText = QString();
-
-                        QVariantList list = fieldValue.toList();
-
-                        for (int i = 0; i < list.size(); ++i)
-                        {
-                            QString listItem = exportTemplate.listItemTemplate;
-                            listItem = listItem.replace(PlaceholderFieldId, fieldId);
-                            listItem = listItem.replace(PlaceholderItemType, exportedItemType);
-                            listItem = listItem.replace(PlaceholderListItem, list[i].toString());
-                            fieldValueText.append(listItem);
-
-                            if (i < list.size() - 1)
-                            {
-                                fieldValueText.append(exportTemplate.listItemDelimiter);
-                            }
-                        }
-                    }
-                    else if (customType.isMap())
-                    {
-                        // Build map string.
-                        fieldValueText = QString();
-
-                        const QVariantMap map = fieldValue.toMap();
-
-                        for (QVariantMap::const_iterator it = map.cbegin();
-                             it != map.cend();
-                             ++it)
-                        {
-                            QString mapItem = exportTemplate.mapItemTemplate;
-                            mapItem = mapItem.replace(PlaceholderFieldId, fieldId);
-                            mapItem = mapItem.replace(PlaceholderFieldKey, it.key());
-                            mapItem = mapItem.replace(PlaceholderFieldValue, QVariant(it.value()).toString());
-                            fieldValueText.append(mapItem);
-
-                            if (it + 1 != map.end())
-                            {
-                                fieldValueText.append(exportTemplate.mapItemDelimiter);
-                            }
-                        }
-                    }
-                }
-                // Check if vector.
-                else if (fieldType == BuiltInType::Vector2I || fieldType == BuiltInType::Vector2R ||
-                         fieldType == BuiltInType::Vector3I || fieldType == BuiltInType::Vector3R)
-                {
-                    // Build vector string.
-                    fieldValueText = QString();
+        recordString.replace(pos, regEx.matchedLength(), fieldValue);
+        pos += fieldValue.length();
 
-                    QVariantMap vector = fieldValue.toMap();
+        // Remember this field has already been matched, so it can be omitted later.
+        matchedSpecificFields << fieldId;
+    }
 
-                    QVariant x = vector[BuiltInType::Vector::X];
-                    QVariant y = vector[BuiltInType::Vector::Y];
+    // Build full field values string.
+    QString fieldValuesString;
 
-                    // X.
-                    QString vectorComponent = exportTemplate.mapItemTemplate;
-                    vectorComponent = vectorComponent.replace(PlaceholderFieldId, fieldId);
-                    vectorComponent = vectorComponent.replace(PlaceholderFieldKey, "X");
-                    vectorComponent = vectorComponent.replace(PlaceholderFieldValue, x.toString());
-                    fieldValueText.append(vectorComponent);
-                    fieldValueText.append(exportTemplate.mapItemDelimiter);
+    for (RecordFieldValueMap::const_iterator itFields = fieldValues.cbegin();
+         itFields != fieldValues.cend();
+         ++itFields)
+    {
+        // Get field data.
+        const QString fieldId = itFields.key();
+        const ExportedField& exportedField = this->getExportedField(exportedFields, fieldId);
+        const FieldDefinition& fieldDefinition = exportedField.fieldDefinition;
 
-                    // Y.
-                    vectorComponent = exportTemplate.mapItemTemplate;
-                    vectorComponent = vectorComponent.replace(PlaceholderFieldId, fieldId);
-                    vectorComponent = vectorComponent.replace(PlaceholderFieldKey, "Y");
-                    vectorComponent = vectorComponent.replace(PlaceholderFieldValue, y.toString());
-                    fieldValueText.append(vectorComponent);
+        const QString fieldType = fieldDefinition.fieldType;
+        const QString fieldComponent = fieldDefinition.component;
+        const QString fieldDescription = fieldDefinition.description;
+        const QString fieldDisplayName = fieldDefinition.displayName;
 
-                    if (fieldType == BuiltInType::Vector3I || fieldType == BuiltInType::Vector3R)
-                    {
-                        QVariant z = vector[BuiltInType::Vector::Z];
+        if (matchedSpecificFields.contains(fieldId))
+        {
+            // Field has already explicitly been matched by a regular expression before. Skip.
+            continue;
+        }
 
-                        // Z.
-                        fieldValueText.append(exportTemplate.mapItemDelimiter);
+        if (exportTemplate.ignoredFields.contains(fieldId))
+        {
+            // Field ignored by template.
+            continue;
+        }
 
-                        vectorComponent = exportTemplate.mapItemTemplate;
-                        vectorComponent = vectorComponent.replace(PlaceholderFieldId, fieldId);
-                        vectorComponent = vectorComponent.replace(PlaceholderFieldKey, "Z");
-                        vectorComponent = vectorComponent.replace(PlaceholderFieldValue, z.toString());
-                        fieldValueText.append(vectorComponent);
-                    }
-                }
+        if (exportTemplate.exportLocalizedFieldsOnly && !exportedField.localized)
+        {
+            // We only want to export localized fields, but this one is not.
+            continue;
+        }
 
-                // Apply string replacement.
-                for (auto itStringReplacementMap = exportTemplate.stringReplacementMap.cbegin();
-                     itStringReplacementMap != exportTemplate.stringReplacementMap.cend();
-                     ++itStringReplacementMap)
-                {
-                    fieldValueText = fieldValueText.replace(itStringReplacementMap.key(), itStringReplacementMap.value());
-                }
+        const QString fieldValueText = fieldValueTexts[fieldId];
+        const QString exportedFieldType = exportTemplate.typeMap.value(fieldType, fieldType);
 
-                // Store for later use.
-                fieldValueTexts[fieldId] = fieldValueText;
-            }
+        // Apply field value template.
+        QString fieldValueString = exportTemplate.fieldValueTemplate;
+
+        switch (exportedField.valueKind)
+        {
+            case ExportedField::List:
+            {
+                // Use list template.
+                fieldValueString = exportTemplate.listTemplate;
 
-            // Apply record template.
-            QString recordString = exportTemplate.recordTemplate;
+                QString exportedItemType = exportTemplate.typeMap.value(exportedField.itemType, exportedField.itemType);
 
-            // Use regular expressions to match specific fields.
-            QRegExp regEx("\\$FIELD_VALUE:([a-zA-Z]*)\\$");
-            QStringList matchedSpecificFields;
+                fieldValueString = fieldValueString.replace(PlaceholderItemType, exportedItemType);
+                break;
+            }
 
-            int pos = 0;
-            while ((pos = regEx.indexIn(recordString, pos)) != -1)
+            case ExportedField::Map:
             {
-                QString fieldId = regEx.cap(1);
-                QString fieldValue = fieldValueTexts[fieldId];
+                // Use map template.
+                fieldValueString = exportTemplate.mapTemplate;
 
-                recordString.replace(pos, regEx.matchedLength(), fieldValue);
-                pos += fieldValue.length();
+                QString exportedKeyType = exportTemplate.typeMap.value(exportedField.keyType, exportedField.keyType);
+                QString exportedValueType = exportTemplate.typeMap.value(exportedField.valueType, exportedField.valueType);
 
-                // Remember this field has already been matched, so it can be omitted later.
-                matchedSpecificFields << fieldId;
+                fieldValueString = fieldValueString.replace(PlaceholderKeyType, exportedKeyType);
+                fieldValueString = fieldValueString.replace(PlaceholderValueType, exportedValueType);
+                break;
             }
 
-            // Build full field values string.
-            for (RecordFieldValueMap::iterator itFields = fieldValues.begin();
-                 itFields != fieldValues.end();
-                 ++itFields)
+            case ExportedField::Vector:
             {
-                // Get field data.
-                const QString fieldId = itFields.key();
-                const FieldDefinition& fieldDefinition = this->fieldDefinitionsController.getFieldDefinition(fieldId);
+                // Use vector template.
+                fieldValueString = exportTemplate.mapTemplate;
 
-                const QString fieldType = fieldDefinition.fieldType;
-                const QString fieldComponent = fieldDefinition.component;
-                const QString fieldDescription = fieldDefinition.description;
-                const QString fieldDisplayName = fieldDefinition.displayName;
+                QString exportedKeyType = exportTemplate.typeMap.value("String", "String");
+                QString exportedValueType = exportedField.integerVector
+                        ? exportTemplate.typeMap.value("Integer", "Integer")
+                        : exportTemplate.typeMap.value("Real", "Real");
 
-                if (matchedSpecificFields.contains(fieldId))
-                {
-                    // Field has already explicitly been matched by a regular expression before. Skip.
-                    continue;
-                }
+                fieldValueString = fieldValueString.replace(PlaceholderKeyType, exportedKeyType);
+                fieldValueString = fieldValueString.replace(PlaceholderValueType, exportedValueType);
+                break;
+            }
 
-                if (exportTemplate.ignoredFields.contains(fieldId))
+            case ExportedField::Plain:
+                if (exportedField.derivedType && exportedField.localized)
                 {
-                    // Field ignored by template.
-                    continue;
+                    // Use localized template.
+                    fieldValueString = exportTemplate.localizedFieldValueTemplate;
                 }
+                break;
+        }
 
-                if (exportTemplate.exportLocalizedFieldsOnly)
-                {
-                    QVariant localized = this->facetsController.getFacetValue(fieldType, LocalizedStringFacet::FacetKey);
-                    if (!localized.isValid() || !localized.toBool())
-                    {
-                        // We only want to export localized fields, but this one is not.
-                        continue;
-                    }
-                }
+        fieldValueString = fieldValueString.replace(PlaceholderFieldId, fieldId);
+        fieldValueString = fieldValueString.replace(PlaceholderFieldType, exportedFieldType);
+        fieldValueString = fieldValueString.replace(PlaceholderFieldValue, fieldValueText);
+        fieldValueString = fieldValueString.replace(PlaceholderFieldComponent, fieldComponent);
+        fieldValueString = fieldValueString.replace(PlaceholderFieldDisplayName, fieldDisplayName);
+        fieldValueString = fieldValueString.replace(PlaceholderFieldDescription, fieldDescription);
+        fieldValueString = fieldValueString.replace(PlaceholderRecordId, record.id.toString());
+        fieldValueString = fieldValueString.replace(PlaceholderRecordParentId, exportedRecord.recordParent.toString());
+        fieldValueString = fieldValueString.replace(PlaceholderRecordRootId, exportedRecord.recordRoot.toString());
+        fieldValueString = fieldValueString.replace(PlaceholderRecordDisplayName, record.displayName);
+
+        // Add delimiter, if necessary.
+        if (!fieldValuesString.isEmpty() && !fieldValueString.isEmpty())
+        {
+            // Any previous field export succeeded (e.g. wasn't skipped). Add delimiter.
+            fieldValuesString.append(exportTemplate.fieldValueDelimiter);
+        }
 
-                const QString fieldValueText = fieldValueTexts[fieldId];
-                const QString exportedFieldType = exportTemplate.typeMap.value(fieldType, fieldType);
+        fieldValuesString.append(fieldValueString);
+    }
 
-                // Apply field value template.
-                QString fieldValueString = exportTemplate.fieldValueTemplate;
+    // Build components string.
+    const QStringList& components = exportTemplate.exportAsTable ? allComponents : exportedRecord.components;
+    QString componentsString;
 
-                // Check if custom type.
-                if (this->typesController.isCustomType(fieldType))
-                {
-                    const CustomType& customType = this->typesController.getCustomType(fieldType);
+    for (QStringList::const_iterator itComponents = components.cbegin();
+         itComponents != components.cend();
+         ++itComponents)
+    {
+        const QString& component = *itComponents;
 
-                    if (customType.isList())
-                    {
-                        // Use list template.
-                        fieldValueString = exportTemplate.listTemplate;
+        // Apply component template.
+        QString componentString = exportTemplate.componentTemplate;
+        componentString = componentString.replace(PlaceholderComponentName, component);
 
-                        QString itemType = customType.getItemType();
-                        QString exportedItemType = exportTemplate.typeMap.value(itemType, itemType);
+        componentsString.append(componentString);
 
-                        fieldValueString = fieldValueString.replace(PlaceholderItemType, exportedItemType);
-                    }
-                    else if (customType.isMap())
-                    {
-                        // Use map template.
-                        fieldValueString = exportTemplate.mapTemplate;
+        // Add delimiter, if necessary.
+        if (itComponents != components.cend() - 1)
+        {
+            componentsString.append(exportTemplate.componentDelimiter);
+        }
+    }
 
-                        QString keyType = customType.getKeyType();
-                        QString valueType = customType.getValueType();
+    // Replace other record placeholders.
+    recordString = recordString.replace(PlaceholderRecordId, record.id.toString());
+    recordString = recordString.replace(PlaceholderRecordParentId, exportedRecord.recordParent.toString());
+    recordString = recordString.replace(PlaceholderRecordRootId, exportedRecord.recordRoot.toString());
+    recordString = recordString.replace(PlaceholderRecordFields, fieldValuesString);
+    recordString = recordString.replace(PlaceholderComponents, componentsString);
+    recordString = recordString.replace(PlaceholderRecordDisplayName, record.displayName);
 
-                        QString exportedKeyType = exportTemplate.typeMap.value(keyType, keyType);
-                        QString exportedValueType = exportTemplate.typeMap.value(valueType, valueType);
+    return recordString;
+}
 
-                        fieldValueString = fieldValueString.replace(PlaceholderKeyType, exportedKeyType);
-                        fieldValueString = fieldValueString.replace(PlaceholderValueType, exportedValueType);
-                    }
-                    else if (customType.isDerivedType())
-                    {
-                        QVariant localized = this->facetsController.getFacetValue(fieldType, LocalizedStringFacet::FacetKey);
-                        if (localized.isValid() && localized.toBool())
-                        {
-                            // Use localized template.
-                            fieldValueString = exportTemplate.localizedFieldValueTemplate;
-                        }
-                    }
-                }
-                // Check if vector.
-                else if (fieldType == BuiltInType::Vector2I || fieldType == BuiltInType::Vector2R ||
-                         fieldType == BuiltInType::Vector3I || fieldType == BuiltInType::Vector3R)
-                {
-                    // Use vector template.
-                    fieldValueString = exportTemplate.mapTemplate;
+const ExportController::ExportedField& ExportController::getExportedField(const QHash<QString, ExportedField>& exportedFields,
+                                                                         const QString& fieldId) const
+{
+    QHash<QString, ExportedField>::const_iterator it = exportedFields.constFind(fieldId);
 
-                    QString exportedKeyType = exportTemplate.typeMap.value("String", "String");
-                    QString exportedValueType;
+    if (it == exportedFields.cend())
+    {
+        const QString errorMessage = QObject::tr("Field not found: ") + fieldId;
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::out_of_range(errorMessage.toStdString());
+    }
 
-                    if (fieldType == BuiltInType::Vector2I || fieldType == BuiltInType::Vector3I)
-                    {
-                        exportedValueType = exportTemplate.typeMap.value("Integer", "Integer");
-                    }
-                    else
-                    {
-                        exportedValueType = exportTemplate.typeMap.value("Real", "Real");
-                    }
+    return *it;
+}
 
-                    fieldValueString = fieldValueString.replace(PlaceholderKeyType, exportedKeyType);
-                    fieldValueString = fieldValueString.replace(PlaceholderValueType, exportedValueType);
-                }
+const QString ExportController::getFieldValueText(const RecordExportTemplate& exportTemplate,
+                                                  const StringReplacer& stringReplacer,
+                                                  const ExportedField& exportedField,
+                                                  const QVariant& fieldValue,
+                                                  const QStringList& fieldValueItems) const
+{
+    const QString& fieldId = exportedField.fieldDefinition.id;
+    QString fieldValueText;
 
-                fieldValueString = fieldValueString.replace(PlaceholderFieldId, fieldId);
-                fieldValueString = fieldValueString.replace(PlaceholderFieldType, exportedFieldType);
-                fieldValueString = fieldValueString.replace(PlaceholderFieldValue, fieldValueText);
-                fieldValueString = fieldValueString.replace(PlaceholderFieldComponent, fieldComponent);
-                fieldValueString = fieldValueString.replace(PlaceholderFieldDisplayName, fieldDisplayName);
-                fieldValueString = fieldValueString.replace(PlaceholderFieldDescription, fieldDescription);
-                fieldValueString = fieldValueString.replace(PlaceholderRecordId, record.id.toString());
-                fieldValueString = fieldValueString.replace(PlaceholderRecordParentId, recordParent.toString());
-                fieldValueString = fieldValueString.replace(PlaceholderRecordRootId, recordRoot.toString());
-                fieldValueString = fieldValueString.replace(PlaceholderRecordDisplayName, record.displayName);
-
-                // Add delimiter, if necessary.
-                if (!fieldValuesString.isEmpty() && !fieldValueString.isEmpty())
+    switch (exportedField.valueKind)
+    {
+        case ExportedField::List:
+        {
+            // Build list string.
+            QString exportedItemType = exportTemplate.typeMap.value(exportedField.itemType, exportedField.itemType);
+
+            for (int i = 0; i < fieldValueItems.size(); ++i)
+            {
+                QString listItem = exportTemplate.listItemTemplate;
+                listItem = listItem.replace(PlaceholderFieldId, fieldId);
+                listItem = listItem.replace(PlaceholderItemType, exportedItemType);
+                listItem = listItem.replace(PlaceholderListItem, fieldValueItems[i]);
+                fieldValueText.append(listItem);
+
+                if (i < fieldValueItems.size() - 1)
                 {
-                    // Any previous field export succeeded (e.g. wasn't skipped). Add delimiter.
-                    fieldValuesString.append(exportTemplate.fieldValueDelimiter);
+                    fieldValueText.append(exportTemplate.listItemDelimiter);
                 }
-
-                fieldValuesString.append(fieldValueString);
             }
+            break;
+        }
 
-            // Collect components.
-            QStringList components;
-
-            for (QMap<QString, QVariant>::const_iterator itFields = fieldValues.cbegin();
-                 itFields != fieldValues.cend();
-                 ++itFields)
+        case ExportedField::Map:
+        case ExportedField::Vector:
+        {
+            // Build map string. Items are stored as alternating keys and values.
+            for (int i = 0; i + 1 < fieldValueItems.size(); i += 2)
             {
-                QString fieldId = itFields.key();
-                const FieldDefinition& fieldDefinition = this->fieldDefinitionsController.getFieldDefinition(fieldId);
+                QString mapItem = exportTemplate.mapItemTemplate;
+                mapItem = mapItem.replace(PlaceholderFieldId, fieldId);
+                mapItem = mapItem.replace(PlaceholderFieldKey, fieldValueItems[i]);
+                mapItem = mapItem.replace(PlaceholderFieldValue, fieldValueItems[i + 1]);
+                fieldValueText.append(mapItem);
 
-                if (!fieldDefinition.component.isEmpty() && !components.contains(fieldDefinition.component))
+                if (i + 2 < fieldValueItems.size())
                 {
-                    components.append(fieldDefinition.component);
+                    fieldValueText.append(exportTemplate.mapItemDelimiter);
                 }
             }
+            break;
+        }
 
-            // Build components string.
-            QString componentsString;
+        case ExportedField::Plain:
+            fieldValueText = fieldValue.toString();
+            break;
+    }
 
-            for (QStringList::iterator itComponents = components.begin();
-                 itComponents != components.end();
-                 ++itComponents)
-            {
-                QString& component = *itComponents;
+    // Apply string replacement.
+    return stringReplacer.replace(fieldValueText);
+}
 
-                // Apply component template.
-                QString componentString = exportTemplate.componentTemplate;
-                componentString = componentString.replace(PlaceholderComponentName, component);
+const QStringList ExportController::getFieldValueItems(const ExportedField& exportedField, const QVariant& fieldValue) const
+{
+    QStringList fieldValueItems;
 
-                componentsString.append(componentString);
+    switch (exportedField.valueKind)
+    {
+        case ExportedField::List:
+        {
+            const QVariantList list = fieldValue.toList();
 
-                // Add delimiter, if necessary.
-                if (itComponents != components.end() - 1)
-                {
-                    componentsString.append(exportTemplate.componentDelimiter);
-                }
+            for (int i = 0; i < list.size(); ++i)
+            {
+                fieldValueItems << list[i].toString();
             }
+            break;
+        }
 
-            // Replace other record placeholders.
-            recordString = recordString.replace(PlaceholderRecordId, record.id.toString());
-            recordString = recordString.replace(PlaceholderRecordParentId, recordParent.toString());
-            recordString = recordString.replace(PlaceholderRecordRootId, recordRoot.toString());
-            recordString = recordString.replace(PlaceholderRecordFields, fieldValuesString);
-            recordString = recordString.replace(PlaceholderComponents, componentsString);
-            recordString = recordString.replace(PlaceholderRecordDisplayName, record.displayName);
+        case ExportedField::Map:
+        {
+            const QVariantMap map = fieldValue.toMap();
 
-            if (!recordsString.isEmpty() && !recordString.isEmpty())
+            for (QVariantMap::const_iterator it = map.cbegin();
+                 it != map.cend();
+                 ++it)
             {
-                // Any previous record export succeeded (e.g. wasn't skipped). Add delimiter.
-                recordsString.append(exportTemplate.recordDelimiter);
+                fieldValueItems << it.key() << QVariant(it.value()).toString();
             }
+            break;
+        }
+
+        case ExportedField::Vector:
+        {
+            QVariantMap vector = fieldValue.toMap();
+
+            fieldValueItems << "X" << vector[BuiltInType::Vector::X].toString();
+            fieldValueItems << "Y" << vector[BuiltInType::Vector::Y].toString();
+
+            const QString& fieldType = exportedField.fieldDefinition.fieldType;
+
+            if (fieldType == BuiltInType::Vector3I || fieldType == BuiltInType::Vector3R)
+            {
+                fieldValueItems << "Z" << vector[BuiltInType::Vector::Z].toString();
+            }
+            break;
+        }
+
+        case ExportedField::Plain:
+            break;
+    }
+
+    return fieldValueItems;
+}
+
+const ExportController::ExportPlan ExportController::planExport(const RecordExportTemplateList& exportTemplates) const
+{
+    ExportPlan plan;
+
+    // Number records in export order.
+    const RecordSetList& recordSets = this->recordsController.getRecordSets();
 
-            recordsString.append(recordString);
+    for (const RecordSet& recordSet : recordSets)
+    {
+        for (const Record& record : recordSet.records)
+        {
+            plan.recordOrdinals.insert(record.id.toString(), plan.recordOrdinals.count());
         }
     }
 
-    // Apply record file template.
-    QString recordFileString = exportTemplate.recordFileTemplate;
-    recordFileString = recordFileString.replace(PlaceholderRecords, recordsString);
-    recordFileString = recordFileString.replace(PlaceholderAppVersion, APP_VERSION);
-    recordFileString = recordFileString.replace(PlaceholderAppVersionName, APP_VERSION_NAME);
-    recordFileString = recordFileString.replace(PlaceholderExportTime, QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    const int recordCount = plan.recordOrdinals.count();
 
-    if (recordFileString.contains(PlaceholderHash))
+    for (int i = 0; i < recordCount; ++i)
     {
-        QString hash = this->recordsController.computeRecordsHash();
-        recordFileString = recordFileString.replace(PlaceholderHash, hash);
+        plan.recordRoots << QVariant();
     }
 
-    // Write record file.
-    QTextStream textStream(&device);
-    textStream.setCodec("UTF-8");
-    textStream << recordFileString;
+    // Look up whitelisted and ignored records in constant time.
+    QList<QSet<QString>> includedRecords;
+    QList<QSet<QString>> ignoredRecords;
 
-    // Report finish.
-    emit this->progressChanged(tr("Exporting Data"), QString(), 1, 1);
-}
+    // Whether each record or any of its ancestors is whitelisted or ignored, by template and ordinal.
+    QList<QBitArray> whitelistedSubtrees;
+    QList<QBitArray> ignoredSubtrees;
 
-bool ExportController::removeExportTemplate(const QString& name)
-{
-    qInfo(qUtf8Printable(QString("Removing export template %1.").arg(name)));
+    for (const RecordExportTemplate& exportTemplate : exportTemplates)
+    {
+        includedRecords << exportTemplate.includedRecords.toSet();
+        ignoredRecords << exportTemplate.ignoredRecords.toSet();
 
-    // Update model.
-    for (RecordExportTemplateList::iterator it = this->model->begin();
-         it != this->model->end();
-         ++it)
+        whitelistedSubtrees << QBitArray(recordCount);
+        ignoredSubtrees << QBitArray(recordCount);
+        plan.exportedRecords << QBitArray(recordCount);
+    }
+
+    // Visit record tree, parents first.
+    QVariantList openIds = this->recordsController.getChildIds(QVariant());
+
+    while (!openIds.isEmpty())
     {
-        if (it->name == name)
+        const QVariant id = openIds.takeLast();
+        const QString key = id.toString();
+        const Record& record = this->recordsController.getRecord(id);
+        const QVariantList childIds = this->recordsController.getChildIds(id);
+
+        openIds << childIds;
+
+        const int ordinal = plan.recordOrdinals.value(key);
+        const int parentOrdinal = plan.recordOrdinals.value(record.parentId.toString(), -1);
+
+        plan.recordRoots[ordinal] = parentOrdinal >= 0 ? plan.recordRoots[parentOrdinal] : id;
+
+        for (int t = 0; t < exportTemplates.count(); ++t)
         {
-            this->model->erase(it);
+            const RecordExportTemplate& exportTemplate = exportTemplates[t];
 
-            // Notify listeners.
-            emit this->exportTemplatesChanged();
-            return true;
+            // Pass down whether any ancestor is whitelisted or ignored.
+            const bool whitelisted = includedRecords[t].contains(key) ||
+                    (parentOrdinal >= 0 && whitelistedSubtrees[t].testBit(parentOrdinal));
+            const bool ignored = ignoredRecords[t].contains(key) ||
+                    (parentOrdinal >= 0 && ignoredSubtrees[t].testBit(parentOrdinal));
+
+            whitelistedSubtrees[t].setBit(ordinal, whitelisted);
+            ignoredSubtrees[t].setBit(ordinal, ignored);
+
+            // Check if should export root, inner node or leaf.
+            bool exported;
+
+            if (record.parentId.isNull())
+            {
+                exported = exportTemplate.exportRoots;
+            }
+            else if (childIds.isEmpty())
+            {
+                exported = exportTemplate.exportLeafs;
+            }
+            else
+            {
+                exported = exportTemplate.exportInnerNodes;
+            }
+
+            // Check if whitelisted and not ignored.
+            exported = exported && (includedRecords[t].isEmpty() || whitelisted) && !ignored;
+
+            plan.exportedRecords[t].setBit(ordinal, exported);
         }
     }
 
-    return false;
-}
-
-void ExportController::setRecordExportTemplates(RecordExportTemplateList& exportTemplates)
-{
-    this->model = &exportTemplates;
+    return plan;
 }
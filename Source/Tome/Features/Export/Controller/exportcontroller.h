@@ -1,17 +1,24 @@
 #ifndef EXPORTCONTROLLER_H
 #define EXPORTCONTROLLER_H
 
+#include <QBitArray>
+#include <QHash>
 #include <QIODevice>
 #include <QString>
+#include <QStringList>
 
 #include "../Model/recordexporttemplatelist.h"
 #include "../Model/recordexporttemplatemap.h"
+#include "../../Fields/Model/fielddefinitionlist.h"
+#include "../../Records/Model/recordfieldvaluemap.h"
 
 namespace Tome
 {
     class FacetsController;
     class FieldDefinitionsController;
+    class Record;
     class RecordsController;
+    class StringReplacer;
     class TypesController;
 
     /**
@@ -82,6 +89,56 @@ namespace Tome
              */
             void exportRecords(const RecordExportTemplate& exportTemplate, QIODevice& device) const;
 
+            /**
+             * @brief Exports all records using each of the passed export templates to a file at the respective path.
+             *
+             * Records are traversed and their field values are resolved only once for all templates.
+             *
+             * @exception std::runtime_error if any of the files at the specified paths could not be written.
+             *
+             * @param exportTemplates Templates to apply when exporting the records.
+             * @param filePaths Paths of the files to write the exported data to, one for each export template.
+             */
+            void exportRecords(const RecordExportTemplateList& exportTemplates, const QStringList& filePaths) const;
+
+            /**
+             * @brief Exports all records using each of the passed export templates to the respective device.
+             *
+             * Records are traversed and their field values are resolved only once for all templates.
+             *
+             * @param exportTemplates Templates to apply when exporting the records.
+             * @param devices Devices to write the exported data to, one for each export template.
+             */
+            void exportRecords(const RecordExportTemplateList& exportTemplates, const QList<QIODevice*>& devices) const;
+
+            /**
+             * @brief Exports all records using each of the passed export templates to a file at the respective path, skipping files that are already up-to-date.
+             *
+             * A fingerprint of the record data, field definitions, custom types, export template and application version is stored next to each exported file.
+             * Files whose stored fingerprint matches the current one are neither regenerated nor touched.
+             *
+             * @exception std::runtime_error if any of the files at the specified paths could not be written.
+             *
+             * @param exportTemplates Templates to apply when exporting the records.
+             * @param filePaths Paths of the files to write the exported data to, one for each export template.
+             * @return Number of files that have actually been written.
+             */
+            int exportChangedRecords(const RecordExportTemplateList& exportTemplates, const QStringList& filePaths) const;
+
+            /**
+             * @brief Exports all records using each of the export templates with the specified names, skipping files that are already up-to-date.
+             *
+             * Each export template writes to the specified path, with the file extension of that template appended.
+             *
+             * @exception std::out_of_range if any of the export templates could not be found.
+             * @exception std::runtime_error if any two export templates would write to the same file, or any of the files could not be written.
+             *
+             * @param exportTemplateNames Names of the templates to apply when exporting the records.
+             * @param exportPath Path of the files to write the exported data to, without file extension.
+             * @return Number of files that have actually been written.
+             */
+            int exportChangedRecords(const QStringList& exportTemplateNames, const QString& exportPath) const;
+
             /**
              * @brief Removes the record export template with the specified name from the project.
              * @param name Name of the record export template to remove.
@@ -111,8 +168,71 @@ namespace Tome
             void progressChanged(const QString title, const QString text, const int currentValue, const int maximumValue) const;
 
         private:
+            /**
+             * @brief Type information of a field, resolved once per export.
+             */
+            class ExportedField
+            {
+                public:
+                    enum ValueKind
+                    {
+                        Plain,
+                        List,
+                        Map,
+                        Vector
+                    };
+
+                    FieldDefinition fieldDefinition;
+                    ValueKind valueKind = Plain;
+                    QString itemType;
+                    QString keyType;
+                    QString valueType;
+                    bool localized = false;
+                    bool derivedType = false;
+                    bool integerVector = false;
+                    QStringList emptyValueItems;
+            };
+
+            /**
+             * @brief Data of a record, resolved once per export and shared by all export templates.
+             */
+            class ExportedRecord
+            {
+                public:
+                    const Record* record = nullptr;
+                    QVariant recordParent;
+                    QVariant recordRoot;
+                    RecordFieldValueMap fieldValues;
+                    QHash<QString, QStringList> fieldValueItems;
+                    QStringList components;
+            };
+
+            /**
+             * @brief Records to export with each template, resolved in a single traversal of the record tree per export.
+             */
+            class ExportPlan
+            {
+                public:
+                    /**
+                     * @brief Position of each record in the export order, by record id.
+                     */
+                    QHash<QString, int> recordOrdinals;
+
+                    /**
+                     * @brief Id of the root of the record tree each record belongs to, by ordinal.
+                     */
+                    QVariantList recordRoots;
+
+                    /**
+                     * @brief Whether to export each record, by template and ordinal.
+                     */
+                    QList<QBitArray> exportedRecords;
+            };
+
             RecordExportTemplateList* model;
 
+            static const QString FingerprintFileExtension;
+
             static const QString PlaceholderAppVersion;
             static const QString PlaceholderAppVersionName;
             static const QString PlaceholderComponents;
@@ -141,6 +261,22 @@ namespace Tome
             const FieldDefinitionsController& fieldDefinitionsController;
             const RecordsController& recordsController;
             const TypesController& typesController;
+
+            const QString computeExportFingerprint(const RecordExportTemplate& exportTemplate, const QString& recordsHash) const;
+            const QString exportRecord(const RecordExportTemplate& exportTemplate,
+                                       const StringReplacer& stringReplacer,
+                                       const ExportedRecord& exportedRecord,
+                                       const QHash<QString, ExportedField>& exportedFields,
+                                       const FieldDefinitionList& fields,
+                                       const QStringList& allComponents) const;
+            const ExportedField& getExportedField(const QHash<QString, ExportedField>& exportedFields, const QString& fieldId) const;
+            const QString getFieldValueText(const RecordExportTemplate& exportTemplate,
+                                            const StringReplacer& stringReplacer,
+                                            const ExportedField& exportedField,
+                                            const QVariant& fieldValue,
+                                            const QStringList& fieldValueItems) const;
+            const QStringList getFieldValueItems(const ExportedField& exportedField, const QVariant& fieldValue) const;
+            const ExportPlan planExport(const RecordExportTemplateList& exportTemplates) const;
     };
 }
 
@@ -3,6 +3,7 @@
 #include "QXmlStreamWriter"
 
 #include "../Model/recordexporttemplate.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../../IO/xmlreader.h"
 
 using namespace Tome;
@@ -40,6 +41,8 @@ ExportTemplateSerializer::ExportTemplateSerializer()
 
 void ExportTemplateSerializer::serialize(QIODevice& device, const RecordExportTemplate& exportTemplate) const
 {
+    TOME_TRACE("Serialization", "serializeExportTemplate");
+
     // Open device stream.
     QXmlStreamWriter writer(&device);
     writer.setAutoFormatting(true);
@@ -150,6 +153,8 @@ void ExportTemplateSerializer::serialize(QIODevice& device, const RecordExportTe
 
 void ExportTemplateSerializer::deserialize(QIODevice& device, RecordExportTemplate& exportTemplate) const
 {
+    TOME_TRACE("Serialization", "deserializeExportTemplate");
+
     // Open device stream.
     XmlReader reader(&device);
 
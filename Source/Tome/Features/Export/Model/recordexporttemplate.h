@@ -129,6 +129,8 @@ namespace Tome
 
             /**
              * @brief Map that specifies which strings to replace by which ones during export.
+             *
+             * All strings are replaced in a single pass. Where they overlap, the leftmost and then longest one wins, and replacements are never replaced again.
              */
             QMap<QString, QString> stringReplacementMap;
 
@@ -1,9 +1,8 @@
 #include "requiredreferenceancestorfacet.h"
 
-#include <QComboBox>
-
 #include "../Model/facetcontext.h"
 #include "../../Records/Controller/recordscontroller.h"
+#include "../../Records/View/recordpickerwidget.h"
 #include "../../Types/Model/builtintype.h"
 
 using namespace Tome;
@@ -18,18 +17,10 @@ RequiredReferenceAncestorFacet::RequiredReferenceAncestorFacet()
 
 QWidget* RequiredReferenceAncestorFacet::createWidget(const FacetContext& context) const
 {
-    QComboBox* comboBox = new QComboBox();
-    const RecordList records = context.recordsController.getRecords();
-
-    // Allow clearing the field.
-    comboBox->addItem(QString(), QVariant());
-
-    for (const Record& record : records)
-    {
-        comboBox->addItem(record.displayName, record.id);
-    }
-
-    return comboBox;
+    // Any record can be the required ancestor.
+    RecordPickerWidget* recordPicker = new RecordPickerWidget(context.recordsController);
+    recordPicker->setRecordIds(context.recordsController.getSortedDescendantIds(QVariant()));
+    return recordPicker;
 }
 
 const QVariant RequiredReferenceAncestorFacet::getDefaultValue() const
@@ -62,22 +53,14 @@ const QString RequiredReferenceAncestorFacet::getTargetType() const
 
 const QVariant RequiredReferenceAncestorFacet::getWidgetValue(QWidget* widget) const
 {
-    QComboBox* comboBox = static_cast<QComboBox*>(widget);
-    return comboBox->currentData();
+    RecordPickerWidget* recordPicker = static_cast<RecordPickerWidget*>(widget);
+    return recordPicker->getRecordId();
 }
 
 void RequiredReferenceAncestorFacet::setWidgetValue(QWidget* widget, const QVariant value) const
 {
-    QComboBox* comboBox = static_cast<QComboBox*>(widget);
-
-    for (int i = 0; i < comboBox->count(); ++i)
-    {
-        if (comboBox->itemData(i) == value)
-        {
-            comboBox->setCurrentIndex(i);
-            return;
-        }
-    }
+    RecordPickerWidget* recordPicker = static_cast<RecordPickerWidget*>(widget);
+    recordPicker->setRecordId(value);
 }
 
 QString RequiredReferenceAncestorFacet::validateValue(const FacetContext& context, const QVariant value, const QVariant facetValue) const
@@ -2,6 +2,7 @@
 
 #include "../fielddefinitionscontroller.h"
 #include "../../../Records/Controller/recordscontroller.h"
+#include "../../../../Util/memoryutils.h"
 
 using namespace Tome;
 
@@ -54,6 +55,8 @@ void RemoveFieldDefinitionCommand::redo()
     this->fieldDefinitionSetName = fieldDefinition.fieldDefinitionSetName;
 
     // Store record field values.
+    this->removedRecordFieldValues.clear();
+
     const RecordList records = this->recordsController.getRecords();
 
     for (int i = 0; i < records.size(); ++i)
@@ -69,3 +72,16 @@ void RemoveFieldDefinitionCommand::redo()
     // Remove field definition.
     this->fieldDefinitionsController.removeFieldDefinition(this->id);
 }
+
+qint64 RemoveFieldDefinitionCommand::getApproximateSize() const
+{
+    return sizeof(RemoveFieldDefinitionCommand) +
+            approximateSize(this->id) +
+            approximateSize(this->displayName) +
+            approximateSize(this->fieldType) +
+            approximateSize(this->defaultValue) +
+            approximateSize(this->component) +
+            approximateSize(this->description) +
+            approximateSize(this->fieldDefinitionSetName) +
+            approximateSize(this->removedRecordFieldValues);
+}
@@ -5,6 +5,8 @@
 #include <QUndoCommand>
 #include <QVariant>
 
+#include "../../../Undo/Controller/sizedundocommand.h"
+
 namespace Tome
 {
     class FieldDefinitionsController;
@@ -13,7 +15,7 @@ namespace Tome
     /**
      * @brief Removes a field from the project.
      */
-    class RemoveFieldDefinitionCommand : public QUndoCommand, public QObject
+    class RemoveFieldDefinitionCommand : public QUndoCommand, public QObject, public SizedUndoCommand
     {
         public:
             /**
@@ -36,6 +38,12 @@ namespace Tome
              */
             virtual void redo() Q_DECL_OVERRIDE;
 
+            /**
+             * @brief Approximates the number of bytes this command occupies in memory, including the removed record field values.
+             * @return Approximate number of bytes this command occupies in memory.
+             */
+            virtual qint64 getApproximateSize() const Q_DECL_OVERRIDE;
+
         private:
             FieldDefinitionsController& fieldDefinitionsController;
             RecordsController& recordsController;
@@ -2,6 +2,9 @@
 
 #include <stdexcept>
 
+#include <QMap>
+#include <QStringList>
+
 #include "../../Components/Controller/componentscontroller.h"
 #include "../../Types/Controller/typescontroller.h"
 #include "../../../Util/listutils.h"
@@ -256,6 +259,96 @@ void FieldDefinitionsController::updateFieldDefinition(const QString oldId,
     emit this->fieldDefinitionUpdated(oldFieldDefinition, fieldDefinition);
 }
 
+bool FieldDefinitionsController::updateFieldDefinitionSet(const FieldDefinitionSet& fieldDefinitionSet)
+{
+    FieldDefinitionSet* currentFieldDefinitionSet = nullptr;
+
+    for (FieldDefinitionSet& existingFieldDefinitionSet : *this->model)
+    {
+        if (existingFieldDefinitionSet.name == fieldDefinitionSet.name)
+        {
+            currentFieldDefinitionSet = &existingFieldDefinitionSet;
+            break;
+        }
+    }
+
+    if (currentFieldDefinitionSet == nullptr)
+    {
+        return false;
+    }
+
+    QMap<QString, FieldDefinition> oldFieldDefinitions;
+
+    for (const FieldDefinition& fieldDefinition : currentFieldDefinitionSet->fieldDefinitions)
+    {
+        oldFieldDefinitions.insert(fieldDefinition.id, fieldDefinition);
+    }
+
+    // Field definitions moved in from other sets would have to be removed there first.
+    for (const FieldDefinition& fieldDefinition : fieldDefinitionSet.fieldDefinitions)
+    {
+        if (!oldFieldDefinitions.contains(fieldDefinition.id) && this->hasFieldDefinition(fieldDefinition.id))
+        {
+            return false;
+        }
+    }
+
+    qInfo(qUtf8Printable(QString("Updating field definition set %1 with %2 field definitions.")
+          .arg(fieldDefinitionSet.name, QString::number(fieldDefinitionSet.fieldDefinitions.count()))));
+
+    // Update model.
+    currentFieldDefinitionSet->fieldDefinitions = fieldDefinitionSet.fieldDefinitions;
+
+    for (FieldDefinition& fieldDefinition : currentFieldDefinitionSet->fieldDefinitions)
+    {
+        fieldDefinition.fieldDefinitionSetName = currentFieldDefinitionSet->name;
+    }
+
+    std::sort(currentFieldDefinitionSet->fieldDefinitions.begin(),
+              currentFieldDefinitionSet->fieldDefinitions.end(),
+              fieldDefinitionLessThanDisplayName);
+
+    // Notify listeners.
+    QStringList newFieldDefinitionIds;
+
+    for (const FieldDefinition& fieldDefinition : fieldDefinitionSet.fieldDefinitions)
+    {
+        newFieldDefinitionIds << fieldDefinition.id;
+    }
+
+    for (const FieldDefinition& oldFieldDefinition : oldFieldDefinitions)
+    {
+        if (!newFieldDefinitionIds.contains(oldFieldDefinition.id))
+        {
+            emit this->fieldDefinitionRemoved(oldFieldDefinition);
+        }
+    }
+
+    for (FieldDefinition newFieldDefinition : fieldDefinitionSet.fieldDefinitions)
+    {
+        newFieldDefinition.fieldDefinitionSetName = fieldDefinitionSet.name;
+
+        if (!oldFieldDefinitions.contains(newFieldDefinition.id))
+        {
+            emit this->fieldDefinitionAdded(newFieldDefinition);
+            continue;
+        }
+
+        const FieldDefinition& oldFieldDefinition = oldFieldDefinitions[newFieldDefinition.id];
+
+        if (oldFieldDefinition.displayName != newFieldDefinition.displayName ||
+                oldFieldDefinition.fieldType != newFieldDefinition.fieldType ||
+                oldFieldDefinition.defaultValue != newFieldDefinition.defaultValue ||
+                oldFieldDefinition.description != newFieldDefinition.description ||
+                oldFieldDefinition.component != newFieldDefinition.component)
+        {
+            emit this->fieldDefinitionUpdated(oldFieldDefinition, newFieldDefinition);
+        }
+    }
+
+    return true;
+}
+
 void FieldDefinitionsController::onComponentRemoved(const Component& component)
 {
     // Reset component for affected fields.
@@ -143,6 +143,13 @@ namespace Tome
                     const QString& description,
                     const QString& fieldDefinitionSetName);
 
+            /**
+             * @brief Replaces the field definitions of the set with the same name by the field definitions of the specified set, e.g. after the field definition set file has been changed outside of Tome.
+             * @param fieldDefinitionSet Field definition set to take the field definitions from.
+             * @return true, if the field definitions could be updated, and false, if the field definition set could not be found, or field definitions have been moved between sets.
+             */
+            bool updateFieldDefinitionSet(const FieldDefinitionSet& fieldDefinitionSet);
+
         signals:
             /**
              * @brief A new field definition has been added to the project.
@@ -3,6 +3,7 @@
 #include <QXmlStreamWriter>
 
 #include "../Model/fielddefinitionset.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../../IO/xmlreader.h"
 
 using namespace Tome;
@@ -23,6 +24,8 @@ const QString FieldDefinitionSetSerializer::ElementFields = "Fields";
 
 void FieldDefinitionSetSerializer::serialize(QIODevice& device, const FieldDefinitionSet& fieldDefinitionSet) const
 {
+    TOME_TRACE("Serialization", "serializeFieldDefinitionSet");
+
     // Open device stream.
     QXmlStreamWriter stream(&device);
     stream.setAutoFormatting(true);
@@ -89,6 +92,8 @@ void FieldDefinitionSetSerializer::serialize(QIODevice& device, const FieldDefin
 
 void FieldDefinitionSetSerializer::deserialize(QIODevice& device, FieldDefinitionSet& fieldDefinitionSet) const
 {
+    TOME_TRACE("Serialization", "deserializeFieldDefinitionSet");
+
     // Open device stream.
     XmlReader reader(&device);
 
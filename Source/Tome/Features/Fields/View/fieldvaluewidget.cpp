@@ -14,7 +14,9 @@
 #include "vector3rwidget.h"
 #include "../../Facets/Controller/facet.h"
 #include "../../Facets/Controller/facetscontroller.h"
+#include "../../Facets/Controller/requiredreferenceancestorfacet.h"
 #include "../../Records/Controller/recordscontroller.h"
+#include "../../Records/View/recordpickerwidget.h"
 #include "../../Types/Controller/typescontroller.h"
 #include "../../Facets/Model/facetcontext.h"
 #include "../../Types/Model/customtype.h"
@@ -65,6 +67,9 @@ FieldValueWidget::FieldValueWidget(FacetsController& facetsController,
     this->comboBox = new QComboBox();
     this->addWidget(this->comboBox);
 
+    this->recordPicker = new RecordPickerWidget(this->recordsController);
+    this->addWidget(this->recordPicker);
+
     this->listWidget = new ListWidget(this->facetsController, this->projectController, this->recordsController, this->typesController);
     this->addWidget(this->listWidget);
 
@@ -115,6 +120,12 @@ FieldValueWidget::FieldValueWidget(FacetsController& facetsController,
                 SLOT(onComboBoxCurrentIndexChanged(QString))
                 );
 
+    connect(
+                this->recordPicker,
+                SIGNAL(recordIdChanged(QVariant)),
+                SLOT(onRecordPickerRecordIdChanged(QVariant))
+                );
+
     connect(
                 this->spinBox,
                 SIGNAL(valueChanged(int)),
@@ -225,6 +236,12 @@ void FieldValueWidget::onComboBoxCurrentIndexChanged(const QString &text)
     this->updateErrorLabel();
 }
 
+void FieldValueWidget::onRecordPickerRecordIdChanged(const QVariant& recordId)
+{
+    Q_UNUSED(recordId)
+    this->updateErrorLabel();
+}
+
 void FieldValueWidget::onSpinBoxValueChanged(int i)
 {
     Q_UNUSED(i)
@@ -275,7 +292,7 @@ QVariant FieldValueWidget::getFieldValueForType(const QString& typeName) const
 
     if (typeName == BuiltInType::Reference)
     {
-        return this->comboBox->currentData();
+        return this->recordPicker->getRecordId();
     }
 
     if (typeName == BuiltInType::Vector2I)
@@ -374,27 +391,17 @@ void FieldValueWidget::selectWidgetForType(const QString& typeName)
 
     if (typeName == BuiltInType::Reference)
     {
-        this->comboBox->clear();
+        // Only suggest allowed record references, taken from the pre-sorted subtree of the required ancestor, if any.
+        QVariant requiredAncestor =
+                this->facetsController.getFacetValue(this->getFieldType(), RequiredReferenceAncestorFacet::FacetKey);
 
-        // Allow clearing the field.
-        this->comboBox->addItem(QString(), QVariant());
-
-        // Only show allowed record references.
-        RecordList records = this->recordsController.getRecords();
-        std::sort(records.begin(), records.end(), recordLessThanDisplayName);
-
-        for (const Record& record : records)
+        if (!this->recordsController.hasRecord(requiredAncestor))
         {
-            const QString& validationError =
-                    this->facetsController.validateFieldValue(this->getFieldType(), record.id);
-
-            if (validationError.isEmpty())
-            {
-                this->comboBox->addItem(record.displayName, record.id);
-            }
+            requiredAncestor = QVariant();
         }
 
-        this->setCurrentWidget(this->comboBox);
+        this->recordPicker->setRecordIds(this->recordsController.getSortedDescendantIds(requiredAncestor));
+        this->setCurrentWidget(this->recordPicker);
         return;
     }
 
@@ -534,14 +541,8 @@ void FieldValueWidget::setFieldValueForType(const QVariant& fieldValue, const QS
 
     if (typeName == BuiltInType::Reference)
     {
-        for (int i = 0; i < this->comboBox->count(); ++i)
-        {
-            if (this->comboBox->itemData(i) == fieldValue)
-            {
-                this->comboBox->setCurrentIndex(i);
-                return;
-            }
-        }
+        this->recordPicker->setRecordId(fieldValue);
+        return;
     }
 
     if (typeName == BuiltInType::Vector2I)
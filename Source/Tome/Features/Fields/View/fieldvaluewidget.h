@@ -21,6 +21,7 @@ namespace Tome
     class MapWidget;
     class FacetsController;
     class ProjectController;
+    class RecordPickerWidget;
     class RecordsController;
     class TypesController;
     class Vector2IWidget;
@@ -103,6 +104,7 @@ namespace Tome
             void onDoubleSpinBoxValueChanged(double d);
             void onPlainTextEditTextChanged();
             void onComboBoxCurrentIndexChanged(const QString& text);
+            void onRecordPickerRecordIdChanged(const QVariant& recordId);
             void onSpinBoxValueChanged(int i);
 
         private:
@@ -118,6 +120,7 @@ namespace Tome
             ListWidget* listWidget;
             MapWidget* mapWidget;
             QComboBox* comboBox;
+            RecordPickerWidget* recordPicker;
             QSpinBox* spinBox;
             Vector2IWidget* vector2IWidget;
             Vector3IWidget* vector3IWidget;
@@ -3,6 +3,8 @@
 #include <QFile>
 #include <QTextStream>
 
+#include "../../../Util/progressreporter.h"
+
 using namespace Tome;
 
 
@@ -108,6 +110,7 @@ void CsvRecordDataSource::importData(const RecordTableImportTemplate& importTemp
     // Read rows.
     QMap<QString, RecordFieldValueMap> data;
     int rowIndex = 0;
+    ProgressReporter progress(progressBarTitle, static_cast<int>(file.size()), ProgressReporter::forSignal(this, &CsvRecordDataSource::progressChanged));
 
     while (!(line = textStream.readLine()).isEmpty())
     {
@@ -133,7 +136,7 @@ void CsvRecordDataSource::importData(const RecordTableImportTemplate& importTemp
         }
 
         // Update progress bar.
-        emit this->progressChanged(progressBarTitle, recordId, file.pos(), file.size());
+        progress.update(static_cast<int>(file.pos()), recordId);
 
         // Check if ignored.
         if (importTemplate.ignoredIds.contains(recordId))
@@ -166,6 +169,6 @@ void CsvRecordDataSource::importData(const RecordTableImportTemplate& importTemp
 
     file.close();
 
-    emit this->progressChanged(progressBarTitle, QString(), 1, 1);
+    progress.finish();
     emit this->dataAvailable(importTemplate.name, context, data);
 }
@@ -3,6 +3,8 @@
 #include <QNetworkReply>
 #include <QTextStream>
 
+#include "../../../Util/progressreporter.h"
+
 using namespace Tome;
 
 GoogleSheetsRecordDataSource::GoogleSheetsRecordDataSource()
@@ -96,6 +98,7 @@ void GoogleSheetsRecordDataSource::onFinished(QNetworkReply* reply)
     QMap<QString, RecordFieldValueMap> data;
     int rowIndex = 0;
     QString progressBarTitle = tr("Importing %1 With %2").arg(this->context.toString(), this->importTemplateName);
+    ProgressReporter progress(progressBarTitle, static_cast<int>(reply->size()), ProgressReporter::forSignal(this, &GoogleSheetsRecordDataSource::progressChanged));
 
     while (!(line = textStream.readLine()).isEmpty())
     {
@@ -115,7 +118,7 @@ void GoogleSheetsRecordDataSource::onFinished(QNetworkReply* reply)
         QString recordId = row[idColumnIndex];
 
         // Update progress bar.
-        emit this->progressChanged(progressBarTitle, recordId, reply->pos(), reply->size());
+        progress.update(static_cast<int>(reply->pos()), recordId);
 
         // Check if ignored.
         if (this->ignoredIds.contains(recordId))
@@ -139,6 +142,6 @@ void GoogleSheetsRecordDataSource::onFinished(QNetworkReply* reply)
         data[recordId] = map;
     }
 
-    emit this->progressChanged(progressBarTitle, QString(), 1, 1);
+    progress.finish();
     emit this->dataAvailable(this->importTemplateName, this->context, data);
 }
@@ -8,9 +8,13 @@ using namespace Tome;
 #include "csvrecorddatasource.h"
 #include "googlesheetsrecorddatasource.h"
 #include "xlsxrecorddatasource.h"
+#include "../../Diagnostics/Controller/logcategories.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../Fields/Controller/fielddefinitionscontroller.h"
 #include "../../Records/Controller/recordscontroller.h"
 #include "../../Types/Controller/typescontroller.h"
+#include "../../../Util/progressreporter.h"
+#include "../../../Util/stringreplacer.h"
 
 
 ImportController::ImportController(FieldDefinitionsController& fieldDefinitionsController, RecordsController& recordsController, TypesController& typesController)
@@ -55,6 +59,8 @@ const RecordTableImportTemplateList ImportController::getRecordTableImportTempla
 
 void ImportController::importRecords(const RecordTableImportTemplate& importTemplate, const QVariant& context)
 {
+    TOME_TRACE("Import", "importRecords");
+
     qInfo(qUtf8Printable(QString("Importing data from %1 with import template %2.")
              .arg(context.toString(), importTemplate.name)));
 
@@ -129,10 +135,13 @@ void ImportController::setRecordTableImportTemplates(RecordTableImportTemplateLi
 
 void ImportController::onDataAvailable(const QString& importTemplateName, const QVariant& context, const QMap<QString, RecordFieldValueMap>& data) const
 {
+    TOME_TRACE("Import", "applyImportedRecords");
+
     // Setup parameters.
     const RecordTableImportTemplate& importTemplate = this->getRecordTableImportTemplate(importTemplateName);
     const QStringList& recordSetNames = this->recordsController.getRecordSetNames();
     const QString& recordSetName = recordSetNames.first();
+    const StringReplacer stringReplacer(importTemplate.stringReplacementMap);
 
     QString contextName;
 
@@ -163,6 +172,7 @@ void ImportController::onDataAvailable(const QString& importTemplateName, const
 
     // Show progress bar.
     QString progressBarTitle = tr("Importing %1 With %2").arg(contextName, importTemplateName);
+    ProgressReporter progress(progressBarTitle, data.count(), ProgressReporter::forSignal(this, &ImportController::progressChanged));
     int index = 0;
 
     for (QMap<QString, RecordFieldValueMap>::const_iterator itRecords = data.cbegin();
@@ -181,7 +191,7 @@ void ImportController::onDataAvailable(const QString& importTemplateName, const
         }
 
         // Update progress bar.
-        emit this->progressChanged(progressBarTitle, recordId, index, data.count());
+        progress.update(index, recordId);
 
         // Get record display name and editor icon, if available.
         QVariant recordDisplayName;
@@ -216,7 +226,7 @@ void ImportController::onDataAvailable(const QString& importTemplateName, const
         }
         else
         {
-            qInfo(qUtf8Printable(QString("Updating record %1.").arg(recordId)));
+            qCInfo(logImport, qUtf8Printable(QString("Updating record %1.").arg(recordId)));
 
             if (recordDisplayName.isValid())
             {
@@ -254,15 +264,14 @@ void ImportController::onDataAvailable(const QString& importTemplateName, const
             }
 
             // Apply string replacement.
-            for (auto itStringReplacementMap = importTemplate.stringReplacementMap.cbegin();
-                 itStringReplacementMap != importTemplate.stringReplacementMap.cend();
-                 ++itStringReplacementMap)
+            if (!stringReplacer.isEmpty())
             {
-                QString fieldValueString = fieldValue.toString();
+                const QString fieldValueString = fieldValue.toString();
+                const QString replacedFieldValueString = stringReplacer.replace(fieldValueString);
 
-                if (fieldValueString.contains(itStringReplacementMap.key()))
+                if (replacedFieldValueString != fieldValueString)
                 {
-                    fieldValue = fieldValueString.replace(itStringReplacementMap.key(), itStringReplacementMap.value());
+                    fieldValue = replacedFieldValueString;
                 }
             }
 
@@ -288,6 +297,8 @@ void ImportController::onDataAvailable(const QString& importTemplateName, const
         }
     }
 
+    progress.finish();
+
     qInfo(qUtf8Printable(QString("Import finished. %1 new records added. %2 field values updated, %3 skipped, %4 up-to-date.")
           .arg(QString::number(recordsAdded),
                QString::number(fieldsUpdated),
@@ -3,6 +3,7 @@
 #include "QXmlStreamWriter"
 
 #include "../Model/recordtableimporttemplate.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../../IO/xmlreader.h"
 
 using namespace Tome;
@@ -35,6 +36,8 @@ const int ImportTemplateSerializer::Version = 1;
 
 void ImportTemplateSerializer::serialize(QIODevice& device, const RecordTableImportTemplate& importTemplate) const
 {
+    TOME_TRACE("Serialization", "serializeImportTemplate");
+
     // Open device stream.
     QXmlStreamWriter writer(&device);
     writer.setAutoFormatting(true);
@@ -117,6 +120,8 @@ void ImportTemplateSerializer::serialize(QIODevice& device, const RecordTableImp
 
 void ImportTemplateSerializer::deserialize(QIODevice& device, RecordTableImportTemplate& importTemplate) const
 {
+    TOME_TRACE("Serialization", "deserializeImportTemplate");
+
     // Open device stream.
     XmlReader reader(&device);
 
@@ -6,6 +6,8 @@
 #include <QSqlQuery>
 #include <QSqlRecord>
 
+#include "../../../Util/progressreporter.h"
+
 using namespace Tome;
 
 
@@ -106,6 +108,7 @@ void XlsxRecordDataSource::importData(const RecordTableImportTemplate& importTem
     // Read rows.
     QMap<QString, RecordFieldValueMap> data;
     int rowIndex = 0;
+    ProgressReporter progress(progressBarTitle, sqlQuery.size(), ProgressReporter::forSignal(this, &XlsxRecordDataSource::progressChanged));
 
     while (sqlQuery.next())
     {
@@ -129,7 +132,7 @@ void XlsxRecordDataSource::importData(const RecordTableImportTemplate& importTem
         }
 
         // Update progress bar.
-        emit this->progressChanged(progressBarTitle, recordId, rowIndex, sqlQuery.size());
+        progress.update(rowIndex, recordId);
 
         if (importTemplate.ignoredIds.contains(recordId))
         {
@@ -141,6 +144,6 @@ void XlsxRecordDataSource::importData(const RecordTableImportTemplate& importTem
 
     db.close();
 
-    emit this->progressChanged(progressBarTitle, QString(), 1, 1);
+    progress.finish();
     emit this->dataAvailable(importTemplate.name, context, data);
 }
@@ -0,0 +1,261 @@
+#include "filewatchercontroller.h"
+
+#include <stdexcept>
+
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QTimer>
+
+#include "projectcontroller.h"
+#include "../../Fields/Controller/fielddefinitionscontroller.h"
+#include "../../Records/Controller/recordscontroller.h"
+#include "../../Types/Controller/typescontroller.h"
+
+using namespace Tome;
+
+
+// Editors and version control tend to write several files in a row, so wait for them to finish.
+const int FileWatcherController::ReloadDelayInMilliseconds = 500;
+
+
+FileWatcherController::FileWatcherController(FieldDefinitionsController& fieldDefinitionsController,
+                                             const ProjectController& projectController,
+                                             RecordsController& recordsController,
+                                             TypesController& typesController)
+    : fieldDefinitionsController(fieldDefinitionsController),
+      projectController(projectController),
+      recordsController(recordsController),
+      typesController(typesController),
+      fileSystemWatcher(new QFileSystemWatcher()),
+      reloadTimer(new QTimer())
+{
+    this->reloadTimer->setSingleShot(true);
+    this->reloadTimer->setInterval(ReloadDelayInMilliseconds);
+
+    connect(
+                this->fileSystemWatcher,
+                SIGNAL(fileChanged(const QString&)),
+                SLOT(onFileChanged(const QString&)));
+
+    connect(
+                this->reloadTimer,
+                SIGNAL(timeout()),
+                SLOT(onReloadTimeout()));
+
+    connect(
+                &this->projectController,
+                SIGNAL(projectSaved()),
+                SLOT(onProjectSaved()));
+}
+
+FileWatcherController::~FileWatcherController()
+{
+    delete this->fileSystemWatcher;
+    delete this->reloadTimer;
+}
+
+const QStringList FileWatcherController::getChangedFilePaths() const
+{
+    return this->changedFilePaths.toList();
+}
+
+bool FileWatcherController::reloadChangedFiles()
+{
+    if (this->changedFilePaths.isEmpty())
+    {
+        return true;
+    }
+
+    const QString projectPath = this->projectController.getProjectPath();
+    QSet<QString> unhandledFilePaths = this->changedFilePaths;
+
+    // Find changed sets.
+    QStringList changedCustomTypeSetNames;
+    QStringList changedFieldDefinitionSetNames;
+    QStringList changedRecordSetNames;
+
+    for (const QString& name : this->typesController.getCustomTypeSetNames())
+    {
+        if (unhandledFilePaths.remove(this->projectController.buildFullFilePath(name, projectPath, ProjectController::TypeFileExtension)))
+        {
+            changedCustomTypeSetNames << name;
+        }
+    }
+
+    for (const QString& name : this->fieldDefinitionsController.getFieldDefinitionSetNames())
+    {
+        if (unhandledFilePaths.remove(this->projectController.buildFullFilePath(name, projectPath, ProjectController::FieldDefinitionFileExtension)))
+        {
+            changedFieldDefinitionSetNames << name;
+        }
+    }
+
+    for (const QString& name : this->recordsController.getRecordSetNames())
+    {
+        if (unhandledFilePaths.remove(this->projectController.buildFullFilePath(name, projectPath, ProjectController::RecordFileExtension)))
+        {
+            changedRecordSetNames << name;
+        }
+    }
+
+    // Project, component and template files can't be reloaded on their own.
+    if (!unhandledFilePaths.isEmpty())
+    {
+        qInfo(qUtf8Printable(QString("Project needs to be reopened for reloading %1.")
+              .arg(unhandledFilePaths.toList().join(", "))));
+        this->changedFilePaths.clear();
+        return false;
+    }
+
+    // Read all changed files before applying any of them, in order to keep the project consistent if any file can't be read.
+    QList<CustomTypeSet> customTypeSets;
+    QList<FieldDefinitionSet> fieldDefinitionSets;
+    QList<RecordSet> recordSets;
+
+    try
+    {
+        for (const QString& name : changedCustomTypeSetNames)
+        {
+            CustomTypeSet customTypeSet;
+            customTypeSet.name = name;
+            this->projectController.loadCustomTypeSet(projectPath, customTypeSet);
+            customTypeSets << customTypeSet;
+        }
+
+        for (const QString& name : changedFieldDefinitionSetNames)
+        {
+            FieldDefinitionSet fieldDefinitionSet;
+            fieldDefinitionSet.name = name;
+            this->projectController.loadFieldDefinitionSet(projectPath, fieldDefinitionSet);
+            fieldDefinitionSets << fieldDefinitionSet;
+        }
+
+        for (const QString& name : changedRecordSetNames)
+        {
+            RecordSet recordSet;
+            recordSet.name = name;
+            this->projectController.loadRecordSet(projectPath, recordSet);
+            recordSets << recordSet;
+        }
+    }
+    catch (const std::runtime_error& e)
+    {
+        // Keep the current project, and try again with the next change.
+        qCritical(e.what());
+        this->changedFilePaths.clear();
+        this->watchProjectFiles();
+        return true;
+    }
+
+    this->changedFilePaths.clear();
+
+    // Apply types and fields first, so that records end up exactly as in their files.
+    for (const CustomTypeSet& customTypeSet : customTypeSets)
+    {
+        if (!this->typesController.updateCustomTypeSet(customTypeSet))
+        {
+            return false;
+        }
+    }
+
+    for (const FieldDefinitionSet& fieldDefinitionSet : fieldDefinitionSets)
+    {
+        if (!this->fieldDefinitionsController.updateFieldDefinitionSet(fieldDefinitionSet))
+        {
+            return false;
+        }
+    }
+
+    for (const RecordSet& recordSet : recordSets)
+    {
+        if (!this->recordsController.updateRecordSet(recordSet))
+        {
+            return false;
+        }
+    }
+
+    // Files that have been replaced instead of changed are no longer being watched.
+    this->watchProjectFiles();
+    return true;
+}
+
+void FileWatcherController::watchProjectFiles()
+{
+    const QStringList watchedFiles = this->fileSystemWatcher->files();
+
+    if (!watchedFiles.isEmpty())
+    {
+        this->fileSystemWatcher->removePaths(watchedFiles);
+    }
+
+    QStringList projectFiles;
+
+    for (const QString& filePath : this->projectController.getProjectFilePaths())
+    {
+        if (QFileInfo(filePath).exists())
+        {
+            projectFiles << filePath;
+        }
+    }
+
+    if (!projectFiles.isEmpty())
+    {
+        this->fileSystemWatcher->addPaths(projectFiles);
+    }
+}
+
+void FileWatcherController::onFileChanged(const QString& path)
+{
+    // Ignore changes caused by saving the project, which might be reported only after saving has finished.
+    const QFileInfo fileInfo(path);
+    QHash<QString, QPair<QDateTime, qint64>>::iterator itSaved = this->savedFileStates.find(path);
+
+    if (itSaved != this->savedFileStates.end())
+    {
+        if (fileInfo.exists() && itSaved.value() == qMakePair(fileInfo.lastModified(), fileInfo.size()))
+        {
+            return;
+        }
+
+        this->savedFileStates.erase(itSaved);
+    }
+
+    qInfo(qUtf8Printable(QString("Project file changed: %1").arg(path)));
+
+    this->changedFilePaths.insert(path);
+
+    // Restart timer for reloading all changes at once.
+    this->reloadTimer->start();
+}
+
+void FileWatcherController::onProjectSaved()
+{
+    this->savedFileStates.clear();
+
+    for (const QString& filePath : this->projectController.getProjectFilePaths())
+    {
+        const QFileInfo fileInfo(filePath);
+
+        if (fileInfo.exists())
+        {
+            this->savedFileStates.insert(filePath, qMakePair(fileInfo.lastModified(), fileInfo.size()));
+        }
+
+        // Saving has overwritten any changes made outside of Tome before.
+        this->changedFilePaths.remove(filePath);
+    }
+
+    // Files that have been replaced instead of changed are no longer being watched.
+    this->watchProjectFiles();
+}
+
+void FileWatcherController::onReloadTimeout()
+{
+    // All changes might have been overwritten by saving the project in the meantime.
+    if (this->changedFilePaths.isEmpty())
+    {
+        return;
+    }
+
+    emit this->projectFilesChanged(this->getChangedFilePaths());
+}
@@ -0,0 +1,95 @@
+#ifndef FILEWATCHERCONTROLLER_H
+#define FILEWATCHERCONTROLLER_H
+
+#include <QDateTime>
+#include <QHash>
+#include <QObject>
+#include <QPair>
+#include <QSet>
+#include <QStringList>
+
+class QFileSystemWatcher;
+class QTimer;
+
+namespace Tome
+{
+    class FieldDefinitionsController;
+    class ProjectController;
+    class RecordsController;
+    class TypesController;
+
+    /**
+     * @brief Watches all files of the current project for changes made outside of Tome, and reloads changed record, field definition and type files.
+     */
+    class FileWatcherController : public QObject
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new controller for watching project files.
+             * @param fieldDefinitionsController Controller for adding, updating and removing field definitions.
+             * @param projectController Controller for creating, loading and saving projects.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param typesController Controller for adding, updating and removing custom types.
+             */
+            FileWatcherController(FieldDefinitionsController& fieldDefinitionsController,
+                                  const ProjectController& projectController,
+                                  RecordsController& recordsController,
+                                  TypesController& typesController);
+            ~FileWatcherController();
+
+            /**
+             * @brief Gets the full paths of all project files that have been changed, but not reloaded yet.
+             * @return Full paths of all changed project files.
+             */
+            const QStringList getChangedFilePaths() const;
+
+            /**
+             * @brief Reloads all changed record, field definition and type files, and applies their differences to the current project.
+             *
+             * Files are only read if they have changed, and listeners are only notified of records, field definitions and types
+             * that have actually been added, removed or changed.
+             *
+             * If a file could not be read (e.g. because it has been written only partially), the current project remains unchanged.
+             *
+             * @return true, if all changes could be applied, and false, if the whole project needs to be reopened instead (e.g. because the project file has changed).
+             */
+            bool reloadChangedFiles();
+
+            /**
+             * @brief Starts watching all files of the current project, replacing any previously watched files.
+             */
+            void watchProjectFiles();
+
+        signals:
+            /**
+             * @brief Project files have been changed outside of Tome.
+             * @param filePaths Full paths of all changed project files.
+             */
+            void projectFilesChanged(const QStringList& filePaths);
+
+        private slots:
+            void onFileChanged(const QString& path);
+            void onProjectSaved();
+            void onReloadTimeout();
+
+        private:
+            static const int ReloadDelayInMilliseconds;
+
+            FieldDefinitionsController& fieldDefinitionsController;
+            const ProjectController& projectController;
+            RecordsController& recordsController;
+            TypesController& typesController;
+
+            QFileSystemWatcher* fileSystemWatcher;
+            QTimer* reloadTimer;
+
+            QSet<QString> changedFilePaths;
+
+            // Last modification times and sizes of the files written by Tome itself, for telling its own changes from others.
+            QHash<QString, QPair<QDateTime, qint64>> savedFileStates;
+    };
+}
+
+#endif // FILEWATCHERCONTROLLER_H
@@ -5,12 +5,14 @@
 #include "projectserializer.h"
 #include "../Model/project.h"
 #include "../../Components/Controller/componentsetserializer.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../Export/Controller/exporttemplateserializer.h"
 #include "../../Fields/Controller/fielddefinitionsetserializer.h"
 #include "../../Import/Controller/importtemplateserializer.h"
 #include "../../Records/Controller/recordsetserializer.h"
 #include "../../Types/Controller/customtypesetserializer.h"
 #include "../../../Util/pathutils.h"
+#include "../../../Util/progressreporter.h"
 
 
 using namespace Tome;
@@ -113,6 +115,69 @@ const QString ProjectController::getFullProjectPath() const
 }
 
 
+const QStringList ProjectController::getProjectFilePaths() const
+{
+    QStringList filePaths;
+
+    if (this->project == 0)
+    {
+        return filePaths;
+    }
+
+    const QString& projectPath = this->project->path;
+
+    filePaths << this->getFullProjectPath();
+
+    for (const ComponentSet& componentSet : this->project->componentSets)
+    {
+        filePaths << this->buildFullFilePath(componentSet.name, projectPath, ComponentFileExtension);
+    }
+
+    for (const FieldDefinitionSet& fieldDefinitionSet : this->project->fieldDefinitionSets)
+    {
+        filePaths << this->buildFullFilePath(fieldDefinitionSet.name, projectPath, FieldDefinitionFileExtension);
+    }
+
+    for (const RecordSet& recordSet : this->project->recordSets)
+    {
+        filePaths << this->buildFullFilePath(recordSet.name, projectPath, RecordFileExtension);
+    }
+
+    for (const CustomTypeSet& customTypeSet : this->project->typeSets)
+    {
+        filePaths << this->buildFullFilePath(customTypeSet.name, projectPath, TypeFileExtension);
+    }
+
+    for (const RecordExportTemplate& exportTemplate : this->project->recordExportTemplates)
+    {
+        filePaths << this->buildFullFilePath(exportTemplate.path, projectPath, RecordExportTemplateFileExtension);
+
+        const QString templatePath = this->getExportTemplateFilesPath(projectPath, exportTemplate);
+
+        filePaths << templatePath + RecordExportComponentDelimiterExtension
+                  << templatePath + RecordExportComponentTemplateExtension
+                  << templatePath + RecordExportFieldValueDelimiterExtension
+                  << templatePath + RecordExportFieldValueTemplateExtension
+                  << templatePath + RecordExportListTemplateExtension
+                  << templatePath + RecordExportListItemTemplateExtension
+                  << templatePath + RecordExportListItemDelimiterExtension
+                  << templatePath + RecordExportLocalizedFieldValueTemplateExtension
+                  << templatePath + RecordExportMapTemplateExtension
+                  << templatePath + RecordExportMapItemTemplateExtension
+                  << templatePath + RecordExportMapItemDelimiterExtension
+                  << templatePath + RecordExportRecordFileTemplateExtension
+                  << templatePath + RecordExportRecordTemplateExtension
+                  << templatePath + RecordExportRecordDelimiterExtension;
+    }
+
+    for (const RecordTableImportTemplate& importTemplate : this->project->recordTableImportTemplates)
+    {
+        filePaths << this->buildFullFilePath(importTemplate.path, projectPath, RecordImportTemplateFileExtension);
+    }
+
+    return filePaths;
+}
+
 const QString ProjectController::getProjectName() const
 {
     return this->project->name;
@@ -230,6 +295,8 @@ bool ProjectController::isProjectLoaded() const
 
 void ProjectController::loadComponentSet(const QString& projectPath, ComponentSet& componentSet) const
 {
+    TOME_TRACE("Projects", "loadComponentSet");
+
     ComponentSetSerializer componentSerializer = ComponentSetSerializer();
 
     // Open component file.
@@ -264,6 +331,8 @@ void ProjectController::loadComponentSet(const QString& projectPath, ComponentSe
 
 void ProjectController::loadCustomTypeSet(const QString& projectPath, CustomTypeSet& typeSet) const
 {
+    TOME_TRACE("Projects", "loadCustomTypeSet");
+
     CustomTypeSetSerializer typesSerializer = CustomTypeSetSerializer();
 
     // Open types file.
@@ -298,6 +367,8 @@ void ProjectController::loadCustomTypeSet(const QString& projectPath, CustomType
 
 void ProjectController::loadExportTemplate(const QString& projectPath, RecordExportTemplate& exportTemplate) const
 {
+    TOME_TRACE("Projects", "loadExportTemplate");
+
     ExportTemplateSerializer exportTemplateSerializer = ExportTemplateSerializer();
 
     // Read template file.
@@ -330,35 +401,7 @@ void ProjectController::loadExportTemplate(const QString& projectPath, RecordExp
     // Read template contents.
     try
     {
-        QString templatePath;
-
-        // Check if any subpath has been specified.
-        if (!exportTemplate.templateFilesPath.isEmpty())
-        {
-            if (QDir::isRelativePath(exportTemplate.templateFilesPath))
-            {
-                templatePath = combinePaths(projectPath, exportTemplate.templateFilesPath);
-            }
-            else
-            {
-                templatePath = exportTemplate.templateFilesPath;
-            }
-        }
-        else
-        {
-            // Fall back to files with same name at same location at the template itself.
-            templatePath = exportTemplate.path;
-
-            if (QDir::isRelativePath(templatePath))
-            {
-                templatePath = combinePaths(projectPath, templatePath);
-            }
-
-            if (templatePath.endsWith(RecordExportTemplateFileExtension))
-            {
-                templatePath = templatePath.remove(RecordExportTemplateFileExtension);
-            }
-        }
+        const QString templatePath = this->getExportTemplateFilesPath(projectPath, exportTemplate);
 
         exportTemplate.fieldValueDelimiter =
                 this->readFile(templatePath + RecordExportFieldValueDelimiterExtension);
@@ -399,6 +442,8 @@ void ProjectController::loadExportTemplate(const QString& projectPath, RecordExp
 
 void ProjectController::loadFieldDefinitionSet(const QString& projectPath, FieldDefinitionSet& fieldDefinitionSet) const
 {
+    TOME_TRACE("Projects", "loadFieldDefinitionSet");
+
     FieldDefinitionSetSerializer fieldDefinitionSerializer = FieldDefinitionSetSerializer();
 
     // Open field definition file.
@@ -433,6 +478,8 @@ void ProjectController::loadFieldDefinitionSet(const QString& projectPath, Field
 
 void ProjectController::loadImportTemplate(const QString& projectPath, RecordTableImportTemplate& importTemplate) const
 {
+    TOME_TRACE("Projects", "loadImportTemplate");
+
     ImportTemplateSerializer importTemplateSerializer = ImportTemplateSerializer();
 
     // Open import template file.
@@ -467,6 +514,8 @@ void ProjectController::loadImportTemplate(const QString& projectPath, RecordTab
 
 void ProjectController::loadRecordSet(const QString& projectPath, RecordSet& recordSet) const
 {
+    TOME_TRACE("Projects", "loadRecordSet");
+
     // Open record file.
     QString fullRecordSetPath =
             buildFullFilePath(recordSet.name, projectPath, RecordFileExtension);
@@ -497,8 +546,10 @@ void ProjectController::loadRecordSet(const QString& projectPath, RecordSet& rec
     }
 }
 
-void ProjectController::openProject(const QString& projectFileName)
+void ProjectController::openProject(const QString& projectFileName, bool loadTemplates)
 {
+    TOME_TRACE("Projects", "openProject");
+
     if (projectFileName.count() <= 0)
     {
         return;
@@ -542,18 +593,26 @@ void ProjectController::openProject(const QString& projectFileName)
             this->loadFieldDefinitionSet(projectPath, project->fieldDefinitionSets[i]);
         }
 
-        // Load record files.
+        // Load record files, reporting the progress of each file as part of the whole project.
+        ProgressReporter progress(tr("Loading Data"), project->recordSets.size(), ProgressReporter::forSignal(this, &ProjectController::progressChanged));
+
         for (int i = 0; i < project->recordSets.size(); ++i)
         {
+            progress.update(i, project->recordSets[i].name);
             this->loadRecordSet(projectPath, project->recordSets[i]);
         }
 
+        progress.finish();
+
         // Load record export template files.
-        for (RecordExportTemplateList::iterator it = project->recordExportTemplates.begin();
-             it != project->recordExportTemplates.end();
-             ++it)
+        if (loadTemplates)
         {
-            this->loadExportTemplate(projectPath, *it);
+            for (RecordExportTemplateList::iterator it = project->recordExportTemplates.begin();
+                 it != project->recordExportTemplates.end();
+                 ++it)
+            {
+                this->loadExportTemplate(projectPath, *it);
+            }
         }
 
         // Load type files.
@@ -563,11 +622,14 @@ void ProjectController::openProject(const QString& projectFileName)
         }
 
         // Load record import template files.
-        for (RecordTableImportTemplateList::iterator it = project->recordTableImportTemplates.begin();
-             it != project->recordTableImportTemplates.end();
-             ++it)
+        if (loadTemplates)
         {
-            this->loadImportTemplate(projectPath, *it);
+            for (RecordTableImportTemplateList::iterator it = project->recordTableImportTemplates.begin();
+                 it != project->recordTableImportTemplates.end();
+                 ++it)
+            {
+                this->loadImportTemplate(projectPath, *it);
+            }
         }
 
         // Set project reference.
@@ -584,6 +646,9 @@ void ProjectController::openProject(const QString& projectFileName)
 void ProjectController::saveProject() const
 {
     this->saveProject(this->project);
+
+    // Notify listeners.
+    emit this->projectSaved();
 }
 
 void ProjectController::onProgressChanged(const QString title, const QString text, const int currentValue, const int maximumValue)
@@ -591,6 +656,41 @@ void ProjectController::onProgressChanged(const QString title, const QString tex
     emit this->progressChanged(title, text, currentValue, maximumValue);
 }
 
+const QString ProjectController::getExportTemplateFilesPath(const QString& projectPath, const RecordExportTemplate& exportTemplate) const
+{
+    QString templatePath;
+
+    // Check if any subpath has been specified.
+    if (!exportTemplate.templateFilesPath.isEmpty())
+    {
+        if (QDir::isRelativePath(exportTemplate.templateFilesPath))
+        {
+            templatePath = combinePaths(projectPath, exportTemplate.templateFilesPath);
+        }
+        else
+        {
+            templatePath = exportTemplate.templateFilesPath;
+        }
+    }
+    else
+    {
+        // Fall back to files with same name at same location at the template itself.
+        templatePath = exportTemplate.path;
+
+        if (QDir::isRelativePath(templatePath))
+        {
+            templatePath = combinePaths(projectPath, templatePath);
+        }
+
+        if (templatePath.endsWith(RecordExportTemplateFileExtension))
+        {
+            templatePath = templatePath.remove(RecordExportTemplateFileExtension);
+        }
+    }
+
+    return templatePath;
+}
+
 const QString ProjectController::getFullProjectPath(QSharedPointer<Project> project) const
 {
     if (project == 0)
@@ -618,6 +718,8 @@ QString ProjectController::readFile(const QString& fullPath) const
 
 void ProjectController::saveProject(QSharedPointer<Project> project) const
 {
+    TOME_TRACE("Projects", "saveProject");
+
     QString& projectPath = project->path;
     ProjectSerializer projectSerializer = ProjectSerializer();
 
@@ -2,6 +2,7 @@
 #define PROJECTCONTROLLER_H
 
 #include <QSharedPointer>
+#include <QStringList>
 
 #include "../Model/recordidtype.h"
 
@@ -158,6 +159,12 @@ namespace Tome
              */
             const QString getFullProjectPath() const;
 
+            /**
+             * @brief Gets the absolute paths of all files the current project consists of, including data and template files.
+             * @return Absolute paths of all files the current project consists of.
+             */
+            const QStringList getProjectFilePaths() const;
+
             /**
              * @brief Gets the name of the current project.
              * @return Name of the current project.
@@ -296,8 +303,9 @@ namespace Tome
              * @exception std::runtime_error if the project file could not be read.
              *
              * @param projectFileName Name of the project file to open.
+             * @param loadTemplates Whether to load all export and import template files, or skip them for opening the project faster (e.g. for checking data only).
              */
-            void openProject(const QString& projectFileName);
+            void openProject(const QString& projectFileName, bool loadTemplates = true);
 
             /**
              * @brief Saves the current project to disk, including all data and templates.
@@ -322,6 +330,11 @@ namespace Tome
              */
             void projectChanged(QSharedPointer<Tome::Project> project);
 
+            /**
+             * @brief All files of the current project have been written to disk.
+             */
+            void projectSaved() const;
+
         private slots:
             void onProgressChanged(const QString title, const QString text, const int currentValue, const int maximumValue);
 
@@ -330,6 +343,7 @@ namespace Tome
 
             RecordSetSerializer* recordSetSerializer;
 
+            const QString getExportTemplateFilesPath(const QString& projectPath, const RecordExportTemplate& exportTemplate) const;
             const QString getFullProjectPath(QSharedPointer<Project> project) const;
             QString readFile(const QString& fullPath) const;
             void saveProject(QSharedPointer<Project> project) const;
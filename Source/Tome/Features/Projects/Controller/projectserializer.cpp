@@ -3,6 +3,7 @@
 #include <QXmlStreamWriter>
 
 #include "../Model/project.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../../IO/xmlreader.h"
 
 using namespace Tome;
@@ -43,6 +44,8 @@ const int ProjectSerializer::Version = 6;
 
 void ProjectSerializer::serialize(QIODevice& device, QSharedPointer<Project> project) const
 {
+    TOME_TRACE("Serialization", "serializeProject");
+
     // Open device stream.
     QXmlStreamWriter writer(&device);
     writer.setAutoFormatting(true);
@@ -150,6 +153,8 @@ void ProjectSerializer::serialize(QIODevice& device, QSharedPointer<Project> pro
 
 void ProjectSerializer::deserialize(QIODevice& device, QSharedPointer<Project> project) const
 {
+    TOME_TRACE("Serialization", "deserializeProject");
+
     // Open device stream.
     XmlReader reader(&device);
 
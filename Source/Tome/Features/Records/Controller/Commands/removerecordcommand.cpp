@@ -1,9 +1,12 @@
 #include "removerecordcommand.h"
 
+#include <QSet>
+
 #include "../recordscontroller.h"
 #include "../../../Fields/Controller/fielddefinitionscontroller.h"
 #include "../../../Types/Controller/typescontroller.h"
 #include "../../../Types/Model/builtintype.h"
+#include "../../../../Util/memoryutils.h"
 
 using namespace Tome;
 
@@ -69,6 +72,8 @@ void RemoveRecordCommand::undo()
 void RemoveRecordCommand::redo()
 {
     // Store record data.
+    this->removedRecords.clear();
+
     const Record record = this->recordsController.getRecord(this->id);
     this->removedRecords << record;
 
@@ -81,6 +86,15 @@ void RemoveRecordCommand::redo()
         this->removedRecords << *it;
     }
 
+    QSet<QString> removedRecordIds;
+
+    for (RecordList::const_iterator it = this->removedRecords.cbegin();
+         it != this->removedRecords.cend();
+         ++it)
+    {
+        removedRecordIds.insert((*it).id.toString());
+    }
+
     // Store references of other records pointing to records that are about to be removed.
     this->removedRecordFieldValues.clear();
 
@@ -102,34 +116,54 @@ void RemoveRecordCommand::redo()
              itFields != fieldValues.cend();
              ++itFields)
         {
-            // Get record field.
+            // Check if it references any removed record.
+            const QString reference = itFields.value().toString();
+
+            if (!removedRecordIds.contains(reference))
+            {
+                continue;
+            }
+
+            // Check if it's a reference field.
             const QString fieldId = itFields.key();
             const FieldDefinition& field = this->fieldDefinitionsController.getFieldDefinition(fieldId);
 
-            // Check if it's a reference field.
             if (this->typesController.isTypeOrDerivedFromType(field.fieldType, BuiltInType::Reference))
             {
-                const QString reference = itFields.value().toString();
-
-                // Check if it references any removed record.
-                for (RecordList::const_iterator itRemovedRecords = this->removedRecords.cbegin();
-                     itRemovedRecords != this->removedRecords.cend();
-                     ++itRemovedRecords)
-                {
-                    const QVariant removedRecordId = (*itRemovedRecords).id;
-
-                    if (reference == removedRecordId.toString())
-                    {
-                        // Remember field so we can restore the reference later.
-                        removedFieldValues.insert(fieldId, removedRecordId);
-                    }
-                }
+                // Remember field so we can restore the reference later.
+                removedFieldValues.insert(fieldId, itFields.value());
             }
         }
 
-        this->removedRecordFieldValues << QPair<QVariant, RecordFieldValueMap>(record.id, removedFieldValues);
+        // Only store records that are actually affected.
+        if (!removedFieldValues.empty())
+        {
+            this->removedRecordFieldValues << QPair<QVariant, RecordFieldValueMap>(record.id, removedFieldValues);
+        }
     }
 
     // Remove records recursively.
     this->recordsController.removeRecord(this->id);
 }
+
+qint64 RemoveRecordCommand::getApproximateSize() const
+{
+    qint64 size = sizeof(RemoveRecordCommand) + approximateSize(this->id) + approximateSize(this->removedRecordFieldValues);
+
+    for (RecordList::const_iterator it = this->removedRecords.cbegin();
+         it != this->removedRecords.cend();
+         ++it)
+    {
+        const Record& record = *it;
+
+        size += sizeof(Record) + ApproximateAllocationOverhead;
+        size += approximateSize(record.id);
+        size += approximateSize(record.displayName);
+        size += approximateSize(record.editorIconFieldId);
+        size += approximateSize(record.fieldValues);
+        size += approximateSize(record.parentId);
+        size += approximateSize(record.recordSetName);
+    }
+
+    return size;
+}
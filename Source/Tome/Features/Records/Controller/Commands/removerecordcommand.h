@@ -6,6 +6,7 @@
 #include <QVariant>
 
 #include "../../Model/recordlist.h"
+#include "../../../Undo/Controller/sizedundocommand.h"
 
 namespace Tome
 {
@@ -16,7 +17,7 @@ namespace Tome
     /**
      * @brief Removes a record from the project.
      */
-    class RemoveRecordCommand : public QUndoCommand, public QObject
+    class RemoveRecordCommand : public QUndoCommand, public QObject, public SizedUndoCommand
     {
         public:
             /**
@@ -41,6 +42,12 @@ namespace Tome
              */
             virtual void redo() Q_DECL_OVERRIDE;
 
+            /**
+             * @brief Approximates the number of bytes this command occupies in memory, including the removed records.
+             * @return Approximate number of bytes this command occupies in memory.
+             */
+            virtual qint64 getApproximateSize() const Q_DECL_OVERRIDE;
+
         private:
             RecordsController& recordsController;
             FieldDefinitionsController& fieldDefinitionsController;
@@ -49,6 +56,8 @@ namespace Tome
             const QVariant id;
 
             RecordList removedRecords;
+
+            // Only records that referenced any of the removed records, and only the affected fields.
             QList<QPair<QVariant, RecordFieldValueMap>> removedRecordFieldValues;
     };
 }
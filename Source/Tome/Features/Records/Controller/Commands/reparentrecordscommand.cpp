@@ -0,0 +1,57 @@
+#include "reparentrecordscommand.h"
+
+#include "../recordscontroller.h"
+#include "../../../../Util/memoryutils.h"
+
+using namespace Tome;
+
+
+ReparentRecordsCommand::ReparentRecordsCommand(RecordsController& recordsController,
+                                               const QVariantList& recordIds,
+                                               const QVariant& newParentId)
+    : recordsController(recordsController),
+      recordIds(recordIds),
+      newParentId(newParentId)
+{
+    if (recordIds.count() == 1)
+    {
+        this->setText(tr("Reparent Record - %1").arg(recordIds.first().toString()));
+    }
+    else
+    {
+        this->setText(tr("Reparent Records - %1 Records").arg(recordIds.count()));
+    }
+}
+
+void ReparentRecordsCommand::undo()
+{
+    qInfo(qUtf8Printable(QString("Undo reparent %1 records.").arg(this->recordIds.count())));
+
+    // Restore parents.
+    this->recordsController.reparentRecords(this->recordIds, this->oldParentIds);
+}
+
+void ReparentRecordsCommand::redo()
+{
+    // Store current parents.
+    this->oldParentIds.clear();
+
+    QVariantList newParentIds;
+
+    for (const QVariant& recordId : this->recordIds)
+    {
+        this->oldParentIds << this->recordsController.getParentId(recordId);
+        newParentIds << this->newParentId;
+    }
+
+    // Reparent records.
+    this->recordsController.reparentRecords(this->recordIds, newParentIds);
+}
+
+qint64 ReparentRecordsCommand::getApproximateSize() const
+{
+    return sizeof(ReparentRecordsCommand) +
+            approximateSize(this->recordIds) +
+            approximateSize(this->newParentId) +
+            approximateSize(this->oldParentIds);
+}
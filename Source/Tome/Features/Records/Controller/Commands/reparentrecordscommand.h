@@ -0,0 +1,55 @@
+#ifndef REPARENTRECORDSCOMMAND_H
+#define REPARENTRECORDSCOMMAND_H
+
+#include <QUndoCommand>
+#include <QVariant>
+
+#include "../../../Undo/Controller/sizedundocommand.h"
+
+namespace Tome
+{
+    class RecordsController;
+
+    /**
+     * @brief Changes the parent of one or more existing records, as a single undo step.
+     */
+    class ReparentRecordsCommand : public QUndoCommand, public QObject, public SizedUndoCommand
+    {
+        public:
+            /**
+             * @brief Constructs a new command for changing the parent of one or more existing records.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param recordIds Ids of the records to change the parent of.
+             * @param newParentId Id of the new parent of the records.
+             */
+            ReparentRecordsCommand(RecordsController& recordsController,
+                                   const QVariantList& recordIds,
+                                   const QVariant& newParentId);
+
+            /**
+             * @brief Restores the previous parents of the records.
+             */
+            virtual void undo() Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Changes the parent of the records.
+             */
+            virtual void redo() Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Approximates the number of bytes this command occupies in memory, including the previous parents of all records.
+             * @return Approximate number of bytes this command occupies in memory.
+             */
+            virtual qint64 getApproximateSize() const Q_DECL_OVERRIDE;
+
+        private:
+            RecordsController& recordsController;
+
+            const QVariantList recordIds;
+            const QVariant newParentId;
+
+            QVariantList oldParentIds;
+    };
+}
+
+#endif // REPARENTRECORDSCOMMAND_H
@@ -1,6 +1,7 @@
 #include "revertrecordcommand.h"
 
 #include "../recordscontroller.h"
+#include "../../../../Util/memoryutils.h"
 
 using namespace Tome;
 
@@ -26,9 +27,14 @@ void RevertRecordCommand::undo()
 
 void RevertRecordCommand::redo()
 {
-    // Store current data.
-    this->oldRecordFieldValues = this->recordsController.getRecordFieldValues(this->recordId);
+    // Store overridden values only, inherited values are restored along with them.
+    this->oldRecordFieldValues = this->recordsController.getRecord(this->recordId).fieldValues;
 
     // Revert record.
     this->recordsController.revertRecord(this->recordId);
 }
+
+qint64 RevertRecordCommand::getApproximateSize() const
+{
+    return sizeof(RevertRecordCommand) + approximateSize(this->recordId) + approximateSize(this->oldRecordFieldValues);
+}
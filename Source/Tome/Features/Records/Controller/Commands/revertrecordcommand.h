@@ -4,6 +4,7 @@
 #include <QUndoCommand>
 
 #include "../../Model/recordfieldvaluemap.h"
+#include "../../../Undo/Controller/sizedundocommand.h"
 
 namespace Tome
 {
@@ -12,7 +13,7 @@ namespace Tome
     /**
      * @brief Reverts all fields of a record to their inherited or default value.
      */
-    class RevertRecordCommand : public QUndoCommand, public QObject
+    class RevertRecordCommand : public QUndoCommand, public QObject, public SizedUndoCommand
     {
         public:
             /**
@@ -33,6 +34,12 @@ namespace Tome
              */
             virtual void redo() Q_DECL_OVERRIDE;
 
+            /**
+             * @brief Approximates the number of bytes this command occupies in memory, including the previous field values.
+             * @return Approximate number of bytes this command occupies in memory.
+             */
+            virtual qint64 getApproximateSize() const Q_DECL_OVERRIDE;
+
         private:
             RecordsController& recordsController;
 
@@ -5,6 +5,10 @@
 using namespace Tome;
 
 
+const int UpdateRecordFieldValueCommand::CommandId = 1;
+const qint64 UpdateRecordFieldValueCommand::MergeIntervalMilliseconds = 1000;
+
+
 UpdateRecordFieldValueCommand::UpdateRecordFieldValueCommand(RecordsController& recordsController,
                                                              const QVariant& recordId,
                                                              const QString& fieldId,
@@ -28,9 +32,31 @@ void UpdateRecordFieldValueCommand::undo()
 void UpdateRecordFieldValueCommand::redo()
 {
     // Store current data.
-    const RecordFieldValueMap fieldValues = this->recordsController.getRecordFieldValues(this->recordId);
-    this->oldFieldValue = fieldValues[fieldId];
+    this->oldFieldValue = this->recordsController.getRecordFieldValue(this->recordId, this->fieldId);
 
     // Update field value.
     this->recordsController.updateRecordFieldValue(this->recordId, this->fieldId, this->newFieldValue);
+    this->lastUpdateTimer.start();
+}
+
+int UpdateRecordFieldValueCommand::id() const
+{
+    return CommandId;
+}
+
+bool UpdateRecordFieldValueCommand::mergeWith(const QUndoCommand* other)
+{
+    const UpdateRecordFieldValueCommand* command = static_cast<const UpdateRecordFieldValueCommand*>(other);
+
+    if (command->recordId != this->recordId ||
+            command->fieldId != this->fieldId ||
+            this->lastUpdateTimer.elapsed() > MergeIntervalMilliseconds)
+    {
+        return false;
+    }
+
+    // Keep the original old value for undo, and the most recent new value for redo.
+    this->newFieldValue = command->newFieldValue;
+    this->lastUpdateTimer.start();
+    return true;
 }
@@ -1,6 +1,7 @@
 #ifndef UPDATERECORDFIELDVALUECOMMAND_H
 #define UPDATERECORDFIELDVALUECOMMAND_H
 
+#include <QElapsedTimer>
 #include <QUndoCommand>
 #include <QVariant>
 
@@ -10,6 +11,8 @@ namespace Tome
 
     /**
      * @brief Updates the current value of a record field.
+     *
+     * Consecutive updates of the same field of the same record in quick succession are merged into a single command.
      */
     class UpdateRecordFieldValueCommand : public QUndoCommand, public QObject
     {
@@ -36,14 +39,31 @@ namespace Tome
              */
             virtual void redo() Q_DECL_OVERRIDE;
 
+            /**
+             * @brief Gets the id for merging consecutive updates of record field values.
+             * @return Id for merging consecutive updates of record field values.
+             */
+            virtual int id() const Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Merges the passed command into this one, if it updates the same field of the same record shortly after this one.
+             * @param other Command to merge into this one.
+             * @return true, if the passed command has been merged into this one, and false otherwise.
+             */
+            virtual bool mergeWith(const QUndoCommand* other) Q_DECL_OVERRIDE;
+
         private:
+            static const int CommandId;
+            static const qint64 MergeIntervalMilliseconds;
+
             RecordsController& recordsController;
 
             const QVariant recordId;
             const QString fieldId;
-            const QVariant newFieldValue;
+            QVariant newFieldValue;
 
             QVariant oldFieldValue;
+            QElapsedTimer lastUpdateTimer;
     };
 }
 
@@ -0,0 +1,66 @@
+#include "updaterecordfieldvaluescommand.h"
+
+#include "../recordscontroller.h"
+#include "../../../../Util/memoryutils.h"
+
+using namespace Tome;
+
+
+UpdateRecordFieldValuesCommand::UpdateRecordFieldValuesCommand(RecordsController& recordsController,
+                                                               const QVariantList& recordIds,
+                                                               const QString& fieldId,
+                                                               const QVariant& newFieldValue)
+    : recordsController(recordsController),
+      recordIds(recordIds),
+      fieldId(fieldId)
+{
+    for (int i = 0; i < recordIds.count(); ++i)
+    {
+        this->newFieldValues << newFieldValue;
+    }
+
+    this->setText(tr("Set Field Value - %1 (%2 Records)").arg(fieldId).arg(recordIds.count()));
+}
+
+UpdateRecordFieldValuesCommand::UpdateRecordFieldValuesCommand(RecordsController& recordsController,
+                                                               const QVariantList& recordIds,
+                                                               const QString& fieldId,
+                                                               const QVariantList& newFieldValues)
+    : recordsController(recordsController),
+      recordIds(recordIds),
+      fieldId(fieldId),
+      newFieldValues(newFieldValues)
+{
+    this->setText(tr("Set Field Value - %1 (%2 Records)").arg(fieldId).arg(recordIds.count()));
+}
+
+void UpdateRecordFieldValuesCommand::undo()
+{
+    qInfo(qUtf8Printable(QString("Undo set field value %1 of %2 records.").arg(this->fieldId).arg(this->recordIds.count())));
+
+    // Restore own values exactly, so records that inherited the field from other updated records keep inheriting it.
+    this->recordsController.restoreRecordFieldValues(this->recordIds, this->fieldId, this->oldOwnFieldValues);
+}
+
+void UpdateRecordFieldValuesCommand::redo()
+{
+    // Store current data.
+    this->oldOwnFieldValues.clear();
+
+    for (const QVariant& recordId : this->recordIds)
+    {
+        this->oldOwnFieldValues << this->recordsController.getRecord(recordId).fieldValues.value(this->fieldId);
+    }
+
+    // Update field values.
+    this->recordsController.updateRecordFieldValues(this->recordIds, this->fieldId, this->newFieldValues);
+}
+
+qint64 UpdateRecordFieldValuesCommand::getApproximateSize() const
+{
+    return sizeof(UpdateRecordFieldValuesCommand) +
+            approximateSize(this->recordIds) +
+            approximateSize(this->fieldId) +
+            approximateSize(this->newFieldValues) +
+            approximateSize(this->oldOwnFieldValues);
+}
@@ -0,0 +1,72 @@
+#ifndef UPDATERECORDFIELDVALUESCOMMAND_H
+#define UPDATERECORDFIELDVALUESCOMMAND_H
+
+#include <QString>
+#include <QUndoCommand>
+#include <QVariant>
+
+#include "../../../Undo/Controller/sizedundocommand.h"
+
+namespace Tome
+{
+    class RecordsController;
+
+    /**
+     * @brief Updates the current value of the same field of many records at once, as a single undo step.
+     */
+    class UpdateRecordFieldValuesCommand : public QUndoCommand, public QObject, public SizedUndoCommand
+    {
+        public:
+            /**
+             * @brief Constructs a new command for setting the same field of many records to the same value.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param recordIds Ids of the records to update the field value of.
+             * @param fieldId Id of the field to update the value of.
+             * @param newFieldValue New value of the field to update, for all records.
+             */
+            UpdateRecordFieldValuesCommand(RecordsController& recordsController,
+                                           const QVariantList& recordIds,
+                                           const QString& fieldId,
+                                           const QVariant& newFieldValue);
+
+            /**
+             * @brief Constructs a new command for setting the same field of many records to a different value each, e.g. computed from their current value.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param recordIds Ids of the records to update the field value of.
+             * @param fieldId Id of the field to update the value of.
+             * @param newFieldValues New values of the field to update, one for each record.
+             */
+            UpdateRecordFieldValuesCommand(RecordsController& recordsController,
+                                           const QVariantList& recordIds,
+                                           const QString& fieldId,
+                                           const QVariantList& newFieldValues);
+
+            /**
+             * @brief Restores the previous field values.
+             */
+            virtual void undo() Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Updates the field values.
+             */
+            virtual void redo() Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Approximates the number of bytes this command occupies in memory, including all old and new field values.
+             * @return Approximate number of bytes this command occupies in memory.
+             */
+            virtual qint64 getApproximateSize() const Q_DECL_OVERRIDE;
+
+        private:
+            RecordsController& recordsController;
+
+            const QVariantList recordIds;
+            const QString fieldId;
+            QVariantList newFieldValues;
+
+            // Own values of the records before the update, or null for records that inherited the field.
+            QVariantList oldOwnFieldValues;
+    };
+}
+
+#endif // UPDATERECORDFIELDVALUESCOMMAND_H
@@ -1,20 +1,25 @@
 #include "recordscontroller.h"
 
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 
-#include <QCryptographicHash>
+#include <QDataStream>
+#include <QMutexLocker>
 #include <QSet>
 #include <QTime>
 #include <QUuid>
 
+#include "../../Diagnostics/Controller/logcategories.h"
 #include "../../Fields/Controller/fielddefinitionscontroller.h"
 #include "../../Fields/Model/fielddefinition.h"
 #include "../../Projects/Controller/projectcontroller.h"
 #include "../../Projects/Model/recordidtype.h"
 #include "../../Types/Controller/typescontroller.h"
 #include "../../Types/Model/builtintype.h"
+#include "../../../Util/hashutils.h"
 #include "../../../Util/listutils.h"
+#include "../../../Util/progressreporter.h"
 
 
 using namespace Tome;
@@ -23,7 +28,10 @@ using namespace Tome;
 RecordsController::RecordsController(const FieldDefinitionsController& fieldDefinitionsController,
                                      const ProjectController& projectController,
                                      const TypesController& typesController)
-    : fieldDefinitionsController(fieldDefinitionsController),
+    : hierarchyLabelsDirty(true),
+      recordSearchIndexDirty(true),
+      recordFieldValueIndexDirty(true),
+      fieldDefinitionsController(fieldDefinitionsController),
       projectController(projectController),
       typesController(typesController),
       recordIdGenerator((uint)QTime::currentTime().msec()),
@@ -40,6 +48,10 @@ RecordsController::RecordsController(const FieldDefinitionsController& fieldDefi
     connect(&this->fieldDefinitionsController,
             SIGNAL(fieldDefinitionUpdated(const Tome::FieldDefinition&, const Tome::FieldDefinition&)),
             SLOT(onFieldUpdated(const Tome::FieldDefinition&, const Tome::FieldDefinition&)));
+
+    connect(&this->typesController,
+            SIGNAL(typeUpdated(const Tome::CustomType&)),
+            SLOT(onTypeUpdated(const Tome::CustomType&)));
 }
 
 const Record RecordsController::addRecord(const QVariant& id,
@@ -71,7 +83,7 @@ const Record RecordsController::addRecord(const QVariant& id,
             throw std::out_of_range(errorMessage.toStdString());
     }
 
-    qInfo(qUtf8Printable(QString("Adding record %1.").arg(record.id.toString())));
+    qCInfo(logRecords, qUtf8Printable(QString("Adding record %1.").arg(record.id.toString())));
 
     // Assign display name, icon and record set.
     record.displayName = displayName;
@@ -101,6 +113,7 @@ const Record RecordsController::addRecord(const QVariant& id,
             RecordList& records = recordSet.records;
             int index = findInsertionIndex(records, record, recordLessThanDisplayName);
             records.insert(index, record);
+            this->addRecordToIndex(records[index]);
             emit this->recordAdded(record.id, displayName, QString());
             return record;
         }
@@ -115,6 +128,7 @@ void RecordsController::addRecordSet(const RecordSet& recordSet)
 {
     // Update model.
     this->model->push_back(recordSet);
+    this->rebuildRecordIndex();
 
     // Notify listeners.
     emit this->recordSetsChanged();
@@ -122,71 +136,23 @@ void RecordsController::addRecordSet(const RecordSet& recordSet)
 
 const QString RecordsController::computeRecordsHash() const
 {
-    // Prepare MD5 hashing.
-    QCryptographicHash hash(QCryptographicHash::Md5);
+    quint64 hash = Fnv1aOffsetBasis;
 
-    // Hash all record files.
-    for (int i = 0; i < this->model->size(); ++i)
+    // Combine record set hashes.
+    for (const RecordSet& recordSet : *this->model)
     {
-        const RecordSet& recordSet = this->model->at(i);
-
-        // Hash all records.
-        for (int j = 0; j < recordSet.records.size(); ++j)
-        {
-            const Record& record = recordSet.records[j];
-            const RecordFieldValueMap fieldValues = this->getRecordFieldValues(record.id);
-
-            // Hash all fields.
-            for (RecordFieldValueMap::const_iterator itFields = fieldValues.cbegin();
-                 itFields != fieldValues.cend();
-                 ++itFields)
-            {
-                QString fieldId = itFields.key();
-                QVariant fieldValue = itFields.value();
-
-                // Hash field key.
-                hash.addData(fieldId.toUtf8());
-
-                // Hash list field items.
-                QVariantList list = fieldValue.toList();
-                if (!list.isEmpty())
-                {
-                    for (int k = 0; k < list.count(); ++k)
-                    {
-                        hash.addData(list[k].toString().toUtf8());
-                    }
-                    continue;
-                }
-
-                // Hash map field items.
-                QVariantMap map = fieldValue.toMap();
-                if (!map.isEmpty())
-                {
-                    for (QVariantMap::iterator it = map.begin();
-                         it != map.end();
-                         ++it)
-                    {
-                        const QString k = it.key();
-                        const QVariant v = it.value();
-
-                        hash.addData(k.toUtf8());
-                        hash.addData(v.toString().toUtf8());
-                    }
-                    continue;
-                }
+        quint64 recordSetHash = this->recordSetHashes.value(recordSet.name);
 
-                // Hash field value.
-                hash.addData(fieldValue.toString().toUtf8());
-            }
-        }
+        hash = fnv1a64(recordSet.name.toUtf8(), hash);
+        hash = fnv1a64(QByteArray(reinterpret_cast<const char*>(&recordSetHash), sizeof(recordSetHash)), hash);
     }
 
-    return hash.result().toHex();
+    return hashToString(hash);
 }
 
 const Record RecordsController::duplicateRecord(const QVariant& existingRecordId, const QVariant& newRecordId)
 {
-    qInfo(qUtf8Printable(QString("Duplicating record %1 to %2.")
+    qCInfo(logRecords, qUtf8Printable(QString("Duplicating record %1 to %2.")
           .arg(existingRecordId.toString(), newRecordId.toString())));
 
     // Get record to duplicate.
@@ -235,11 +201,107 @@ const Record RecordsController::duplicateRecord(const QVariant& existingRecordId
     RecordList& records = (*this->model)[recordSetIndex].records;
     int index = findInsertionIndex(records, newRecord, recordLessThanDisplayName);
     records.insert(index, newRecord);
+    this->addRecordToIndex(records[index]);
     emit this->recordAdded(newRecord.id, newRecord.displayName, newRecord.parentId);
 
     return newRecord;
 }
 
+const QVariantList RecordsController::findRecordIds(const QString& searchPattern) const
+{
+    {
+        QMutexLocker locker(&this->lazyIndexMutex);
+
+        if (this->recordSearchIndexDirty)
+        {
+            qInfo(qUtf8Printable(QString("Indexing %1 records for search.").arg(this->recordIndex.count())));
+
+            for (QHash<QString, Record*>::const_iterator it = this->recordIndex.cbegin();
+                 it != this->recordIndex.cend();
+                 ++it)
+            {
+                this->recordSearchIndex.insert(it.key(), QStringList() << it.key() << it.value()->displayName);
+            }
+
+            this->recordSearchIndexDirty = false;
+        }
+    }
+
+    QVariantList recordIds;
+
+    for (const QString& key : this->recordSearchIndex.find(searchPattern))
+    {
+        recordIds << this->recordIndex.value(key)->id;
+    }
+
+    return recordIds;
+}
+
+const QMap<QString, QVariantList> RecordsController::findRecordFieldValues(const QString& query, const QStringList& fieldIds) const
+{
+    {
+        QMutexLocker locker(&this->lazyIndexMutex);
+
+        if (this->recordFieldValueIndexDirty)
+        {
+            qInfo(qUtf8Printable(QString("Indexing field values of %1 records for search.").arg(this->recordIndex.count())));
+
+            this->recordFieldValueIndexDirty = false;
+
+            for (const FieldDefinition& field : this->fieldDefinitionsController.getFieldDefinitions())
+            {
+                if (this->isFieldValueIndexedType(field.fieldType))
+                {
+                    this->recordFieldValueIndexFieldIds.insert(field.id);
+                }
+            }
+
+            for (QHash<QString, Record*>::const_iterator it = this->recordIndex.cbegin();
+                 it != this->recordIndex.cend();
+                 ++it)
+            {
+                this->updateRecordFieldValueIndex(*it.value());
+            }
+        }
+    }
+
+    QMap<QString, QVariantList> recordIds;
+
+    for (const QString& fieldId : fieldIds)
+    {
+        QHash<QString, FullTextIndex>::const_iterator itIndex = this->recordFieldValueIndex.constFind(fieldId);
+
+        if (itIndex == this->recordFieldValueIndex.cend())
+        {
+            continue;
+        }
+
+        QVariantList openIds;
+
+        for (const QString& key : itIndex.value().find(query))
+        {
+            openIds << this->recordIndex.value(key)->id;
+        }
+
+        while (!openIds.isEmpty())
+        {
+            const QVariant recordId = openIds.takeLast();
+            recordIds[fieldId] << recordId;
+
+            // Children inherit the matching value, unless they have their own one.
+            for (const QVariant& childId : this->getChildIds(recordId))
+            {
+                if (!this->getRecordById(childId)->fieldValues.contains(fieldId))
+                {
+                    openIds << childId;
+                }
+            }
+        }
+    }
+
+    return recordIds;
+}
+
 const RecordList RecordsController::getAncestors(const QVariant& id) const
 {
     RecordList ancestors;
@@ -258,53 +320,54 @@ const RecordList RecordsController::getAncestors(const QVariant& id) const
     return ancestors;
 }
 
-const RecordList RecordsController::getChildren(const QVariant& id) const
+const QStringList RecordsController::getChangedRecordSetNames(const QMap<QString, QString>& previousRecordSetHashes) const
 {
-    RecordList children;
+    QStringList changedRecordSetNames;
 
-    for (int i = 0; i < this->model->size(); ++i)
+    for (const RecordSet& recordSet : *this->model)
     {
-        const RecordSet& recordSet = this->model->at(i);
+        const QString recordSetHash = hashToString(this->recordSetHashes.value(recordSet.name));
 
-        for (int j = 0; j < recordSet.records.size(); ++j)
+        if (previousRecordSetHashes.value(recordSet.name) != recordSetHash)
         {
-            const Record& record = recordSet.records[j];
-
-            if (record.parentId == id)
-            {
-                children.append(record);
-            }
+            changedRecordSetNames << recordSet.name;
         }
     }
 
-    return children;
+    return changedRecordSetNames;
 }
 
-const RecordList RecordsController::getDescendents(const QVariant& id) const
+const QVariantList RecordsController::getChildIds(const QVariant& id) const
 {
-    RecordList descendents;
+    return this->recordChildIndex.value(id.toString());
+}
 
-    // Climb hierarchy.
-    RecordList records = this->getRecords();
+const RecordList RecordsController::getChildren(const QVariant& id) const
+{
+    RecordList children;
 
-    for (int i = 0; i < records.count(); ++i)
+    const QVariantList childIds = this->getChildIds(id);
+
+    for (const QVariant& childId : childIds)
     {
-        // Check children.
-        const Record& record = records.at(i);
+        children.append(*this->getRecordById(childId));
+    }
 
-        if (record.parentId == id)
-        {
-            descendents << record;
+    return children;
+}
+
+const RecordList RecordsController::getDescendents(const QVariant& id) const
+{
+    RecordList descendents;
 
-            // Recursively check descendants.
-            RecordList childrenOfChild = this->getDescendents(record.id);
+    // Descendants follow their ancestor in pre-order, parents first.
+    int first;
+    int last;
+    this->getHierarchyRange(id, first, last);
 
-            for (int j = 0; j < childrenOfChild.count(); ++j)
-            {
-                const Record& child = records.at(j);
-                descendents << child;
-            }
-        }
+    for (int i = first; i <= last; ++i)
+    {
+        descendents << *this->recordIndex.value(this->hierarchyOrder[i].toString());
     }
 
     return descendents;
@@ -312,16 +375,21 @@ const RecordList RecordsController::getDescendents(const QVariant& id) const
 
 const QVariant RecordsController::getInheritedFieldValue(const QVariant& id, const QString& fieldId) const
 {
-    RecordList ancestors = this->getAncestors(id);
+    // Climb hierarchy without copying ancestors.
+    const Record* record = this->getRecordById(id);
+    QVariant parentId = record->parentId;
 
-    for (int i = 0; i < ancestors.count(); ++i)
+    while (!parentId.isNull() && this->hasRecord(parentId))
     {
-        const Record& ancestor = ancestors.at(i);
+        const Record* ancestor = this->getRecordById(parentId);
+        RecordFieldValueMap::const_iterator it = ancestor->fieldValues.constFind(fieldId);
 
-        if (ancestor.fieldValues.contains(fieldId))
+        if (it != ancestor->fieldValues.cend())
         {
-            return ancestor.fieldValues[fieldId];
+            return it.value();
         }
+
+        parentId = ancestor->parentId;
     }
 
     return QVariant();
@@ -356,6 +424,18 @@ const QVariant RecordsController::getParentId(const QVariant& id) const
     return this->getRecord(id).parentId;
 }
 
+const QMap<QString, QString> RecordsController::getRecordSetHashes() const
+{
+    QMap<QString, QString> hashes;
+
+    for (const RecordSet& recordSet : *this->model)
+    {
+        hashes.insert(recordSet.name, hashToString(this->recordSetHashes.value(recordSet.name)));
+    }
+
+    return hashes;
+}
+
 const RecordSetList& RecordsController::getRecordSets() const
 {
     return *this->model;
@@ -466,30 +546,69 @@ const RecordFieldValueMap RecordsController::getRecordFieldValues(const QVariant
     return fieldValues;
 }
 
+const QVariant RecordsController::getRecordFieldValue(const QVariant& id, const QString& fieldId) const
+{
+    const Record* record = this->getRecordById(id);
+    RecordFieldValueMap::const_iterator it = record->fieldValues.constFind(fieldId);
+
+    // Check for overridden value first.
+    if (it != record->fieldValues.cend())
+    {
+        return it.value();
+    }
+
+    return this->getInheritedFieldValue(id, fieldId);
+}
+
 const QVariant RecordsController::getRootRecordId(const QVariant& id) const
 {
-    const RecordList ancestors = this->getAncestors(id);
-    return ancestors.empty() ? id : ancestors.last().id;
+    const Record* record = this->getRecordById(id);
+
+    this->updateHierarchyLabels();
+    return this->hierarchyLabels.value(record->id.toString(), HierarchyLabel(id)).rootId;
 }
 
-bool RecordsController::hasRecord(const QVariant& id) const
+const QVariantList RecordsController::getSortedDescendantIds(const QVariant& id) const
 {
-    for (int i = 0; i < this->model->size(); ++i)
+    const QString key = id.toString();
+
     {
-        RecordSet& recordSet = (*this->model)[i];
+        QMutexLocker locker(&this->lazyIndexMutex);
+        QHash<QString, QVariantList>::const_iterator it = this->sortedDescendantIndex.constFind(key);
 
-        for (int j = 0; j < recordSet.records.size(); ++j)
+        if (it != this->sortedDescendantIndex.cend())
         {
-            Record& record = recordSet.records[j];
-
-            if (record.id == id)
-            {
-                return true;
-            }
+            return it.value();
         }
     }
 
-    return false;
+    // Collect descendants from the hierarchy index.
+    int first;
+    int last;
+    this->getHierarchyRange(id, first, last);
+
+    QVariantList descendantIds;
+
+    for (int i = first; i <= last; ++i)
+    {
+        descendantIds << this->hierarchyOrder[i];
+    }
+
+    // Sort descendants by display name.
+    std::stable_sort(descendantIds.begin(), descendantIds.end(), [this](const QVariant& lhs, const QVariant& rhs)
+    {
+        return recordLessThanDisplayName(*this->recordIndex.value(lhs.toString()),
+                                         *this->recordIndex.value(rhs.toString()));
+    });
+
+    QMutexLocker locker(&this->lazyIndexMutex);
+    this->sortedDescendantIndex.insert(key, descendantIds);
+    return descendantIds;
+}
+
+bool RecordsController::hasRecord(const QVariant& id) const
+{
+    return this->recordIndex.contains(id.toString());
 }
 
 bool RecordsController::haveTheSameParent(const QVariantList ids) const
@@ -525,22 +644,25 @@ bool RecordsController::isAncestorOf(const QVariant& possibleAncestor, const QVa
         return false;
     }
 
-    RecordList ancestors = this->getAncestors(recordId);
+    this->getRecordById(recordId);
+    this->updateHierarchyLabels();
+
+    // Descendants are labeled with sub-intervals of the pre-order interval of their ancestors.
+    QHash<QString, HierarchyLabel>::const_iterator ancestorLabel = this->hierarchyLabels.constFind(possibleAncestor.toString());
+    QHash<QString, HierarchyLabel>::const_iterator recordLabel = this->hierarchyLabels.constFind(recordId.toString());
 
-    for (int i = 0; i < ancestors.count(); ++i)
+    if (ancestorLabel == this->hierarchyLabels.cend() || recordLabel == this->hierarchyLabels.cend())
     {
-        if (ancestors[i].id == possibleAncestor)
-        {
-            return true;
-        }
+        return false;
     }
 
-    return false;
+    return ancestorLabel.value().first < recordLabel.value().first &&
+            recordLabel.value().first <= ancestorLabel.value().last;
 }
 
 void RecordsController::removeRecord(const QVariant& recordId)
 {
-    qInfo(qUtf8Printable(QString("Removing record %1.").arg(recordId.toString())));
+    qCInfo(logRecords, qUtf8Printable(QString("Removing record %1.").arg(recordId.toString())));
 
     // Remove children.
     RecordList children = this->getChildren(recordId);
@@ -569,6 +691,7 @@ void RecordsController::removeRecord(const QVariant& recordId)
 
             if (record.id == recordId)
             {
+                this->removeRecordFromIndex(record);
                 records.erase(it);
                 emit this->recordRemoved(recordId);
                 return;
@@ -587,6 +710,7 @@ void RecordsController::removeRecordSet(const QString& name)
         {
             // Update model.
             this->model->erase(it);
+            this->rebuildRecordIndex();
 
             // Notify listeners.
             emit this->recordSetsChanged();
@@ -597,11 +721,12 @@ void RecordsController::removeRecordSet(const QString& name)
 
 void RecordsController::revertRecord(const QVariant& recordId)
 {
-    qInfo(qUtf8Printable(QString("Reverting record %1.").arg(recordId.toString())));
+    qCInfo(logRecords, qUtf8Printable(QString("Reverting record %1.").arg(recordId.toString())));
 
     const RecordFieldValueMap& fields = this->getRecordFieldValues(recordId);
 
     // Revert all fields.
+    ProgressReporter progress(tr("Reverting fields"), fields.count(), ProgressReporter::forSignal(this, &RecordsController::progressChanged));
     int i = 0;
 
     for (RecordFieldValueMap::const_iterator it = fields.cbegin();
@@ -611,26 +736,144 @@ void RecordsController::revertRecord(const QVariant& recordId)
         const QString& fieldId = it.key();
 
         // Report progress.
-        emit this->progressChanged(tr("Reverting fields"), fieldId, i, fields.count());
+        progress.update(i, fieldId);
 
         this->revertFieldValue(recordId, fieldId);
     }
 
     // Report finish.
-    emit this->progressChanged(tr("Reverting fields"), QString(), 1, 1);
+    progress.finish();
 }
 
 void RecordsController::reparentRecord(const QVariant& recordId, const QVariant& newParentId)
 {
-    qInfo(qUtf8Printable(QString("Reparenting record %1 to %2.")
+    qCInfo(logRecords, qUtf8Printable(QString("Reparenting record %1 to %2.")
           .arg(recordId.toString(), newParentId.toString())));
 
     Record& record = *this->getRecordById(recordId);
     QVariant oldParentId = record.parentId;
+
+    this->removeRecordFromIndex(record);
     record.parentId = newParentId;
+    this->addRecordToIndex(record);
+
     emit this->recordReparented(recordId, oldParentId, newParentId);
 }
 
+void RecordsController::reparentRecords(const QVariantList& recordIds, const QVariantList& newParentIds)
+{
+    if (recordIds.count() != newParentIds.count())
+    {
+        const QString errorMessage = QString("Expected %1 parent ids, but got %2.").arg(recordIds.count()).arg(newParentIds.count());
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::invalid_argument(errorMessage.toStdString());
+    }
+
+    qInfo(qUtf8Printable(QString("Reparenting %1 records.").arg(recordIds.count())));
+
+    // Validate all moves first, so that either all or no records are reparented.
+    QHash<QString, QVariant> newParentIdIndex;
+
+    for (int i = 0; i < recordIds.count(); ++i)
+    {
+        const QVariant& recordId = recordIds[i];
+        const QVariant& newParentId = newParentIds[i];
+
+        this->getRecordById(recordId);
+
+        if (!newParentId.isNull())
+        {
+            this->getRecordById(newParentId);
+        }
+
+        newParentIdIndex.insert(recordId.toString(), newParentId);
+    }
+
+    // Check ancestors as they will be after all moves, as records may be moved below each other.
+    for (const QVariant& recordId : recordIds)
+    {
+        QSet<QString> visitedIds;
+        QString key = recordId.toString();
+
+        while (this->recordIndex.contains(key))
+        {
+            if (visitedIds.contains(key))
+            {
+                const QString errorMessage = QString("Can't reparent records, as record %1 would become its own ancestor.")
+                        .arg(key);
+                qCritical(qUtf8Printable(errorMessage));
+                throw std::invalid_argument(errorMessage.toStdString());
+            }
+
+            visitedIds.insert(key);
+
+            QHash<QString, QVariant>::const_iterator it = newParentIdIndex.constFind(key);
+            key = it != newParentIdIndex.cend()
+                    ? it.value().toString()
+                    : this->recordIndex.value(key)->parentId.toString();
+        }
+    }
+
+    // Reparent records.
+    for (int i = 0; i < recordIds.count(); ++i)
+    {
+        Record& record = *this->getRecordById(recordIds[i]);
+
+        this->removeRecordFromIndex(record);
+        record.parentId = newParentIds[i];
+        this->addRecordToIndex(record);
+    }
+
+    // Notify listeners.
+    emit this->recordsReparented(recordIds);
+}
+
+void RecordsController::restoreRecordFieldValues(const QVariantList& recordIds, const QString& fieldId, const QVariantList& ownFieldValues)
+{
+    if (recordIds.count() != ownFieldValues.count())
+    {
+        const QString errorMessage = QString("Expected %1 field values, but got %2.").arg(recordIds.count()).arg(ownFieldValues.count());
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::invalid_argument(errorMessage.toStdString());
+    }
+
+    qInfo(qUtf8Printable(QString("Restoring field %1 of %2 records.").arg(fieldId).arg(recordIds.count())));
+
+    // Restore all records first, so listeners are notified only once per record, with all values already restored.
+    QVariantList changedRecordIds;
+    QSet<QString> changedRecordIdSet;
+
+    for (int i = 0; i < recordIds.count(); ++i)
+    {
+        const QVariant& recordId = recordIds[i];
+        Record& record = *this->getRecordById(recordId);
+
+        if (ownFieldValues[i].isNull())
+        {
+            record.fieldValues.remove(fieldId);
+        }
+        else
+        {
+            record.fieldValues[fieldId] = ownFieldValues[i];
+        }
+
+        this->updateRecordHash(record);
+        this->updateRecordFieldValueIndex(record);
+
+        if (!changedRecordIdSet.contains(recordId.toString()))
+        {
+            changedRecordIdSet.insert(recordId.toString());
+            changedRecordIds << recordId;
+        }
+    }
+
+    // Notify listeners.
+    for (const QVariant& recordId : changedRecordIds)
+    {
+        emit recordFieldsChanged(recordId);
+    }
+}
+
 void RecordsController::setReadOnly(const QVariant& recordId, const bool readOnly)
 {
     Record& record = *this->getRecordById(recordId);
@@ -647,26 +890,36 @@ void RecordsController::setRecordDisplayName(const QVariant& recordId, const QSt
         return;
     }
 
-    qInfo(qUtf8Printable(QString("Updating record %1 display name to %2.")
+    qCInfo(logRecords, qUtf8Printable(QString("Updating record %1 display name to %2.")
           .arg(recordId.toString(), displayName)));
 
+    this->removeRecordFromIndex(*record);
     record->displayName = displayName;
 
-    // Notify listeners.
-    emit this->recordUpdated(record->id, oldDisplayName, record->editorIconFieldId, record->id, displayName, record->editorIconFieldId);
-
-    // Sort record model to ensure deterministic serialization.
-    bool needsSorting = oldDisplayName != displayName;
-
-    if (needsSorting)
+    // Keep record set sorted to ensure deterministic serialization.
+    for (RecordSetList::iterator it = this->model->begin();
+         it != this->model->end();
+         ++it)
     {
-        for (RecordSetList::iterator it = this->model->begin();
-             it != this->model->end();
-             ++it)
+        RecordSet& recordSet = *it;
+
+        if (recordSet.name != record->recordSetName)
         {
-            std::sort((*it).records.begin(), (*it).records.end(), recordLessThanDisplayName);
+            continue;
         }
+
+        RecordList& records = recordSet.records;
+        const Record renamedRecord = records.takeAt(records.indexOf(*record));
+        const int index = findInsertionIndex(records, renamedRecord, recordLessThanDisplayName);
+        records.insert(index, renamedRecord);
+        record = &records[index];
+        break;
     }
+
+    this->addRecordToIndex(*record);
+
+    // Notify listeners.
+    emit this->recordUpdated(record->id, oldDisplayName, record->editorIconFieldId, record->id, displayName, record->editorIconFieldId);
 }
 
 void RecordsController::setRecordEditorIconFieldId(const QVariant& recordId, const QString& editorIconFieldId)
@@ -679,7 +932,7 @@ void RecordsController::setRecordEditorIconFieldId(const QVariant& recordId, con
         return;
     }
 
-    qInfo(qUtf8Printable(QString("Updating record %1 editor icon field id to %2.")
+    qCInfo(logRecords, qUtf8Printable(QString("Updating record %1 editor icon field id to %2.")
           .arg(recordId.toString(), editorIconFieldId)));
 
     record->editorIconFieldId = editorIconFieldId;
@@ -693,6 +946,7 @@ void RecordsController::setRecordSets(RecordSetList& model)
     this->model = &model;
 
     this->verifyRecordIds();
+    this->rebuildRecordIndex();
 }
 
 void RecordsController::updateRecord(const QVariant oldId,
@@ -716,6 +970,8 @@ void RecordsController::updateRecord(const QVariant oldId,
         Record& newRecord = *this->getRecordById(newId);
         newRecord.fieldValues = oldRecord.fieldValues;
         newRecord.readOnly = oldRecord.readOnly;
+        this->updateRecordHash(newRecord);
+        this->updateRecordFieldValueIndex(newRecord);
 
         this->reparentRecord(newId, oldRecord.parentId);
 
@@ -726,21 +982,13 @@ void RecordsController::updateRecord(const QVariant oldId,
         this->removeRecord(oldId);
     }
 
-    // Update record itself.
-    Record* record = this->getRecordById(newId);
-
-    QVariant recordId = record->id;
-
     // Update record itself.
     setRecordDisplayName(newId, newDisplayName);
-
-    //When setRecordDisplayName is called it can cause our old pointer to now point to the wrong record due to sorting
-    if(record->id != recordId){
-        record = this->getRecordById(newId);
-    }
-
     setRecordEditorIconFieldId(newId, newEditorIconFieldId);
 
+    // Renaming moves the record within its set, so look it up afterwards.
+    Record* record = this->getRecordById(newId);
+
     // Move record, if necessary.
     if (record->recordSetName != newRecordSetName)
     {
@@ -784,29 +1032,253 @@ void RecordsController::updateRecord(const QVariant oldId,
 
 void RecordsController::updateRecordFieldValue(const QVariant& recordId, const QString& fieldId, const QVariant& fieldValue)
 {
-    qInfo(qUtf8Printable(QString("Updating record %1 field %2 to value %3.")
+    qCInfo(logRecords, qUtf8Printable(QString("Updating record %1 field %2 to value %3.")
           .arg(recordId.toString(), fieldId, fieldValue.toString())));
 
     Record& record = *this->getRecordById(recordId);
+    this->applyRecordFieldValue(record, fieldId, fieldValue);
 
-    // Check if equals inherited field value.
-    QVariant inheritedValue = this->getInheritedFieldValue(recordId, fieldId);
+    // Notify listeners.
+    emit recordFieldsChanged(recordId);
+}
 
-    if (inheritedValue == fieldValue)
+void RecordsController::updateRecordFieldValues(const QVariantList& recordIds, const QString& fieldId, const QVariantList& fieldValues)
+{
+    if (recordIds.count() != fieldValues.count())
     {
-        record.fieldValues.remove(fieldId);
+        const QString errorMessage = QString("Expected %1 field values, but got %2.").arg(recordIds.count()).arg(fieldValues.count());
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::invalid_argument(errorMessage.toStdString());
     }
-    else
+
+    qInfo(qUtf8Printable(QString("Updating field %1 of %2 records.").arg(fieldId).arg(recordIds.count())));
+
+    // Update ancestors before their descendants, so descendants compare their new values to the new inherited ones.
+    QList<QPair<int, int>> preOrderIndices;
+
+    for (int i = 0; i < recordIds.count(); ++i)
     {
-        record.fieldValues[fieldId] = fieldValue;
+        int first;
+        int last;
+        this->getHierarchyRange(recordIds[i], first, last);
+
+        preOrderIndices << QPair<int, int>(first, i);
     }
 
-    // Notify listeners.
-    emit recordFieldsChanged(recordId);
-}
+    std::stable_sort(preOrderIndices.begin(), preOrderIndices.end());
 
-void RecordsController::onFieldAdded(const FieldDefinition& fieldDefinition)
+    // Update all records first, so listeners are notified only once per record, with all values already updated.
+    ProgressReporter progress(tr("Updating field values"), recordIds.count(), ProgressReporter::forSignal(this, &RecordsController::progressChanged));
+
+    QVariantList changedRecordIds;
+    QSet<QString> changedRecordIdSet;
+
+    for (int i = 0; i < preOrderIndices.count(); ++i)
+    {
+        const int index = preOrderIndices[i].second;
+        const QVariant& recordId = recordIds[index];
+
+        // Report progress.
+        progress.update(i, recordId.toString());
+
+        Record& record = *this->getRecordById(recordId);
+        this->applyRecordFieldValue(record, fieldId, fieldValues[index]);
+
+        if (!changedRecordIdSet.contains(recordId.toString()))
+        {
+            changedRecordIdSet.insert(recordId.toString());
+            changedRecordIds << recordId;
+        }
+    }
+
+    // Report finish.
+    progress.finish();
+
+    // Notify listeners.
+    for (const QVariant& recordId : changedRecordIds)
+    {
+        emit recordFieldsChanged(recordId);
+    }
+}
+
+bool RecordsController::updateRecordSet(const RecordSet& recordSet)
 {
+    RecordSet* currentRecordSet = nullptr;
+
+    for (RecordSet& existingRecordSet : *this->model)
+    {
+        if (existingRecordSet.name == recordSet.name)
+        {
+            currentRecordSet = &existingRecordSet;
+            break;
+        }
+    }
+
+    if (currentRecordSet == nullptr)
+    {
+        return false;
+    }
+
+    QHash<QString, Record> oldRecords;
+
+    for (const Record& record : currentRecordSet->records)
+    {
+        oldRecords.insert(record.id.toString(), record);
+    }
+
+    // Records moved in from other record sets would have to be removed there first.
+    for (const Record& record : recordSet.records)
+    {
+        const QString key = record.id.toString();
+
+        if (!oldRecords.contains(key) && this->recordIndex.contains(key))
+        {
+            return false;
+        }
+    }
+
+    qInfo(qUtf8Printable(QString("Updating record set %1 with %2 records.")
+          .arg(recordSet.name, QString::number(recordSet.records.count()))));
+
+    // Remember children of removed records, which will become roots of the record tree.
+    QSet<QString> newKeys;
+
+    for (const Record& record : recordSet.records)
+    {
+        newKeys.insert(record.id.toString());
+    }
+
+    QStringList removedKeys;
+    QHash<QString, QVariant> orphanedIds;
+
+    for (const Record& record : currentRecordSet->records)
+    {
+        const QString key = record.id.toString();
+
+        if (!newKeys.contains(key))
+        {
+            removedKeys << key;
+
+            for (const QVariant& childId : this->recordChildIndex.value(key))
+            {
+                orphanedIds.insert(childId.toString(), record.id);
+            }
+        }
+    }
+
+    // Replace records, keeping them sorted by display name.
+    for (const Record& record : currentRecordSet->records)
+    {
+        this->removeRecordFromIndex(record);
+    }
+
+    currentRecordSet->records = recordSet.records;
+    std::stable_sort(currentRecordSet->records.begin(), currentRecordSet->records.end(), recordLessThanDisplayName);
+
+    // Index all records first, in order to be able to detect missing parents.
+    for (Record& record : currentRecordSet->records)
+    {
+        record.recordSetName = currentRecordSet->name;
+        this->recordIndex.insert(record.id.toString(), &record);
+    }
+
+    for (Record& record : currentRecordSet->records)
+    {
+        this->addRecordToIndex(record);
+    }
+
+    // Records of other sets that have lost their parent are treated as roots of the record tree now.
+    for (const QString& removedKey : removedKeys)
+    {
+        const QVariantList childIds = this->recordChildIndex.take(removedKey);
+
+        for (const QVariant& childId : childIds)
+        {
+            this->addRecordToIndex(*this->recordIndex.value(childId.toString()));
+        }
+    }
+
+    // Records of other sets that have found their parent are no longer roots of the record tree.
+    QVariantList adoptedIds;
+
+    if (newKeys.count() > oldRecords.count() - removedKeys.count())
+    {
+        const QVariantList rootIds = this->recordChildIndex.value(QString());
+
+        for (const QVariant& rootId : rootIds)
+        {
+            Record& root = *this->recordIndex.value(rootId.toString());
+
+            if (root.recordSetName != currentRecordSet->name && this->recordIndex.contains(root.parentId.toString()))
+            {
+                this->removeRecordFromIndex(root);
+                this->addRecordToIndex(root);
+                adoptedIds << root.id;
+            }
+        }
+    }
+
+    // Notify listeners.
+    for (const QString& removedKey : removedKeys)
+    {
+        emit this->recordRemoved(oldRecords[removedKey].id);
+    }
+
+    for (const Record& record : recordSet.records)
+    {
+        const QString key = record.id.toString();
+
+        if (!oldRecords.contains(key))
+        {
+            emit this->recordAdded(record.id, record.displayName, record.parentId);
+            continue;
+        }
+
+        const Record& oldRecord = oldRecords[key];
+
+        if (oldRecord.parentId != record.parentId)
+        {
+            emit this->recordReparented(record.id, oldRecord.parentId, record.parentId);
+        }
+
+        if (oldRecord.displayName != record.displayName || oldRecord.editorIconFieldId != record.editorIconFieldId)
+        {
+            emit this->recordUpdated(record.id, oldRecord.displayName, oldRecord.editorIconFieldId,
+                                     record.id, record.displayName, record.editorIconFieldId);
+        }
+
+        if (oldRecord.fieldValues != record.fieldValues || oldRecord.readOnly != record.readOnly)
+        {
+            emit this->recordFieldsChanged(record.id);
+        }
+    }
+
+    for (QHash<QString, QVariant>::const_iterator it = orphanedIds.cbegin(); it != orphanedIds.cend(); ++it)
+    {
+        const Record* orphan = this->recordIndex.value(it.key());
+
+        if (orphan != nullptr && !this->recordIndex.contains(orphan->parentId.toString()))
+        {
+            emit this->recordReparented(orphan->id, it.value(), QVariant());
+        }
+    }
+
+    for (const QVariant& adoptedId : adoptedIds)
+    {
+        emit this->recordReparented(adoptedId, QVariant(), this->getParentId(adoptedId));
+    }
+
+    return true;
+}
+
+void RecordsController::onFieldAdded(const FieldDefinition& fieldDefinition)
+{
+    // Update indexed fields before adding the field to any records.
+    if (!this->recordFieldValueIndexDirty && this->isFieldValueIndexedType(fieldDefinition.fieldType))
+    {
+        this->recordFieldValueIndexFieldIds.insert(fieldDefinition.id);
+    }
+
     this->moveFieldToComponent(fieldDefinition.id, QString(), fieldDefinition.component);
 }
 
@@ -827,11 +1299,15 @@ void RecordsController::onFieldRemoved(const FieldDefinition& fieldDefinition)
             Record& record = recordSet.records[j];
             if (record.fieldValues.remove(fieldDefinition.id) > 0)
             {
+                this->updateRecordHash(record);
+                this->updateRecordFieldValueIndex(record);
                 changedRecords << record.id;
             }
         }
     }
 
+    this->recordFieldValueIndexFieldIds.remove(fieldDefinition.id);
+
     // Notify listeners.
     for (int i = 0; i < changedRecords.count(); ++i)
     {
@@ -841,8 +1317,41 @@ void RecordsController::onFieldRemoved(const FieldDefinition& fieldDefinition)
 
 void RecordsController::onFieldUpdated(const FieldDefinition& oldFieldDefinition, const FieldDefinition& newFieldDefinition)
 {
+    // Update indexed fields before moving any values to the new field id.
+    if (!this->recordFieldValueIndexDirty)
+    {
+        this->recordFieldValueIndexFieldIds.remove(oldFieldDefinition.id);
+
+        if (this->isFieldValueIndexedType(newFieldDefinition.fieldType))
+        {
+            this->recordFieldValueIndexFieldIds.insert(newFieldDefinition.id);
+        }
+    }
+
     this->renameRecordField(oldFieldDefinition.id, newFieldDefinition.id);
     this->moveFieldToComponent(newFieldDefinition.id, oldFieldDefinition.component, newFieldDefinition.component);
+
+    // Re-index values of the field, which might have become searchable or unsearchable.
+    if (oldFieldDefinition.fieldType != newFieldDefinition.fieldType && !this->recordFieldValueIndexDirty)
+    {
+        for (QHash<QString, Record*>::const_iterator it = this->recordIndex.cbegin();
+             it != this->recordIndex.cend();
+             ++it)
+        {
+            if (it.value()->fieldValues.contains(newFieldDefinition.id))
+            {
+                this->updateRecordFieldValueIndex(*it.value());
+            }
+        }
+    }
+}
+
+void RecordsController::onTypeUpdated(const CustomType& type)
+{
+    Q_UNUSED(type)
+
+    // Updated types might change which fields are searchable, so the whole index is rebuilt on the next search.
+    this->invalidateRecordFieldValueIndex();
 }
 
 void RecordsController::addRecordField(const QVariant& recordId, const QString& fieldId)
@@ -851,11 +1360,87 @@ void RecordsController::addRecordField(const QVariant& recordId, const QString&
     const FieldDefinition& field =
             this->fieldDefinitionsController.getFieldDefinition(fieldId);
     record.fieldValues.insert(fieldId, field.defaultValue);
+    this->updateRecordHash(record);
+    this->updateRecordFieldValueIndex(record);
 
     // Notify listeners.
     emit recordFieldsChanged(recordId);
 }
 
+void RecordsController::addRecordToIndex(Record& record)
+{
+    this->recordIndex.insert(record.id.toString(), &record);
+    this->updateRecordHash(record);
+
+    if (!this->recordSearchIndexDirty)
+    {
+        this->recordSearchIndex.insert(record.id.toString(), QStringList() << record.id.toString() << record.displayName);
+    }
+
+    this->updateRecordFieldValueIndex(record);
+
+    // Treat records with missing parents as roots of the record tree.
+    QString parentKey = record.parentId.toString();
+
+    if (!this->recordIndex.contains(parentKey))
+    {
+        parentKey = QString();
+    }
+
+    // Keep children sorted by display name.
+    QVariantList& childIds = this->recordChildIndex[parentKey];
+
+    int first = 0;
+    int last = childIds.count();
+
+    while (first < last)
+    {
+        const int middle = (first + last) / 2;
+        const Record* sibling = this->recordIndex.value(childIds[middle].toString());
+
+        if (recordLessThanDisplayName(*sibling, record))
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    childIds.insert(first, record.id);
+
+    this->invalidateHierarchyLabels();
+}
+
+void RecordsController::applyRecordFieldValue(Record& record, const QString& fieldId, const QVariant& fieldValue)
+{
+    // Check if equals inherited field value.
+    QVariant inheritedValue = this->getInheritedFieldValue(record.id, fieldId);
+
+    if (inheritedValue == fieldValue)
+    {
+        record.fieldValues.remove(fieldId);
+    }
+    else
+    {
+        record.fieldValues[fieldId] = fieldValue;
+    }
+
+    this->updateRecordHash(record);
+    this->updateRecordFieldValueIndex(record);
+}
+
+quint64 RecordsController::computeRecordHash(const Record& record) const
+{
+    // Inherited field values are covered by the hashes of the ancestors and the parent id.
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream << record.id << record.displayName << record.parentId << record.fieldValues;
+
+    return mixHash(fnv1a64(data));
+}
+
 int RecordsController::generateIntegerId()
 {
     return recordIdDistribution(recordIdGenerator);
@@ -866,21 +1451,32 @@ const QString RecordsController::generateUuid() const
     return QUuid::createUuid().toString().mid(1, 36);
 }
 
-Record* RecordsController::getRecordById(const QVariant& id) const
+void RecordsController::getHierarchyRange(const QVariant& id, int& first, int& last) const
 {
-    for (int i = 0; i < this->model->size(); ++i)
+    this->updateHierarchyLabels();
+
+    // All records are descendants of the root of the record tree.
+    if (id.isNull())
     {
-        RecordSet& recordSet = (*this->model)[i];
+        first = 0;
+        last = this->hierarchyOrder.count() - 1;
+        return;
+    }
 
-        for (int j = 0; j < recordSet.records.size(); ++j)
-        {
-            Record& record = recordSet.records[j];
+    const Record* record = this->getRecordById(id);
+    const HierarchyLabel label = this->hierarchyLabels.value(record->id.toString(), HierarchyLabel(id));
 
-            if (record.id == id)
-            {
-                return &record;
-            }
-        }
+    first = label.first + 1;
+    last = label.last;
+}
+
+Record* RecordsController::getRecordById(const QVariant& id) const
+{
+    Record* record = this->recordIndex.value(id.toString());
+
+    if (record != nullptr)
+    {
+        return record;
     }
 
     const QString errorMessage = "Record not found: " + id.toString();
@@ -888,6 +1484,33 @@ Record* RecordsController::getRecordById(const QVariant& id) const
     throw std::out_of_range(errorMessage.toStdString());
 }
 
+void RecordsController::invalidateHierarchyLabels()
+{
+    // Labels are rebuilt on the next query, so a series of changes costs a single traversal of the record tree.
+    this->hierarchyLabelsDirty = true;
+    this->sortedDescendantIndex.clear();
+}
+
+void RecordsController::invalidateRecordFieldValueIndex()
+{
+    this->recordFieldValueIndex.clear();
+    this->recordFieldValueIndexFieldIds.clear();
+    this->recordFieldValueIndexRecordFieldIds.clear();
+    this->recordFieldValueIndexDirty = true;
+}
+
+bool RecordsController::isFieldValueIndexedType(const QString& typeName) const
+{
+    if (this->typesController.isTypeOrDerivedFromType(typeName, BuiltInType::String) ||
+            this->typesController.isTypeOrDerivedFromType(typeName, BuiltInType::File))
+    {
+        return true;
+    }
+
+    return this->typesController.isCustomType(typeName) &&
+            this->typesController.getCustomType(typeName).isEnumeration();
+}
+
 void RecordsController::moveFieldToComponent(const QString& fieldId, const QString& oldComponent, const QString& newComponent)
 {
     if (oldComponent == newComponent)
@@ -980,10 +1603,11 @@ void RecordsController::moveRecordToSet(const QVariant& recordId, const QString&
 {
     QVariant rid = recordId;
 
-    qInfo(qUtf8Printable(QString("Moving record %1 to set %2.")
+    qCInfo(logRecords, qUtf8Printable(QString("Moving record %1 to set %2.")
           .arg(rid.toString(), recordSetName)));
 
     Record record = this->getRecord(rid);
+    this->removeRecordHash(record);
 
     for (RecordSetList::iterator itSets = this->model->begin();
          itSets != this->model->end();
@@ -998,6 +1622,8 @@ void RecordsController::moveRecordToSet(const QVariant& recordId, const QString&
             int index = findInsertionIndex(records, record, recordLessThanDisplayName);
             record.recordSetName = recordSetName;
             records.insert(index, record);
+            this->recordIndex.insert(rid.toString(), &records[index]);
+            this->updateRecordHash(records[index]);
             continue;
         }
         else
@@ -1017,13 +1643,121 @@ void RecordsController::moveRecordToSet(const QVariant& recordId, const QString&
     }
 }
 
+void RecordsController::rebuildRecordIndex()
+{
+    this->recordIndex.clear();
+    this->recordChildIndex.clear();
+    this->invalidateHierarchyLabels();
+    this->recordSearchIndex.clear();
+    this->recordSearchIndexDirty = true;
+    this->invalidateRecordFieldValueIndex();
+    this->recordHashes.clear();
+    this->recordSetHashes.clear();
+
+    // Index all records first, in order to be able to detect missing parents.
+    for (RecordSet& recordSet : *this->model)
+    {
+        for (int i = 0; i < recordSet.records.count(); ++i)
+        {
+            Record& record = recordSet.records[i];
+            this->recordIndex.insert(record.id.toString(), &record);
+            this->updateRecordHash(record);
+        }
+    }
+
+    for (RecordSet& recordSet : *this->model)
+    {
+        for (int i = 0; i < recordSet.records.count(); ++i)
+        {
+            const Record& record = recordSet.records[i];
+
+            // Treat records with missing parents as roots of the record tree.
+            QString parentKey = record.parentId.toString();
+
+            if (!this->recordIndex.contains(parentKey))
+            {
+                parentKey = QString();
+            }
+
+            this->recordChildIndex[parentKey] << record.id;
+        }
+    }
+
+    // Sort children by display name.
+    for (QVariantList& childIds : this->recordChildIndex)
+    {
+        std::stable_sort(childIds.begin(), childIds.end(), [this](const QVariant& lhs, const QVariant& rhs)
+        {
+            return recordLessThanDisplayName(*this->recordIndex.value(lhs.toString()),
+                                             *this->recordIndex.value(rhs.toString()));
+        });
+    }
+}
+
+void RecordsController::removeRecordFromFieldValueIndex(const Record& record) const
+{
+    const QString key = record.id.toString();
+
+    for (const QString& fieldId : this->recordFieldValueIndexRecordFieldIds.take(key))
+    {
+        QHash<QString, FullTextIndex>::iterator it = this->recordFieldValueIndex.find(fieldId);
+
+        if (it == this->recordFieldValueIndex.end())
+        {
+            continue;
+        }
+
+        it.value().remove(key);
+
+        if (it.value().count() == 0)
+        {
+            this->recordFieldValueIndex.erase(it);
+        }
+    }
+}
+
+void RecordsController::removeRecordFromIndex(const Record& record)
+{
+    // Records with missing parents have been indexed as roots of the record tree.
+    QHash<QString, QVariantList>::iterator it = this->recordChildIndex.find(record.parentId.toString());
+
+    if (it == this->recordChildIndex.end() || !it.value().removeOne(record.id))
+    {
+        it = this->recordChildIndex.find(QString());
+
+        if (it != this->recordChildIndex.end())
+        {
+            it.value().removeOne(record.id);
+        }
+    }
+
+    if (it != this->recordChildIndex.end() && it.value().isEmpty())
+    {
+        this->recordChildIndex.erase(it);
+    }
+
+    this->recordIndex.remove(record.id.toString());
+    this->recordSearchIndex.remove(record.id.toString());
+    this->removeRecordFromFieldValueIndex(record);
+    this->invalidateHierarchyLabels();
+    this->removeRecordHash(record);
+}
+
+void RecordsController::removeRecordHash(const Record& record)
+{
+    const quint64 recordHash = this->recordHashes.take(record.id.toString());
+    this->recordSetHashes[record.recordSetName] -= recordHash;
+}
+
 void RecordsController::removeRecordField(const QVariant& recordId, const QString& fieldId)
 {
-    qInfo(qUtf8Printable(QString("Removing field %1 from record %2.")
+    qCInfo(logRecords, qUtf8Printable(QString("Removing field %1 from record %2.")
           .arg(fieldId, recordId.toString())));
 
     Record& record = *this->getRecordById(recordId);
     record.fieldValues.remove(fieldId);
+    this->updateRecordHash(record);
+    this->updateRecordFieldValueIndex(record);
 
     // Remove inherited fields.
     RecordList descendants = this->getDescendents(recordId);
@@ -1053,6 +1787,8 @@ void RecordsController::renameRecordField(const QString oldFieldId, const QStrin
                 const QVariant fieldValue = record.fieldValues[oldFieldId];
                 record.fieldValues.remove(oldFieldId);
                 record.fieldValues.insert(newFieldId, fieldValue);
+                this->updateRecordHash(record);
+                this->updateRecordFieldValueIndex(record);
 
                 // Notify listeners.
                 emit recordFieldsChanged(record.id);
@@ -1063,7 +1799,7 @@ void RecordsController::renameRecordField(const QString oldFieldId, const QStrin
 
 QVariant RecordsController::revertFieldValue(const QVariant& recordId, const QString& fieldId)
 {
-    qInfo(qUtf8Printable(QString("Reverting field %1 of record %2.")
+    qCInfo(logRecords, qUtf8Printable(QString("Reverting field %1 of record %2.")
           .arg(fieldId, recordId.toString())));
 
     // Check if there's anything to revert to.
@@ -1085,6 +1821,124 @@ QVariant RecordsController::revertFieldValue(const QVariant& recordId, const QSt
     return valueToRevertTo;
 }
 
+void RecordsController::updateHierarchyLabels() const
+{
+    QMutexLocker locker(&this->lazyIndexMutex);
+
+    if (!this->hierarchyLabelsDirty)
+    {
+        return;
+    }
+
+    this->hierarchyLabels.clear();
+    this->hierarchyOrder.clear();
+    this->hierarchyOrder.reserve(this->recordIndex.count());
+
+    // Visit records in pre-order, siblings sorted by display name.
+    QVariantList openIds;
+    const QVariantList rootIds = this->recordChildIndex.value(QString());
+
+    for (int i = rootIds.count() - 1; i >= 0; --i)
+    {
+        openIds << rootIds[i];
+    }
+
+    while (!openIds.isEmpty())
+    {
+        const QVariant id = openIds.takeLast();
+        const QString key = id.toString();
+        const Record* record = this->recordIndex.value(key);
+
+        HierarchyLabel label(id);
+        label.first = this->hierarchyOrder.count();
+        label.last = label.first;
+
+        // Records with missing parents are roots of the record tree.
+        QHash<QString, HierarchyLabel>::const_iterator parentLabel = this->hierarchyLabels.constFind(record->parentId.toString());
+
+        if (parentLabel != this->hierarchyLabels.cend())
+        {
+            label.rootId = parentLabel.value().rootId;
+        }
+
+        this->hierarchyLabels.insert(key, label);
+        this->hierarchyOrder << id;
+
+        const QVariantList childIds = this->recordChildIndex.value(key);
+
+        for (int i = childIds.count() - 1; i >= 0; --i)
+        {
+            openIds << childIds[i];
+        }
+    }
+
+    // Extend the intervals of all ancestors to their last descendant, children first.
+    for (int i = this->hierarchyOrder.count() - 1; i >= 0; --i)
+    {
+        const QString key = this->hierarchyOrder[i].toString();
+        const Record* record = this->recordIndex.value(key);
+        QHash<QString, HierarchyLabel>::iterator parentLabel = this->hierarchyLabels.find(record->parentId.toString());
+
+        if (parentLabel != this->hierarchyLabels.end())
+        {
+            parentLabel.value().last = qMax(parentLabel.value().last, this->hierarchyLabels.value(key).last);
+        }
+    }
+
+    this->hierarchyLabelsDirty = false;
+}
+
+void RecordsController::updateRecordFieldValueIndex(const Record& record) const
+{
+    // Index is built from scratch on the next search.
+    if (this->recordFieldValueIndexDirty)
+    {
+        return;
+    }
+
+    this->removeRecordFromFieldValueIndex(record);
+
+    // Only values of searchable fields are indexed, see onFieldUpdated for fields changing their type.
+    const QString key = record.id.toString();
+    QStringList indexedFieldIds;
+
+    for (RecordFieldValueMap::const_iterator it = record.fieldValues.cbegin();
+         it != record.fieldValues.cend();
+         ++it)
+    {
+        if (!this->recordFieldValueIndexFieldIds.contains(it.key()))
+        {
+            continue;
+        }
+
+        const QString text = it.value().toString();
+
+        if (!text.isEmpty())
+        {
+            this->recordFieldValueIndex[it.key()].insert(key, text);
+            indexedFieldIds << it.key();
+        }
+    }
+
+    if (!indexedFieldIds.isEmpty())
+    {
+        this->recordFieldValueIndexRecordFieldIds.insert(key, indexedFieldIds);
+    }
+}
+
+void RecordsController::updateRecordHash(const Record& record)
+{
+    const QString key = record.id.toString();
+    quint64& recordSetHash = this->recordSetHashes[record.recordSetName];
+
+    // Replace the previous hash of the record, if any, in the hash of its record set.
+    recordSetHash -= this->recordHashes.value(key);
+
+    const quint64 recordHash = this->computeRecordHash(record);
+    this->recordHashes[key] = recordHash;
+    recordSetHash += recordHash;
+}
+
 void RecordsController::updateRecordReferences(const QVariant oldReference, const QVariant newReference)
 {
     if (oldReference == newReference)
@@ -1093,6 +1947,7 @@ void RecordsController::updateRecordReferences(const QVariant oldReference, cons
     }
 
     RecordList records = this->getRecords();
+    ProgressReporter progress(tr("Updating references"), records.count() * 2, ProgressReporter::forSignal(this, &RecordsController::progressChanged));
 
     // First pass: update reference fields
     for (int i = 0; i < records.count(); ++i)
@@ -1100,7 +1955,7 @@ void RecordsController::updateRecordReferences(const QVariant oldReference, cons
         const Record& record = records.at(i);
 
         // Report progress.
-        emit this->progressChanged(tr("Updating references"), record.displayName, i, records.count());
+        progress.update(i, record.displayName);
 
         // Update references.
         const RecordFieldValueMap fieldValues = this->getRecordFieldValues(record.id);
@@ -1130,7 +1985,7 @@ void RecordsController::updateRecordReferences(const QVariant oldReference, cons
         const Record& record = records.at(i);
 
         // Report progress.
-        emit this->progressChanged(tr("Reparenting records"), record.displayName, i, records.count());
+        progress.update(records.count() + i, record.displayName);
 
         if (record.parentId == oldReference)
         {
@@ -1139,7 +1994,7 @@ void RecordsController::updateRecordReferences(const QVariant oldReference, cons
     }
 
     // Report finish.
-    emit this->progressChanged(tr("Reparenting records"), QString(), 1, 1);
+    progress.finish();
 }
 
 void RecordsController::verifyRecordIds()
@@ -1169,6 +2024,16 @@ void RecordsController::verifyRecordIntegerIds()
     QSet<qlonglong> recordIntegerIds;
     QList<Record*> recordsWithDuplicateIntegerIds;
 
+    int recordCount = 0;
+
+    for (const RecordSet& recordSet : *this->model)
+    {
+        recordCount += recordSet.records.count();
+    }
+
+    ProgressReporter progress(tr("Verifying Record Ids"), recordCount, ProgressReporter::forSignal(this, &RecordsController::progressChanged));
+    int verifiedRecords = 0;
+
     for (RecordSet& recordSet : *this->model)
     {
         for (int i = 0; i < recordSet.records.count(); ++i)
@@ -1176,7 +2041,7 @@ void RecordsController::verifyRecordIntegerIds()
             Record& record = recordSet.records[i];
             qlonglong recordIntegerId = record.id.toLongLong();
 
-            emit this->progressChanged(tr("Verifying Record Ids - %1").arg(recordSet.name), record.displayName, i, recordSet.records.count());
+            progress.update(verifiedRecords++, record.displayName);
 
             // Verify integer id.
             if (recordIntegerIds.contains(recordIntegerId))
@@ -1213,7 +2078,7 @@ void RecordsController::verifyRecordIntegerIds()
                  .constData());
     }
 
-    emit this->progressChanged(QString(), QString(), 1, 1);
+    progress.finish();
 }
 
 void RecordsController::verifyRecordStringIds()
@@ -1221,13 +2086,23 @@ void RecordsController::verifyRecordStringIds()
     // Ensure unique ids for all records.
     QSet<QString> recordStringIds;
 
+    int recordCount = 0;
+
+    for (const RecordSet& recordSet : *this->model)
+    {
+        recordCount += recordSet.records.count();
+    }
+
+    ProgressReporter progress(tr("Verifying Record Ids"), recordCount, ProgressReporter::forSignal(this, &RecordsController::progressChanged));
+    int verifiedRecords = 0;
+
     for (RecordSet& recordSet : *this->model)
     {
         for (int i = 0; i < recordSet.records.count(); ++i)
         {
             Record& record = recordSet.records[i];
 
-            emit this->progressChanged(tr("Verifying Record Ids - %1").arg(recordSet.name), record.displayName, i, recordSet.records.count());
+            progress.update(verifiedRecords++, record.displayName);
 
             // Verify string id.
             if (recordStringIds.contains(record.id.toString()))
@@ -1241,18 +2116,28 @@ void RecordsController::verifyRecordStringIds()
         }
     }
 
-    emit this->progressChanged(QString(), QString(), 1, 1);
+    progress.finish();
 }
 
 void RecordsController::verifyRecordUuids()
 {
+    int recordCount = 0;
+
+    for (const RecordSet& recordSet : *this->model)
+    {
+        recordCount += recordSet.records.count();
+    }
+
+    ProgressReporter progress(tr("Verifying Record Ids"), recordCount, ProgressReporter::forSignal(this, &RecordsController::progressChanged));
+    int verifiedRecords = 0;
+
     for (RecordSet& recordSet : *this->model)
     {
         for (int i = 0; i < recordSet.records.count(); ++i)
         {
             Record& record = recordSet.records[i];
 
-            emit this->progressChanged(tr("Verifying Record Ids - %1").arg(recordSet.name), record.displayName, i, recordSet.records.count());
+            progress.update(verifiedRecords++, record.displayName);
 
             // Verify UUID.
             if (record.id.isNull())
@@ -1263,5 +2148,5 @@ void RecordsController::verifyRecordUuids()
         }
     }
 
-    emit this->progressChanged(QString(), QString(), 1, 1);
+    progress.finish();
 }
@@ -3,15 +3,22 @@
 
 #include <random>
 
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QSet>
 #include <QStringList>
 
 #include "../Model/recordsetlist.h"
+#include "../../../Util/fulltextindex.h"
+#include "../../../Util/trigramindex.h"
 
 
 namespace Tome
 {
     class FieldDefinition;
     class FieldDefinitionsController;
+    class CustomType;
     class ProjectController;
     class TypesController;
 
@@ -59,8 +66,12 @@ namespace Tome
             void addRecordSet(const RecordSet& recordSet);
 
             /**
-             * @brief Computes an MD5 hash of all current record data.
-             * @return MD5 hash of all current record data, as hex string.
+             * @brief Gets a hash of all current record data.
+             *
+             * Record hashes are updated whenever records are changed, and combined per record set and per project,
+             * so getting the hash of all records doesn't require visiting them again.
+             *
+             * @return Hash of all current record data, as hex string.
              */
             const QString computeRecordsHash() const;
 
@@ -75,6 +86,30 @@ namespace Tome
              */
             const Record duplicateRecord(const QVariant& existingRecordId, const QVariant& newRecordId);
 
+            /**
+             * @brief Finds all records whose id or display name contain the specified string, ignoring case.
+             *
+             * Looks up candidates in an index of the substrings of all record ids and display names, which is built on first request
+             * after loading a project, and kept up-to-date afterwards.
+             *
+             * @param searchPattern String to search for.
+             * @return Ids of all records whose id or display name contain the specified string, in no particular order.
+             */
+            const QVariantList findRecordIds(const QString& searchPattern) const;
+
+            /**
+             * @brief Finds all records whose values of the specified fields contain words starting with each word of the specified query, ignoring case.
+             *
+             * Looks up values in an inverted index of the words of the own field values of all records, which is built on first request
+             * after loading a project, and kept up-to-date afterwards. Records inheriting a matching value are found as well.
+             * Only values of string, enumeration and file fields are indexed.
+             *
+             * @param query Words to search for.
+             * @param fieldIds Ids of the fields to search the values of.
+             * @return Ids of all records with matching field values, by field id.
+             */
+            const QMap<QString, QVariantList> findRecordFieldValues(const QString& query, const QStringList& fieldIds) const;
+
             /**
              * @brief Gets the list of all ancestors of the record with the specified id, direct parent first.
              *
@@ -87,6 +122,20 @@ namespace Tome
              */
             const RecordList getAncestors(const QVariant& id) const;
 
+            /**
+             * @brief Gets the names of all record sets whose data differs from the passed record set hashes.
+             * @param previousRecordSetHashes Hashes of the record sets to compare with, as returned by getRecordSetHashes.
+             * @return Names of all record sets that have been added or changed since the passed hashes have been taken.
+             */
+            const QStringList getChangedRecordSetNames(const QMap<QString, QString>& previousRecordSetHashes) const;
+
+            /**
+             * @brief Gets the ids of all records that have the record with the specified id as parent, sorted by display name.
+             * @param id Id of the record to get the children of, or null to get the roots of the record tree.
+             * @return Ids of all records that have the record with the specified id as parent, sorted by display name.
+             */
+            const QVariantList getChildIds(const QVariant& id) const;
+
             /**
              * @brief Gets the list of all records that have the record with the specified id as parent.
              * @param id Id of the record to get the children of.
@@ -128,6 +177,12 @@ namespace Tome
              */
             const QVariant getParentId(const QVariant& id) const;
 
+            /**
+             * @brief Gets the hashes of the data of all record sets in the project.
+             * @return Map of record set names and the hashes of their data, as hex strings.
+             */
+            const QMap<QString, QString> getRecordSetHashes() const;
+
             /**
              * @brief Gets a list of all record sets in the project.
              * @return List of all record sets in the project.
@@ -194,6 +249,19 @@ namespace Tome
              */
             const RecordFieldValueMap getRecordFieldValues(const QVariant& id) const;
 
+            /**
+             * @brief Returns the actual value of the specified field of the record with the specified id, which might be inherited.
+             *
+             * @throws std::out_of_range if the record with the specified id could not be found.
+             *
+             * @see hasRecord for checking whether a record with the specified id exists.
+             *
+             * @param id Id of the record the get the field value of.
+             * @param fieldId Id of the field to get the value of.
+             * @return Actual value of the specified field of the record with the specified id.
+             */
+            const QVariant getRecordFieldValue(const QVariant& id, const QString& fieldId) const;
+
             /**
              * @brief Gets the id of the root of the record with the specified id.
              * @param id Id of the record to get the root of.
@@ -201,6 +269,16 @@ namespace Tome
              */
             const QVariant getRootRecordId(const QVariant& id) const;
 
+            /**
+             * @brief Gets the ids of all descendants of the record with the specified id, sorted by display name.
+             *
+             * Sorted lists are built on first request and shared until the record hierarchy or any display name changes.
+             *
+             * @param id Id of the record to get the descendants of, or null to get all records.
+             * @return Ids of all descendants of the record with the specified id, sorted by display name.
+             */
+            const QVariantList getSortedDescendantIds(const QVariant& id) const;
+
             /**
              * @brief Checks whether the project has a record with the specified id.
              * @param id Id of the record to look for.
@@ -217,6 +295,9 @@ namespace Tome
 
             /**
              * @brief Checks whether the first record is an ancestor of the second one.
+             *
+             * Takes constant time, unless the hierarchy has changed since the last query.
+             *
              * @param possibleAncestor Record to check if it is an ancestor.
              * @param recordId Record to check the ancestors of.
              * @return true, if the first record is an ancestor of the second one, and false otherwise.
@@ -258,6 +339,34 @@ namespace Tome
              */
             void reparentRecord(const QVariant& recordId, const QVariant& newParentId);
 
+            /**
+             * @brief Changes the parents of many records at once.
+             *
+             * All moves are validated before any record is changed, and listeners are notified only once afterwards.
+             *
+             * @throws std::out_of_range if any record to reparent or any new parent could not be found.
+             * @throws std::invalid_argument if the number of record ids and parent ids differs, or any record would become its own ancestor.
+             *
+             * @param recordIds Ids of the records to change the parent of.
+             * @param newParentIds Ids of the new parents of the records, one for each record.
+             */
+            void reparentRecords(const QVariantList& recordIds, const QVariantList& newParentIds);
+
+            /**
+             * @brief Restores the own values of the same field of many records exactly, e.g. when undoing updateRecordFieldValues.
+             *
+             * Unlike updateRecordFieldValues, values equal to the inherited ones are kept, and records without own value are reverted to inheriting the field.
+             * Listeners are notified only once per record, after all values have been restored.
+             *
+             * @throws std::out_of_range if any of the records with the specified ids could not be found.
+             * @throws std::invalid_argument if the number of record ids and field values differs.
+             *
+             * @param recordIds Ids of the records to restore the field value of.
+             * @param fieldId Id of the field to restore the value of.
+             * @param ownFieldValues Own values of the field to restore, one for each record, or null for records inheriting the field.
+             */
+            void restoreRecordFieldValues(const QVariantList& recordIds, const QString& fieldId, const QVariantList& ownFieldValues);
+
             /**
              * @brief Marks the record with the specified id as read-only or not, preventing it from being edited, reparented or removed.
              *
@@ -337,6 +446,31 @@ namespace Tome
              */
             void updateRecordFieldValue(const QVariant& recordId, const QString& fieldId, const QVariant& fieldValue);
 
+            /**
+             * @brief Updates the current value of the same field of many records at once.
+             *
+             * Records are updated ancestors first, so values equal to the ones inherited from other updated records are always dropped.
+             * Listeners are notified only once per record, after all values have been updated.
+             *
+             * @throws std::out_of_range if any of the records with the specified ids could not be found.
+             * @throws std::invalid_argument if the number of record ids and field values differs.
+             *
+             * @param recordIds Ids of the records to update the field value of.
+             * @param fieldId Id of the field to update the value of.
+             * @param fieldValues New values of the field to update, one for each record.
+             */
+            void updateRecordFieldValues(const QVariantList& recordIds, const QString& fieldId, const QVariantList& fieldValues);
+
+            /**
+             * @brief Replaces the records of the record set with the same name by the records of the specified set, e.g. after the record set file has been changed outside of Tome.
+             *
+             * Only records that have actually been added, removed or changed cause listeners to be notified.
+             *
+             * @param recordSet Record set to take the records from.
+             * @return true, if the records could be updated, and false, if the record set could not be found, or records have been moved between record sets, and the whole project needs to be reloaded instead.
+             */
+            bool updateRecordSet(const RecordSet& recordSet);
+
         signals:
             /**
              * @brief Progress of the current record operation has changed.
@@ -375,6 +509,12 @@ namespace Tome
              */
             void recordReparented(const QVariant& recordId, const QVariant& oldParentId, const QVariant& newParentId);
 
+            /**
+             * @brief The parents of many records have changed at once.
+             * @param recordIds Ids of the records whose parents have changed.
+             */
+            void recordsReparented(const QVariantList& recordIds);
+
             /**
              * @brief The properties of a record have been updated.
              * @param oldId Previous id of the record which has been updated.
@@ -400,10 +540,66 @@ namespace Tome
             void onFieldAdded(const Tome::FieldDefinition& fieldDefinition);
             void onFieldRemoved(const Tome::FieldDefinition& fieldDefinition);
             void onFieldUpdated(const Tome::FieldDefinition& oldFieldDefinition, const Tome::FieldDefinition& newFieldDefinition);
+            void onTypeUpdated(const Tome::CustomType& type);
 
         private:
+            /**
+             * @brief Position of a record in the pre-order of the record tree.
+             */
+            class HierarchyLabel
+            {
+                public:
+                    HierarchyLabel(const QVariant& rootId = QVariant()) : first(-1), last(-2), rootId(rootId) {}
+
+                    /**
+                     * @brief Pre-order index of the record itself.
+                     */
+                    int first;
+
+                    /**
+                     * @brief Pre-order index of the last descendant of the record, or of the record itself if it has no children.
+                     */
+                    int last;
+
+                    /**
+                     * @brief Id of the root of the record tree the record belongs to.
+                     */
+                    QVariant rootId;
+            };
+
             RecordSetList* model;
 
+            // Records are stored in node-based lists, so their addresses remain stable
+            // until they are removed from or moved between record sets.
+            QHash<QString, Record*> recordIndex;
+            QHash<QString, QVariantList> recordChildIndex;
+
+            // Guards building the lazy indexes below, which happens behind const queries that may be run from worker threads, e.g. by tasks.
+            mutable QMutex lazyIndexMutex;
+
+            // Pre-order intervals of all records, and all record ids in pre-order.
+            // Built on demand and discarded whenever the hierarchy changes, along with sorted descendants by record id.
+            mutable QHash<QString, HierarchyLabel> hierarchyLabels;
+            mutable QVariantList hierarchyOrder;
+            mutable bool hierarchyLabelsDirty;
+            mutable QHash<QString, QVariantList> sortedDescendantIndex;
+
+            // Substrings of the ids and display names of all records. Built on demand after loading, and updated incrementally afterwards.
+            mutable TrigramIndex recordSearchIndex;
+            mutable bool recordSearchIndexDirty;
+
+            // Words of the own field values of all records, by field id. Built on demand after loading, and updated incrementally afterwards.
+            // Ids of the fields whose values are indexed, and ids of the fields each record has been indexed under, by record id.
+            mutable QHash<QString, FullTextIndex> recordFieldValueIndex;
+            mutable QSet<QString> recordFieldValueIndexFieldIds;
+            mutable QHash<QString, QStringList> recordFieldValueIndexRecordFieldIds;
+            mutable bool recordFieldValueIndexDirty;
+
+            // Hashes of the own data of all records, and their sums per record set.
+            // Sums are independent of the record order, which allows updating them in constant time.
+            QHash<QString, quint64> recordHashes;
+            QHash<QString, quint64> recordSetHashes;
+
             const FieldDefinitionsController& fieldDefinitionsController;
             const ProjectController& projectController;
             const TypesController& typesController;
@@ -412,14 +608,28 @@ namespace Tome
             std::uniform_int_distribution<int> recordIdDistribution;
 
             void addRecordField(const QVariant& recordId, const QString& fieldId);
+            void addRecordToIndex(Record& record);
+            void applyRecordFieldValue(Record& record, const QString& fieldId, const QVariant& fieldValue);
+            quint64 computeRecordHash(const Record& record) const;
             int generateIntegerId();
             const QString generateUuid() const;
+            void getHierarchyRange(const QVariant& id, int& first, int& last) const;
             Record* getRecordById(const QVariant& id) const;
+            void invalidateHierarchyLabels();
+            void invalidateRecordFieldValueIndex();
+            bool isFieldValueIndexedType(const QString& typeName) const;
             void moveFieldToComponent(const QString& fieldId, const QString& oldComponent, const QString& newComponent);
             void moveRecordToSet(const QVariant& recordId, const QString& recordSetName);
+            void rebuildRecordIndex();
+            void removeRecordFromFieldValueIndex(const Record& record) const;
+            void removeRecordFromIndex(const Record& record);
+            void removeRecordHash(const Record& record);
             void removeRecordField(const QVariant& recordId, const QString& fieldId);
             void renameRecordField(const QString oldFieldId, const QString newFieldId);
             QVariant revertFieldValue(const QVariant& recordId, const QString& fieldId);
+            void updateHierarchyLabels() const;
+            void updateRecordFieldValueIndex(const Record& record) const;
+            void updateRecordHash(const Record& record);
             void updateRecordReferences(const QVariant oldReference, const QVariant newReference);
             void verifyRecordIds();
             void verifyRecordIntegerIds();
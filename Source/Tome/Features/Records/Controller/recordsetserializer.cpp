@@ -3,7 +3,9 @@
 #include <QXmlStreamWriter>
 
 #include "../Model/recordset.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../../IO/xmlreader.h"
+#include "../../../Util/progressreporter.h"
 
 using namespace Tome;
 
@@ -22,10 +24,14 @@ const QString RecordSetSerializer::ElementValue = "Value";
 
 void RecordSetSerializer::serialize(QIODevice& device, const RecordSet& recordSet) const
 {
+    TOME_TRACE("Serialization", "serializeRecordSet");
+
     // Open device stream.
     QXmlStreamWriter stream(&device);
     stream.setAutoFormatting(true);
 
+    ProgressReporter progress(tr("Saving Data"), recordSet.records.size(), ProgressReporter::forSignal(this, &RecordSetSerializer::progressChanged));
+
     // Begin document.
     stream.writeStartDocument();
     {
@@ -42,7 +48,7 @@ void RecordSetSerializer::serialize(QIODevice& device, const RecordSet& recordSe
                 const Record& record = sortedRecords[i];
 
                 // Report progress.
-                emit progressChanged(tr("Saving Data"), record.displayName, i, sortedRecords.size());
+                progress.update(i, record.displayName);
 
                 // Begin record.
                 stream.writeStartElement(ElementRecord);
@@ -121,14 +127,18 @@ void RecordSetSerializer::serialize(QIODevice& device, const RecordSet& recordSe
     stream.writeEndDocument();
 
     // Report finish.
-    emit progressChanged(tr("Saving Data"), QString(), 1, 1);
+    progress.finish();
 }
 
 void RecordSetSerializer::deserialize(QIODevice& device, RecordSet& recordSet) const
 {
+    TOME_TRACE("Serialization", "deserializeRecordSet");
+
     // Open device stream.
     XmlReader reader(&device);
 
+    ProgressReporter progress(tr("Loading Data"), static_cast<int>(device.size()), ProgressReporter::forSignal(this, &RecordSetSerializer::progressChanged));
+
     // Begin document.
     reader.readStartDocument();
     {
@@ -150,7 +160,7 @@ void RecordSetSerializer::deserialize(QIODevice& device, RecordSet& recordSet) c
                 record.recordSetName = recordSet.name;
 
                 // Report progress.
-                emit progressChanged(tr("Loading Data"), record.displayName, device.pos(), device.size());
+                progress.update(static_cast<int>(device.pos()), record.displayName);
 
                 reader.readStartElement(ElementRecord);
 
@@ -216,5 +226,5 @@ void RecordSetSerializer::deserialize(QIODevice& device, RecordSet& recordSet) c
     reader.readEndDocument();
 
     // Report finish.
-    emit progressChanged(tr("Loading Data"), QString(), 1, 1);
+    progress.finish();
 }
@@ -0,0 +1,221 @@
+#include "thumbnailcontroller.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QRunnable>
+#include <QStandardPaths>
+
+using namespace Tome;
+
+
+const int ThumbnailController::FailedThumbnailRetryIntervalInMilliseconds = 5000;
+const int ThumbnailController::MaximumCacheSizeInKilobytes = 32 * 1024;
+const int ThumbnailController::ThumbnailSize = 64;
+
+
+namespace Tome
+{
+    /**
+     * @brief Gets the key to cache the thumbnail of the specified file by, which changes whenever the file is modified.
+     * @param fileInfo Image file to get the cache key of the thumbnail for.
+     * @return Key to cache the thumbnail of the specified file by.
+     */
+    static QString getThumbnailCacheKey(const QFileInfo& fileInfo)
+    {
+        return QString("%1|%2").arg(fileInfo.absoluteFilePath(), QString::number(fileInfo.lastModified().toMSecsSinceEpoch()));
+    }
+
+    /**
+     * @brief Loads a single thumbnail on a worker thread, and passes it back to the thumbnail controller.
+     */
+    class ThumbnailLoader : public QRunnable
+    {
+        public:
+            ThumbnailLoader(ThumbnailController* thumbnailController,
+                            const QString& filePath,
+                            const QString& cacheKey,
+                            const QString& thumbnailCachePath,
+                            int thumbnailSize)
+                : thumbnailController(thumbnailController),
+                  filePath(filePath),
+                  cacheKey(cacheKey),
+                  thumbnailCachePath(thumbnailCachePath),
+                  thumbnailSize(thumbnailSize)
+            {
+            }
+
+            void run() Q_DECL_OVERRIDE
+            {
+                const QImage thumbnail = this->loadThumbnail();
+
+                QMetaObject::invokeMethod(this->thumbnailController,
+                                          "onThumbnailLoaded",
+                                          Qt::QueuedConnection,
+                                          Q_ARG(QString, this->filePath),
+                                          Q_ARG(QString, this->cacheKey),
+                                          Q_ARG(QImage, thumbnail));
+            }
+
+        private:
+            ThumbnailController* thumbnailController;
+            QString filePath;
+            QString cacheKey;
+            QString thumbnailCachePath;
+            int thumbnailSize;
+
+            QImage loadThumbnail() const
+            {
+                QFileInfo fileInfo(this->filePath);
+
+                if (!fileInfo.exists())
+                {
+                    return QImage();
+                }
+
+                // Check disk cache.
+                QString cachedThumbnailPath;
+
+                if (!this->thumbnailCachePath.isEmpty())
+                {
+                    const QByteArray hash = QCryptographicHash::hash(this->cacheKey.toUtf8(), QCryptographicHash::Md5).toHex();
+
+                    cachedThumbnailPath = QDir(this->thumbnailCachePath).filePath(QString::fromLatin1(hash) + ".png");
+
+                    QImage cachedThumbnail;
+
+                    if (QFileInfo(cachedThumbnailPath).exists() && cachedThumbnail.load(cachedThumbnailPath))
+                    {
+                        return cachedThumbnail;
+                    }
+                }
+
+                // Read image, scaling it down while decoding if the format supports it.
+                QImageReader reader(this->filePath);
+                const QSize thumbnailSize(this->thumbnailSize, this->thumbnailSize);
+                const QSize imageSize = reader.size();
+
+                if (imageSize.isValid() &&
+                        (imageSize.width() > thumbnailSize.width() || imageSize.height() > thumbnailSize.height()))
+                {
+                    reader.setScaledSize(imageSize.scaled(thumbnailSize, Qt::KeepAspectRatio));
+                }
+
+                QImage thumbnail = reader.read();
+
+                if (thumbnail.isNull())
+                {
+                    return thumbnail;
+                }
+
+                if (thumbnail.width() > thumbnailSize.width() || thumbnail.height() > thumbnailSize.height())
+                {
+                    thumbnail = thumbnail.scaled(thumbnailSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+                }
+
+                // Update disk cache.
+                if (!cachedThumbnailPath.isEmpty())
+                {
+                    thumbnail.save(cachedThumbnailPath, "PNG");
+                }
+
+                return thumbnail;
+            }
+    };
+}
+
+
+ThumbnailController::ThumbnailController()
+    : thumbnails(MaximumCacheSizeInKilobytes)
+{
+    const QString cachePath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+
+    if (!cachePath.isEmpty())
+    {
+        const QString thumbnailCachePath = QDir(cachePath).filePath("Thumbnails");
+
+        if (QDir().mkpath(thumbnailCachePath))
+        {
+            this->thumbnailCachePath = thumbnailCachePath;
+        }
+    }
+}
+
+ThumbnailController::~ThumbnailController()
+{
+    // Don't start loading any more thumbnails, and wait for the current ones.
+    this->threadPool.clear();
+    this->threadPool.waitForDone();
+}
+
+const QImage ThumbnailController::getThumbnail(const QString& filePath)
+{
+    // Files modified since their thumbnails have been loaded have new keys, and are loaded again.
+    const QString cacheKey = getThumbnailCacheKey(QFileInfo(filePath));
+    QImage* thumbnail = this->thumbnails.object(cacheKey);
+
+    if (thumbnail != nullptr)
+    {
+        return *thumbnail;
+    }
+
+    // Don't hit the disk for unreadable files on every request, but pick up files that are being written or added.
+    QHash<QString, QDateTime>::iterator itFailed = this->failedThumbnails.find(cacheKey);
+
+    if (itFailed != this->failedThumbnails.end())
+    {
+        if (itFailed.value().msecsTo(QDateTime::currentDateTimeUtc()) < FailedThumbnailRetryIntervalInMilliseconds)
+        {
+            return QImage();
+        }
+
+        this->failedThumbnails.erase(itFailed);
+    }
+
+    if (!this->loadingThumbnails.contains(filePath))
+    {
+        this->loadingThumbnails.insert(filePath);
+        this->threadPool.start(new ThumbnailLoader(this, filePath, cacheKey, this->thumbnailCachePath, ThumbnailSize));
+    }
+
+    return QImage();
+}
+
+bool ThumbnailController::isImageFile(const QString& filePath)
+{
+    if (this->imageFileExtensions.isEmpty())
+    {
+        const QList<QByteArray> supportedImageFormats = QImageReader::supportedImageFormats();
+
+        for (const QByteArray& format : supportedImageFormats)
+        {
+            this->imageFileExtensions.insert(QString::fromLatin1(format).toLower());
+        }
+    }
+
+    return this->imageFileExtensions.contains(QFileInfo(filePath).suffix().toLower());
+}
+
+bool ThumbnailController::isLoadingThumbnail(const QString& filePath) const
+{
+    return this->loadingThumbnails.contains(filePath);
+}
+
+void ThumbnailController::onThumbnailLoaded(const QString& filePath, const QString& cacheKey, const QImage& thumbnail)
+{
+    this->loadingThumbnails.remove(filePath);
+
+    if (thumbnail.isNull())
+    {
+        this->failedThumbnails.insert(cacheKey, QDateTime::currentDateTimeUtc());
+    }
+    else
+    {
+        const int cost = int(thumbnail.sizeInBytes() / 1024) + 1;
+        this->thumbnails.insert(cacheKey, new QImage(thumbnail), cost);
+    }
+
+    emit this->thumbnailLoaded(filePath);
+}
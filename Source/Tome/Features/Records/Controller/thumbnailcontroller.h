@@ -0,0 +1,87 @@
+#ifndef THUMBNAILCONTROLLER_H
+#define THUMBNAILCONTROLLER_H
+
+#include <QCache>
+#include <QDateTime>
+#include <QHash>
+#include <QImage>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QThreadPool>
+
+namespace Tome
+{
+    /**
+     * @brief Controller for loading thumbnails of image files in the background.
+     *
+     * Thumbnails are kept in an in-memory cache with least-recently-used eviction,
+     * and on disk in the user cache directory, both keyed by file path and modification time,
+     * so changed files are loaded again. Files that could not be read are retried after a short while.
+     */
+    class ThumbnailController : public QObject
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new controller for loading thumbnails of image files in the background.
+             */
+            ThumbnailController();
+            ~ThumbnailController();
+
+            /**
+             * @brief Gets the thumbnail of the image file at the specified path.
+             *
+             * If the thumbnail has not been loaded yet, starts loading it in the background and returns a null image.
+             * thumbnailLoaded is emitted as soon as the thumbnail is available.
+             *
+             * @see isLoadingThumbnail for checking whether a null image is a placeholder for a thumbnail that is still being loaded.
+             *
+             * @param filePath Full path of the image file to get the thumbnail of.
+             * @return Thumbnail of the image file, or a null image if the thumbnail is still being loaded or the file could not be read.
+             */
+            const QImage getThumbnail(const QString& filePath);
+
+            /**
+             * @brief Checks whether the file at the specified path has the extension of any supported image format.
+             * @param filePath Path of the file to check.
+             * @return true, if the file at the specified path has the extension of any supported image format, and false otherwise.
+             */
+            bool isImageFile(const QString& filePath);
+
+            /**
+             * @brief Checks whether the thumbnail of the image file at the specified path is currently being loaded.
+             * @param filePath Full path of the image file to check.
+             * @return true, if the thumbnail of the image file at the specified path is currently being loaded, and false otherwise.
+             */
+            bool isLoadingThumbnail(const QString& filePath) const;
+
+        signals:
+            /**
+             * @brief The thumbnail of an image file has been loaded, or has failed to load.
+             * @param filePath Full path of the image file whose thumbnail has been loaded.
+             */
+            void thumbnailLoaded(const QString& filePath);
+
+        private slots:
+            void onThumbnailLoaded(const QString& filePath, const QString& cacheKey, const QImage& thumbnail);
+
+        private:
+            static const int FailedThumbnailRetryIntervalInMilliseconds;
+            static const int MaximumCacheSizeInKilobytes;
+            static const int ThumbnailSize;
+
+            QSet<QString> imageFileExtensions;
+            QSet<QString> loadingThumbnails;
+
+            // Thumbnails, and times of failed attempts to load them, by file path and modification time.
+            QCache<QString, QImage> thumbnails;
+            QHash<QString, QDateTime> failedThumbnails;
+
+            QString thumbnailCachePath;
+            QThreadPool threadPool;
+    };
+}
+
+#endif // THUMBNAILCONTROLLER_H
@@ -0,0 +1,436 @@
+#include "recordfieldstablemodel.h"
+
+#include <QColor>
+
+#include "../Controller/recordscontroller.h"
+#include "../../Facets/Controller/facetscontroller.h"
+#include "../../Facets/Controller/removedfileprefixfacet.h"
+#include "../../Facets/Controller/removedfilesuffixfacet.h"
+#include "../../Fields/Controller/fielddefinitionscontroller.h"
+#include "../../Projects/Controller/projectcontroller.h"
+#include "../../Types/Controller/typescontroller.h"
+#include "../../Types/Model/builtintype.h"
+#include "../../Types/Model/customtype.h"
+#include "../../../Util/listutils.h"
+#include "../../../Util/pathutils.h"
+#include "../../../Util/stringutils.h"
+
+
+using namespace Tome;
+
+
+RecordFieldsTableModel::RecordFieldsTableModel(FieldDefinitionsController& fieldDefinitionsController,
+                                               FacetsController& facetsController,
+                                               ProjectController& projectController,
+                                               RecordsController& recordsController,
+                                               TypesController& typesController)
+    : facetsController(facetsController),
+      fieldDefinitionsController(fieldDefinitionsController),
+      projectController(projectController),
+      recordsController(recordsController),
+      typesController(typesController),
+      descriptionColumnEnabled(false),
+      showComponentNames(false)
+{
+}
+
+int RecordFieldsTableModel::columnCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return this->descriptionColumnEnabled ? 3 : 2;
+}
+
+QVariant RecordFieldsTableModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= this->rows.count())
+    {
+        return QVariant();
+    }
+
+    const RecordFieldsTableRow& row = this->rows[index.row()];
+
+    switch (role)
+    {
+        case Qt::DisplayRole:
+            switch (index.column())
+            {
+                case 0:
+                    return row.keyString;
+
+                case 1:
+                    // Hyperlinks are shown by index widgets of the view.
+                    return row.hasValueLink ? QVariant() : row.valueString;
+
+                case 2:
+                    return row.fieldDescription;
+            }
+            break;
+
+        case Qt::DecorationRole:
+            // Show color preview.
+            if (index.column() == 1 && row.fieldType == BuiltInType::Color)
+            {
+                return row.value.value<QColor>();
+            }
+            break;
+
+        case Qt::ToolTipRole:
+            // Show field description as tooltip.
+            if (!this->descriptionColumnEnabled && index.column() < 2)
+            {
+                return row.fieldDescription;
+            }
+            break;
+
+        case Qt::UserRole:
+            // Store field id in UserRole, so we always know which row is representing which field.
+            return row.fieldId;
+    }
+
+    return QVariant();
+}
+
+QVariant RecordFieldsTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+    {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section)
+    {
+        case 0:
+            return tr("Field");
+
+        case 1:
+            return tr("Value");
+
+        case 2:
+            return tr("Description");
+    }
+
+    return QVariant();
+}
+
+int RecordFieldsTableModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return this->rows.count();
+}
+
+QString RecordFieldsTableModel::getFieldId(int row) const
+{
+    return this->rows[row].fieldId;
+}
+
+QString RecordFieldsTableModel::getFilePath(int row) const
+{
+    return this->rows[row].filePath;
+}
+
+QString RecordFieldsTableModel::getValueHref(int row) const
+{
+    return this->rows[row].valueHref;
+}
+
+bool RecordFieldsTableModel::hasValueLink(int row) const
+{
+    return this->rows[row].hasValueLink;
+}
+
+void RecordFieldsTableModel::setDescriptionColumnEnabled(bool enabled)
+{
+    if (this->descriptionColumnEnabled == enabled)
+    {
+        return;
+    }
+
+    if (enabled)
+    {
+        this->beginInsertColumns(QModelIndex(), 2, 2);
+        this->descriptionColumnEnabled = true;
+        this->endInsertColumns();
+    }
+    else
+    {
+        this->beginRemoveColumns(QModelIndex(), 2, 2);
+        this->descriptionColumnEnabled = false;
+        this->endRemoveColumns();
+    }
+}
+
+void RecordFieldsTableModel::setRecord(const QVariant& recordId)
+{
+    // Get field values.
+    RecordFieldValueMap fieldValues;
+
+    if (!recordId.isNull() && this->recordsController.hasRecord(recordId))
+    {
+        fieldValues = this->recordsController.getRecordFieldValues(recordId);
+    }
+
+    const FieldDefinitionList fields = this->getSortedFields(fieldValues);
+
+    // Check if we're showing the same fields as before.
+    bool sameFields = recordId == this->recordId && fields.count() == this->rows.count();
+
+    for (int i = 0; sameFields && i < fields.count(); ++i)
+    {
+        sameFields = fields[i].id == this->rows[i].fieldId;
+    }
+
+    if (sameFields)
+    {
+        // Update changed rows only.
+        for (int i = 0; i < fields.count(); ++i)
+        {
+            if (this->updateRow(this->rows[i], fields[i], fieldValues[fields[i].id]))
+            {
+                emit this->dataChanged(this->index(i, 0), this->index(i, this->columnCount() - 1));
+            }
+        }
+
+        return;
+    }
+
+    // Rebuild all rows.
+    this->beginResetModel();
+
+    this->recordId = recordId;
+    this->rows.clear();
+    this->rows.reserve(fields.count());
+
+    for (const FieldDefinition& field : fields)
+    {
+        RecordFieldsTableRow row;
+        this->updateRow(row, field, fieldValues[field.id]);
+        this->rows << row;
+    }
+
+    this->endResetModel();
+}
+
+void RecordFieldsTableModel::setShowComponentNames(bool showComponentNames)
+{
+    if (this->showComponentNames == showComponentNames)
+    {
+        return;
+    }
+
+    // Affects both order and names of all fields.
+    this->beginResetModel();
+    this->showComponentNames = showComponentNames;
+    this->rows.clear();
+    this->endResetModel();
+
+    this->setRecord(this->recordId);
+}
+
+void RecordFieldsTableModel::updateFieldValue(int row)
+{
+    if (row < 0 || row >= this->rows.count() || !this->recordsController.hasRecord(this->recordId))
+    {
+        return;
+    }
+
+    const QString fieldId = this->rows[row].fieldId;
+
+    if (!this->fieldDefinitionsController.hasFieldDefinition(fieldId))
+    {
+        return;
+    }
+
+    const FieldDefinition& field = this->fieldDefinitionsController.getFieldDefinition(fieldId);
+    const QVariant value = this->recordsController.getRecordFieldValue(this->recordId, fieldId);
+
+    if (this->updateRow(this->rows[row], field, value))
+    {
+        emit this->dataChanged(this->index(row, 0), this->index(row, this->columnCount() - 1));
+    }
+}
+
+const FieldDefinitionList RecordFieldsTableModel::getSortedFields(const RecordFieldValueMap& fieldValues) const
+{
+    FieldDefinitionList fields;
+    fields.reserve(fieldValues.count());
+
+    for (RecordFieldValueMap::const_iterator it = fieldValues.cbegin();
+         it != fieldValues.cend();
+         ++it)
+    {
+        const QString fieldId = it.key();
+        const FieldDefinition& field = this->fieldDefinitionsController.getFieldDefinition(fieldId);
+
+        fields << field;
+    }
+
+    // Sort by display name and component.
+    if (this->showComponentNames)
+    {
+        std::sort(fields.begin(), fields.end(), fieldDefinitionLessThanComponentAndDisplayName);
+    }
+
+    return fields;
+}
+
+const QString RecordFieldsTableModel::getFieldKeyString(const FieldDefinition& field) const
+{
+    if (!this->showComponentNames || field.component.isEmpty())
+    {
+        return field.displayName;
+    }
+
+    QString shortComponentName = field.component;
+    shortComponentName.replace("component", "");
+    shortComponentName.replace("Component", "");
+    shortComponentName = splitAtCapitalLetters(shortComponentName);
+    return QString("%1 - %2").arg(shortComponentName, field.displayName);
+}
+
+const QString RecordFieldsTableModel::getRecordDisplayName(const QVariant& recordId) const
+{
+    if (this->recordsController.hasRecord(recordId))
+    {
+        const Record& record = this->recordsController.getRecord(recordId);
+        return record.displayName;
+    }
+
+    return recordId.toString();
+}
+
+bool RecordFieldsTableModel::updateRow(RecordFieldsTableModel::RecordFieldsTableRow& row,
+                                       const FieldDefinition& field,
+                                       const QVariant& value) const
+{
+    // Check if any input has changed. Display names of referenced records might have changed at any time.
+    const bool inputChanged =
+            row.fieldId != field.id ||
+            row.fieldComponent != field.component ||
+            row.fieldDisplayName != field.displayName ||
+            row.fieldDescription != field.description ||
+            row.fieldType != field.fieldType ||
+            row.value != value;
+
+    if (!inputChanged && !row.referencesRecords)
+    {
+        return false;
+    }
+
+    const QString oldValueString = row.valueString;
+    const QString oldValueHref = row.valueHref;
+
+    row.fieldId = field.id;
+    row.fieldComponent = field.component;
+    row.fieldDisplayName = field.displayName;
+    row.fieldDescription = field.description;
+    row.fieldType = field.fieldType;
+    row.value = value;
+
+    // Compose key string.
+    row.keyString = this->getFieldKeyString(field);
+
+    // Compose value string.
+    QString valueString;
+    row.referencesRecords = false;
+
+    if (this->typesController.isCustomType(field.fieldType))
+    {
+        const CustomType& customType = this->typesController.getCustomType(field.fieldType);
+
+        if (customType.isList())
+        {
+            if (this->typesController.isTypeOrDerivedFromType(customType.getItemType(), BuiltInType::Reference))
+            {
+                // Replace by list of record display names.
+                QVariantList recordIds = value.toList();
+                QVariantList recordDisplayNames;
+
+                for (const QVariant& recordId : recordIds)
+                {
+                    recordDisplayNames << this->getRecordDisplayName(recordId);
+                }
+
+                valueString = toString(recordDisplayNames);
+                row.referencesRecords = true;
+            }
+        }
+        else if (customType.isMap())
+        {
+            bool hasReferenceKeys = this->typesController.isTypeOrDerivedFromType(customType.getKeyType(), BuiltInType::Reference);
+            bool hasReferenceValues = this->typesController.isTypeOrDerivedFromType(customType.getValueType(), BuiltInType::Reference);
+
+            if (hasReferenceKeys || hasReferenceValues)
+            {
+                // Replace by map of record display names.
+                QVariantMap valueMap = value.toMap();
+                QVariantMap valueMapWithDisplayNames;
+
+                for (QVariantMap::const_iterator it = valueMap.cbegin();
+                     it != valueMap.cend();
+                     ++it)
+                {
+                    const QString keyString = hasReferenceKeys
+                            ? this->getRecordDisplayName(QVariant(it.key()))
+                            : it.key();
+                    const QString valueString = hasReferenceValues
+                            ? this->getRecordDisplayName(it.value())
+                            : it.value().toString();
+
+                    // Insert into display map.
+                    valueMapWithDisplayNames.insert(keyString, valueString);
+                }
+
+                valueString = toString(valueMapWithDisplayNames);
+                row.referencesRecords = true;
+            }
+        }
+    }
+
+    if (valueString.isEmpty())
+    {
+        valueString = this->typesController.valueToString(value, field.fieldType);
+    }
+
+    row.valueString = valueString;
+
+    // Compose hyperlinks for reference and file fields.
+    row.valueHref = QString();
+    row.filePath = QString();
+    row.hasValueLink = false;
+
+    if (this->typesController.isTypeOrDerivedFromType(field.fieldType, BuiltInType::Reference))
+    {
+        if (this->recordsController.hasRecord(value))
+        {
+            const Record& record = this->recordsController.getRecord(value);
+            row.valueHref = QString("<a href='%1'>%2</a>").arg(record.id.toString(), record.displayName);
+        }
+
+        row.hasValueLink = true;
+        row.referencesRecords = true;
+    }
+    else if (this->typesController.isTypeOrDerivedFromType(field.fieldType, BuiltInType::File))
+    {
+        // Build full file path.
+        QString removedPrefix = this->facetsController.getFacetValue(field.fieldType, RemovedFilePrefixFacet::FacetKey).toString();
+        QString removedSuffix = this->facetsController.getFacetValue(field.fieldType, RemovedFileSuffixFacet::FacetKey).toString();
+
+        QString fileName = removedPrefix + valueString + removedSuffix;
+        QString projectPath = this->projectController.getProjectPath();
+
+        row.filePath = combinePaths(projectPath, fileName);
+        row.valueHref = "<a href='" + row.filePath + "'>" + valueString + "</a>";
+        row.hasValueLink = true;
+    }
+
+    // Records referenced by unchanged values might not have been renamed.
+    return inputChanged || oldValueString != row.valueString || oldValueHref != row.valueHref;
+}
@@ -0,0 +1,139 @@
+#ifndef RECORDFIELDSTABLEMODEL_H
+#define RECORDFIELDSTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QList>
+
+#include "../Model/recordfieldvaluemap.h"
+#include "../../Fields/Model/fielddefinitionlist.h"
+
+namespace Tome
+{
+    class FacetsController;
+    class FieldDefinitionsController;
+    class ProjectController;
+    class RecordsController;
+    class TypesController;
+
+    /**
+     * @brief Model of the field values of a single record.
+     *
+     * Display strings are resolved once per field value and reused until the value, or the field definition, changes.
+     */
+    class RecordFieldsTableModel : public QAbstractTableModel
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new model of the field values of a single record.
+             * @param fieldDefinitionsController Controller for adding, updating and removing field definitions.
+             * @param facetsController Controller for validating type facets.
+             * @param projectController Controller for creating, loading and saving projects.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param typesController Controller for adding, updating and removing custom types.
+             */
+            RecordFieldsTableModel(FieldDefinitionsController& fieldDefinitionsController,
+                                   FacetsController& facetsController,
+                                   ProjectController& projectController,
+                                   RecordsController& recordsController,
+                                   TypesController& typesController);
+
+            int columnCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+            QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+            QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+            int rowCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Gets the id of the field shown in the specified row.
+             * @param row Row to get the field id of.
+             * @return Id of the field shown in the specified row.
+             */
+            QString getFieldId(int row) const;
+
+            /**
+             * @brief Gets the full path of the file referenced by the field shown in the specified row.
+             * @param row Row to get the file path of.
+             * @return Full path of the file referenced by the field shown in the specified row, or an empty string if the field is not a file field.
+             */
+            QString getFilePath(int row) const;
+
+            /**
+             * @brief Gets the hyperlink to show for the value of the field in the specified row.
+             * @param row Row to get the hyperlink of.
+             * @return Hyperlink to show for the value of the field in the specified row, or an empty string if the field is not a reference or file field, or the referenced record does not exist.
+             */
+            QString getValueHref(int row) const;
+
+            /**
+             * @brief Checks whether the value of the field in the specified row should be shown as hyperlink.
+             * @param row Row to check.
+             * @return true, if the field in the specified row is a reference or file field, and false otherwise.
+             */
+            bool hasValueLink(int row) const;
+
+            /**
+             * @brief Sets whether to show an additional column with the description of all record fields, or not.
+             * @param enabled Whether to show an additional column with the description of all record fields, or not.
+             */
+            void setDescriptionColumnEnabled(bool enabled);
+
+            /**
+             * @brief Sets the record to show the field values of.
+             *
+             * If the record and its fields are the same as before, only rows whose values have changed are updated.
+             *
+             * @param recordId Id of the record to show the field values of, or null for showing an empty table.
+             */
+            void setRecord(const QVariant& recordId);
+
+            /**
+             * @brief Sets whether to show the names of the respective component in front of the field name, or not.
+             * @param showComponentNames Whether to show the names of the respective component in front of the field name, or not.
+             */
+            void setShowComponentNames(bool showComponentNames);
+
+            /**
+             * @brief Resolves the value of the field in the specified row again, and updates the row if it has changed.
+             * @param row Row to update.
+             */
+            void updateFieldValue(int row);
+
+        private:
+            class RecordFieldsTableRow
+            {
+                public:
+                    QString fieldId;
+                    QString fieldComponent;
+                    QString fieldDisplayName;
+                    QString fieldDescription;
+                    QString fieldType;
+                    QVariant value;
+
+                    QString keyString;
+                    QString valueString;
+                    QString valueHref;
+                    QString filePath;
+                    bool hasValueLink = false;
+                    bool referencesRecords = false;
+            };
+
+            FacetsController& facetsController;
+            FieldDefinitionsController& fieldDefinitionsController;
+            ProjectController& projectController;
+            RecordsController& recordsController;
+            TypesController& typesController;
+
+            QVariant recordId;
+            QList<RecordFieldsTableRow> rows;
+            bool descriptionColumnEnabled;
+            bool showComponentNames;
+
+            const FieldDefinitionList getSortedFields(const RecordFieldValueMap& fieldValues) const;
+            const QString getFieldKeyString(const FieldDefinition& field) const;
+            const QString getRecordDisplayName(const QVariant& recordId) const;
+            bool updateRow(RecordFieldsTableRow& row, const FieldDefinition& field, const QVariant& value) const;
+    };
+}
+
+#endif // RECORDFIELDSTABLEMODEL_H
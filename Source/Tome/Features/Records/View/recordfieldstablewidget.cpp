@@ -1,25 +1,12 @@
 #include "recordfieldstablewidget.h"
 
 #include <QHeaderView>
-#include <QImageReader>
 #include <QLabel>
 #include <QPixmap>
 
 #include "labeledpixmapwidget.h"
-#include "../Controller/recordscontroller.h"
-#include "../Model/recordfieldvaluemap.h"
-#include "../../Facets/Controller/facetscontroller.h"
-#include "../../Facets/Controller/removedfileprefixfacet.h"
-#include "../../Facets/Controller/removedfilesuffixfacet.h"
-#include "../../Fields/Controller/fielddefinitionscontroller.h"
-#include "../../Fields/Model/fielddefinition.h"
-#include "../../Projects/Controller/projectcontroller.h"
-#include "../../Types/Controller/typescontroller.h"
-#include "../../Types/Model/builtintype.h"
-#include "../../Types/Model/customtype.h"
-#include "../../../Util/listutils.h"
-#include "../../../Util/pathutils.h"
-#include "../../../Util/stringutils.h"
+#include "recordfieldstablemodel.h"
+#include "../Controller/thumbnailcontroller.h"
 
 
 using namespace Tome;
@@ -29,15 +16,32 @@ RecordFieldsTableWidget::RecordFieldsTableWidget(FieldDefinitionsController& fie
                                                  FacetsController& facetsController,
                                                  ProjectController& projectController,
                                                  RecordsController& recordsController,
-                                                 TypesController& typesController)
-    : facetsController(facetsController),
-      fieldDefinitionsController(fieldDefinitionsController),
-      projectController(projectController),
-      recordsController(recordsController),
-      typesController(typesController),
-      recordId(QString()),
-      showComponentNames(false)
+                                                 TypesController& typesController,
+                                                 ThumbnailController& thumbnailController)
+    : thumbnailController(thumbnailController)
 {
+    this->recordFieldsTableModel = new RecordFieldsTableModel(fieldDefinitionsController,
+                                                              facetsController,
+                                                              projectController,
+                                                              recordsController,
+                                                              typesController);
+    this->setModel(this->recordFieldsTableModel);
+
+    connect(
+                this->recordFieldsTableModel,
+                SIGNAL(modelReset()),
+                SLOT(onModelReset()));
+
+    connect(
+                this->recordFieldsTableModel,
+                SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&)),
+                SLOT(onDataChanged(const QModelIndex&, const QModelIndex&)));
+
+    connect(
+                &this->thumbnailController,
+                SIGNAL(thumbnailLoaded(const QString&)),
+                SLOT(onThumbnailLoaded(const QString&)));
+
     this->setEditTriggers(QAbstractItemView::NoEditTriggers);
     this->setSelectionMode(QAbstractItemView::SingleSelection);
     this->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -45,272 +49,105 @@ RecordFieldsTableWidget::RecordFieldsTableWidget(FieldDefinitionsController& fie
     this->verticalHeader()->setVisible(false);
 }
 
-void RecordFieldsTableWidget::setDescriptionColumnEnabled(bool enabled)
+RecordFieldsTableWidget::~RecordFieldsTableWidget()
 {
-    // Set headers.
-    QStringList headers;
-    headers << tr("Field");
-    headers << tr("Value");
-
-    if (enabled)
-    {
-        headers << tr("Description");
-    }
-
-    this->setColumnCount(headers.count());
-    this->setHorizontalHeaderLabels(headers);
+    delete this->recordFieldsTableModel;
 }
 
-void RecordFieldsTableWidget::setRecord(const QVariant recordId)
+QString RecordFieldsTableWidget::getSelectedFieldId() const
 {
-    this->recordId = recordId;
+    const QModelIndexList selectedRows = this->selectionModel()->selectedRows();
 
-    // Get field values.
-    const RecordFieldValueMap fieldValues =
-            this->recordsController.getRecordFieldValues(recordId);
-
-    // Sort by display name and component.
-    FieldDefinitionList fields;
-
-    for (RecordFieldValueMap::const_iterator it = fieldValues.cbegin();
-         it != fieldValues.cend();
-         ++it)
+    if (selectedRows.empty())
     {
-        const QString fieldId = it.key();
-        const FieldDefinition& field = this->fieldDefinitionsController.getFieldDefinition(fieldId);
-
-        fields << field;
+        return QString();
     }
 
-    if (this->showComponentNames)
-    {
-        std::sort(fields.begin(), fields.end(), fieldDefinitionLessThanComponentAndDisplayName);
-    }
-
-    // Populate table.
-    this->setRowCount(fields.size());
-
-    for (int i = 0; i < this->rowCount(); ++i)
-    {
-        for (int j = 0; j < this->columnCount(); ++j)
-        {
-            this->setItem(i, j, new QTableWidgetItem());
-
-            // Store field id in UserRole, so we always know which row is representing which field.
-            this->item(i, j)->setData(Qt::UserRole, fields[i].id);
-        }
-    }
+    return this->recordFieldsTableModel->getFieldId(selectedRows.first().row());
+}
 
-    // Update entries.
-    for (int i = 0; i < this->rowCount(); ++i)
-    {
-        this->updateFieldValue(i);
-    }
+void RecordFieldsTableWidget::setDescriptionColumnEnabled(bool enabled)
+{
+    this->recordFieldsTableModel->setDescriptionColumnEnabled(enabled);
+}
 
-    // Resize first column.
-    this->resizeColumnToContents(0);
+void RecordFieldsTableWidget::setRecord(const QVariant recordId)
+{
+    this->recordFieldsTableModel->setRecord(recordId);
 }
 
 void RecordFieldsTableWidget::setShowComponentNames(bool showComponentNames)
 {
-    this->showComponentNames = showComponentNames;
+    this->recordFieldsTableModel->setShowComponentNames(showComponentNames);
 }
 
 void RecordFieldsTableWidget::updateFieldValue(int i)
 {
-    // Get record field values.
-    const RecordFieldValueMap fieldValues =
-            this->recordsController.getRecordFieldValues(recordId);
-
-    // Get selected record field key and value.
-    QString key = this->item(i, 0)->data(Qt::UserRole).toString();
-    QVariant value = fieldValues[key];
-
-    // Get selected record field type.
-    const FieldDefinition& field =
-            this->fieldDefinitionsController.getFieldDefinition(key);
-
-    // Compose key string.
-    QString keyString = this->getFieldKeyString(field);
-
-    // Compose value string.
-    QString valueString;
+    this->recordFieldsTableModel->updateFieldValue(i);
+}
 
-    if (this->typesController.isCustomType(field.fieldType))
+void RecordFieldsTableWidget::updateValueWidgets(int firstRow, int lastRow)
+{
+    for (int i = firstRow; i <= lastRow; ++i)
     {
-        const CustomType& customType = this->typesController.getCustomType(field.fieldType);
-
-        if (customType.isList())
-        {
-            if (this->typesController.isTypeOrDerivedFromType(customType.getItemType(), BuiltInType::Reference))
-            {
-                // Replace by list of record display names.
-                QVariantList recordIds = value.toList();
-                QVariantList recordDisplayNames;
-
-                for (const QVariant& recordId : recordIds)
-                {
-                    if (this->recordsController.hasRecord(recordId))
-                    {
-                        const Record& record = this->recordsController.getRecord(recordId);
-                        recordDisplayNames << record.displayName;
-                    }
-                    else
-                    {
-                        recordDisplayNames << recordId.toString();
-                    }
-                }
-
-                valueString = toString(recordDisplayNames);
-            }
-        }
-        else if (customType.isMap())
+        // Remove any existing index widget.
+        QModelIndex index = this->recordFieldsTableModel->index(i, 1);
+        QWidget *indexWidget = this->indexWidget(index);
+        if (nullptr != indexWidget)
         {
-            bool hasReferenceKeys = this->typesController.isTypeOrDerivedFromType(customType.getKeyType(), BuiltInType::Reference);
-            bool hasReferenceValues = this->typesController.isTypeOrDerivedFromType(customType.getValueType(), BuiltInType::Reference);
-
-            if (hasReferenceKeys || hasReferenceValues)
-            {
-                // Replace by map of record display names.
-                QVariantMap valueMap = value.toMap();
-                QVariantMap valueMapWithDisplayNames;
-
-                for (QVariantMap::const_iterator it = valueMap.cbegin();
-                     it != valueMap.cend();
-                     ++it)
-                {
-                    // Make key string.
-                    QString keyString;
-
-                    if (hasReferenceKeys)
-                    {
-                        QVariant recordId = QVariant(it.key());
-
-                        if (this->recordsController.hasRecord(recordId))
-                        {
-                            const Record& record = this->recordsController.getRecord(recordId);
-                            keyString = record.displayName;
-                        }
-                        else
-                        {
-                            keyString = recordId.toString();
-                        }
-                    }
-                    else
-                    {
-                        keyString = it.key();
-                    }
-
-                    // Make value string.
-                    QString valueString;
-
-                    if (hasReferenceValues)
-                    {
-                        QVariant recordId = it.value();
-
-                        if (this->recordsController.hasRecord(recordId))
-                        {
-                            const Record& record = this->recordsController.getRecord(recordId);
-                            valueString = record.displayName;
-                        }
-                        else
-                        {
-                            valueString = recordId.toString();
-                        }
-                    }
-                    else
-                    {
-                        valueString = it.value().toString();
-                    }
-
-                    // Insert into display map.
-                    valueMapWithDisplayNames.insert(keyString, valueString);
-                }
-
-                valueString = toString(valueMapWithDisplayNames);
-            }
+            this->setIndexWidget(index, nullptr);
+            delete indexWidget;
         }
-    }
-
-    if (valueString.isEmpty())
-    {
-        valueString = this->typesController.valueToString(value, field.fieldType);
-    }
-
-    // Show field name.
-    this->item(i, 0)->setData(Qt::DisplayRole, keyString);
-
-    // Remove any existing index widget.
-    QModelIndex index = this->model()->index(i, 1);
-    QWidget *indexWidget = this->indexWidget(index);
-    if (nullptr != indexWidget)
-    {
-        this->setIndexWidget(index, nullptr);
-        delete indexWidget;
-    }
-
-    // Show hyperlink for reference fields, and normal text for other fields.
-    if (this->typesController.isTypeOrDerivedFromType(field.fieldType, BuiltInType::Reference))
-    {
-        QString href;
 
-        if (this->recordsController.hasRecord(value))
+        // Show hyperlink for reference and file fields, and normal text for other fields.
+        if (!this->recordFieldsTableModel->hasValueLink(i))
         {
-            const Record& record = this->recordsController.getRecord(value);
-            href = QString("<a href='%1'>%2</a>").arg(record.id.toString(), record.displayName);
+            continue;
         }
 
-        QModelIndex index = this->model()->index(i, 1);
-
-        // Create new index widget.
-        QLabel* valueLabel = new QLabel(href);
+        const QString href = this->recordFieldsTableModel->getValueHref(i);
+        const QString fileName = this->recordFieldsTableModel->getFilePath(i);
 
-        connect(
-                    valueLabel,
-                    SIGNAL(linkActivated(const QString&)),
-                    SLOT(onRecordLinkActivated(const QString&))
-                    );
-
-        // Add margin for increased readability.
-        valueLabel->setMargin(5);
-        this->setIndexWidget(index, valueLabel);
-    }
-    else if (this->typesController.isTypeOrDerivedFromType(field.fieldType, BuiltInType::File))
-    {
-        // Build full file path.
-        QString removedPrefix;
-        QString removedSuffix;
-
-        removedPrefix = this->facetsController.getFacetValue(field.fieldType, RemovedFilePrefixFacet::FacetKey).toString();
-        removedSuffix = this->facetsController.getFacetValue(field.fieldType, RemovedFileSuffixFacet::FacetKey).toString();
+        if (fileName.isEmpty())
+        {
+            // Create new index widget.
+            QLabel* valueLabel = new QLabel(href);
 
-        QString fileName = removedPrefix + valueString + removedSuffix;
-        QString projectPath = this->projectController.getProjectPath();
+            connect(
+                        valueLabel,
+                        SIGNAL(linkActivated(const QString&)),
+                        SLOT(onRecordLinkActivated(const QString&))
+                        );
 
-        fileName = combinePaths(projectPath, fileName);
+            // Add margin for increased readability.
+            valueLabel->setMargin(5);
+            this->setIndexWidget(index, valueLabel);
+            continue;
+        }
 
-        // Get preview.
+        // Get preview, leaving room for it until it has been loaded in the background.
         QPixmap preview;
+        bool previewPending = false;
 
-        QList<QByteArray> supportedImageFormats = QImageReader::supportedImageFormats();
-        for (QByteArray& format : supportedImageFormats)
+        if (this->thumbnailController.isImageFile(fileName))
         {
-            if (fileName.endsWith(format))
+            preview = QPixmap::fromImage(this->thumbnailController.getThumbnail(fileName));
+
+            if (preview.isNull() && this->thumbnailController.isLoadingThumbnail(fileName))
             {
-                preview.load(fileName);
+                previewPending = true;
 
-                if (!preview.isNull())
+                if (!this->pendingThumbnails.contains(fileName, i))
                 {
-                    break;
+                    this->pendingThumbnails.insert(fileName, i);
                 }
             }
         }
 
         // Show file path.
-        QString href = "<a href='" + fileName + "'>" + valueString + "</a>";
         QWidget* widget;
 
-        if (!preview.isNull())
+        if (!preview.isNull() || previewPending)
         {
             // Create new labeled pixmap.
             LabeledPixmapWidget* labeledPixmap = new LabeledPixmapWidget(this);
@@ -344,51 +181,13 @@ void RecordFieldsTableWidget::updateFieldValue(int i)
             widget = valueLabel;
         }
 
-        QModelIndex index = this->model()->index(i, 1);
         this->setIndexWidget(index, widget);
     }
-    else
-    {
-        // Show normal text.
-        this->item(i, 1)->setData(Qt::DisplayRole, valueString);
-
-        // Show color preview.
-        if (field.fieldType == BuiltInType::Color)
-        {
-            QColor color = value.value<QColor>();
-            this->item(i, 1)->setData(Qt::DecorationRole, color);
-        }
-    }
-
-    // Show field description.
-    if (this->columnCount() > 2)
-    {
-        // Show field description as column.
-        this->item(i, 2)->setData(Qt::DisplayRole, field.description);
-    }
-    else
-    {
-        // Show field description as tooltip.
-        this->item(i, 0)->setData(Qt::ToolTipRole, field.description);
-        this->item(i, 1)->setData(Qt::ToolTipRole, field.description);
-    }
-
-    // Resize columns.
-    this->horizontalHeader()->setStretchLastSection(true);
 }
 
-const QString RecordFieldsTableWidget::getFieldKeyString(const FieldDefinition& field)
+void RecordFieldsTableWidget::onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight)
 {
-    if (!this->showComponentNames || field.component.isEmpty())
-    {
-        return field.displayName;
-    }
-
-    QString shortComponentName = field.component;
-    shortComponentName.replace("component", "");
-    shortComponentName.replace("Component", "");
-    shortComponentName = splitAtCapitalLetters(shortComponentName);
-    return QString("%1 - %2").arg(shortComponentName, field.displayName);
+    this->updateValueWidgets(topLeft.row(), bottomRight.row());
 }
 
 void RecordFieldsTableWidget::onFileLinkActivated(const QString& filePath)
@@ -396,7 +195,32 @@ void RecordFieldsTableWidget::onFileLinkActivated(const QString& filePath)
     emit this->fileLinkActivated(filePath);
 }
 
+void RecordFieldsTableWidget::onModelReset()
+{
+    this->pendingThumbnails.clear();
+
+    // Index widgets have been discarded by the view.
+    this->updateValueWidgets(0, this->recordFieldsTableModel->rowCount() - 1);
+
+    // Resize first column.
+    this->resizeColumnToContents(0);
+}
+
 void RecordFieldsTableWidget::onRecordLinkActivated(const QString& recordId)
 {
     emit this->recordLinkActivated(recordId);
 }
+
+void RecordFieldsTableWidget::onThumbnailLoaded(const QString& filePath)
+{
+    const QList<int> rows = this->pendingThumbnails.values(filePath);
+    this->pendingThumbnails.remove(filePath);
+
+    for (int row : rows)
+    {
+        if (row < this->recordFieldsTableModel->rowCount())
+        {
+            this->updateValueWidgets(row, row);
+        }
+    }
+}
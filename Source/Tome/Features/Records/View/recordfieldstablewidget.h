@@ -1,21 +1,23 @@
 #ifndef RECORDFIELDSTABLEWIDGET_H
 #define RECORDFIELDSTABLEWIDGET_H
 
-#include <QTableWidget>
+#include <QMultiHash>
+#include <QTableView>
 
 namespace Tome
 {
     class FacetsController;
-    class FieldDefinition;
     class FieldDefinitionsController;
     class ProjectController;
+    class RecordFieldsTableModel;
     class RecordsController;
+    class ThumbnailController;
     class TypesController;
 
     /**
      * @brief Allows editing the values of all fields of a record.
      */
-    class RecordFieldsTableWidget : public QTableWidget
+    class RecordFieldsTableWidget : public QTableView
     {
         Q_OBJECT
 
@@ -27,12 +29,21 @@ namespace Tome
              * @param projectController Controller for creating, loading and saving projects.
              * @param recordsController Controller for adding, updating and removing records.
              * @param typesController Controller for adding, updating and removing custom types.
+             * @param thumbnailController Controller for loading file previews in the background.
              */
             RecordFieldsTableWidget(FieldDefinitionsController& fieldDefinitionsController,
                                     FacetsController& facetsController,
                                     ProjectController& projectController,
                                     RecordsController& recordsController,
-                                    TypesController& typesController);
+                                    TypesController& typesController,
+                                    ThumbnailController& thumbnailController);
+            ~RecordFieldsTableWidget();
+
+            /**
+             * @brief Gets the id of the currently selected field.
+             * @return Id of the currently selected field, or an empty string if no field is selected.
+             */
+            QString getSelectedFieldId() const;
 
             /**
              * @brief Sets whether to show an additional column with the description of all record fields, or not.
@@ -42,7 +53,10 @@ namespace Tome
 
             /**
              * @brief Sets the record to edit the field values of.
-             * @param recordId Id of the record to edit the field values of.
+             *
+             * If the record is already shown, only rows whose values have changed are updated.
+             *
+             * @param recordId Id of the record to edit the field values of, or null for clearing the table.
              */
             void setRecord(const QVariant recordId);
 
@@ -72,20 +86,23 @@ namespace Tome
             void recordLinkActivated(const QString& recordId);
 
         private:
-            FacetsController& facetsController;
-            FieldDefinitionsController& fieldDefinitionsController;
-            ProjectController& projectController;
-            RecordsController& recordsController;
-            TypesController& typesController;
+            ThumbnailController& thumbnailController;
 
-            QVariant recordId;
-            bool showComponentNames;
+            RecordFieldsTableModel* recordFieldsTableModel;
+
+            /**
+             * @brief Rows waiting for the preview of the image file with the given path.
+             */
+            QMultiHash<QString, int> pendingThumbnails;
 
-            const QString getFieldKeyString(const FieldDefinition& field);
+            void updateValueWidgets(int firstRow, int lastRow);
 
         private slots:
+            void onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight);
             void onFileLinkActivated(const QString& filePath);
+            void onModelReset();
             void onRecordLinkActivated(const QString& recordId);
+            void onThumbnailLoaded(const QString& filePath);
     };
 }
 
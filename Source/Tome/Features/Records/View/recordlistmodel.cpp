@@ -0,0 +1,144 @@
+#include "recordlistmodel.h"
+
+#include "../Controller/recordscontroller.h"
+
+using namespace Tome;
+
+
+const int RecordListModel::FetchBatchSize = 100;
+
+
+RecordListModel::RecordListModel(const RecordsController& recordsController, QObject* parent)
+    : QAbstractListModel(parent),
+      recordsController(recordsController),
+      nextRecordIndex(0)
+{
+}
+
+bool RecordListModel::canFetchMore(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+    {
+        return false;
+    }
+
+    return this->nextRecordIndex < this->recordIds.count();
+}
+
+QVariant RecordListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= this->rowIds.count())
+    {
+        return QVariant();
+    }
+
+    const QVariant& recordId = this->rowIds[index.row()];
+
+    // Records may have been removed since they have been fetched.
+    if (!this->recordsController.hasRecord(recordId))
+    {
+        return QVariant();
+    }
+
+    switch (role)
+    {
+        case Qt::DisplayRole:
+        case Qt::EditRole:
+            return this->recordsController.getRecord(recordId).displayName;
+
+        case Qt::ToolTipRole:
+            return recordId;
+
+        case Qt::UserRole:
+            return recordId;
+    }
+
+    return QVariant();
+}
+
+void RecordListModel::fetchMore(const QModelIndex& parent)
+{
+    if (parent.isValid())
+    {
+        return;
+    }
+
+    // Collect next batch of records matching the filter.
+    QVariantList fetchedIds;
+
+    while (this->nextRecordIndex < this->recordIds.count() && fetchedIds.count() < FetchBatchSize)
+    {
+        const QVariant& recordId = this->recordIds[this->nextRecordIndex];
+        ++this->nextRecordIndex;
+
+        if (!this->recordsController.hasRecord(recordId))
+        {
+            continue;
+        }
+
+        if (this->filterText.isEmpty() ||
+                this->recordsController.getRecord(recordId).displayName.contains(this->filterText, Qt::CaseInsensitive))
+        {
+            fetchedIds << recordId;
+        }
+    }
+
+    if (fetchedIds.isEmpty())
+    {
+        return;
+    }
+
+    // Add rows.
+    const int firstRow = this->rowIds.count();
+
+    this->beginInsertRows(QModelIndex(), firstRow, firstRow + fetchedIds.count() - 1);
+    this->rowIds << fetchedIds;
+    this->endInsertRows();
+}
+
+int RecordListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return this->rowIds.count();
+}
+
+QVariant RecordListModel::getRecordId(const QModelIndex& index) const
+{
+    if (!index.isValid() || index.row() >= this->rowIds.count())
+    {
+        return QVariant();
+    }
+
+    return this->rowIds[index.row()];
+}
+
+void RecordListModel::setFilterText(const QString& filterText)
+{
+    if (this->filterText == filterText)
+    {
+        return;
+    }
+
+    this->beginResetModel();
+
+    this->filterText = filterText;
+    this->rowIds.clear();
+    this->nextRecordIndex = 0;
+
+    this->endResetModel();
+}
+
+void RecordListModel::setRecordIds(const QVariantList& recordIds)
+{
+    this->beginResetModel();
+
+    this->recordIds = recordIds;
+    this->rowIds.clear();
+    this->nextRecordIndex = 0;
+
+    this->endResetModel();
+}
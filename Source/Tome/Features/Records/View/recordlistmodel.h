@@ -0,0 +1,67 @@
+#ifndef RECORDLISTMODEL_H
+#define RECORDLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QString>
+#include <QVariantList>
+
+namespace Tome
+{
+    class RecordsController;
+
+    /**
+     * @brief Flat list of records, optionally filtered by display name.
+     *
+     * Rows are fetched lazily in batches as views scroll down, so only the records that are actually shown are looked up and filtered.
+     */
+    class RecordListModel : public QAbstractListModel
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new flat list of records.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param parent Optional owner object.
+             */
+            RecordListModel(const RecordsController& recordsController, QObject* parent = 0);
+
+            bool canFetchMore(const QModelIndex& parent) const Q_DECL_OVERRIDE;
+            QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+            void fetchMore(const QModelIndex& parent) Q_DECL_OVERRIDE;
+            int rowCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Gets the id of the record at the specified index.
+             * @param index Index to get the record id of.
+             * @return Id of the record at the specified index, or null if the index is invalid.
+             */
+            QVariant getRecordId(const QModelIndex& index) const;
+
+            /**
+             * @brief Only shows records whose display name contains the specified text, ignoring case.
+             * @param filterText Text to look for, or an empty string to show all records.
+             */
+            void setFilterText(const QString& filterText);
+
+            /**
+             * @brief Sets the records to show, discarding all rows fetched so far.
+             * @param recordIds Ids of the records to show, in the order to show them in (e.g. as returned by RecordsController::getSortedDescendantIds).
+             */
+            void setRecordIds(const QVariantList& recordIds);
+
+        private:
+            static const int FetchBatchSize;
+
+            const RecordsController& recordsController;
+
+            QVariantList recordIds;
+            QString filterText;
+
+            // Ids of all rows fetched so far, and position in recordIds to continue fetching at.
+            QVariantList rowIds;
+            int nextRecordIndex;
+    };
+}
+
+#endif // RECORDLISTMODEL_H
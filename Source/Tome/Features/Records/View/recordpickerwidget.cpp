@@ -0,0 +1,127 @@
+#include "recordpickerwidget.h"
+
+#include <QAbstractItemView>
+
+#include "recordlistmodel.h"
+#include "../Controller/recordscontroller.h"
+#include "../../../Util/memoryutils.h"
+
+
+using namespace Tome;
+
+
+RecordPickerWidget::RecordPickerWidget(const RecordsController& recordsController, QWidget* parent)
+    : QWidget(parent),
+      recordsController(recordsController)
+{
+    // Create layout.
+    this->layout = new QHBoxLayout();
+
+    // Add widgets.
+    this->lineEdit = new QLineEdit();
+    this->lineEdit->setPlaceholderText(tr("Search records..."));
+    this->lineEdit->setClearButtonEnabled(true);
+    this->layout->addWidget(this->lineEdit);
+
+    this->button = new QPushButton();
+    this->button->setText(tr("Browse..."));
+    this->layout->addWidget(this->button);
+
+    // Set layout.
+    this->setLayout(this->layout);
+    this->layout->setContentsMargins(0, 0, 0, 0);
+
+    // Suggest records. The model filters by itself, so the completer must show all of its rows.
+    this->model = new RecordListModel(this->recordsController, this);
+
+    this->completer = new QCompleter(this);
+    this->completer->setModel(this->model);
+    this->completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    this->completer->setWidget(this->lineEdit);
+
+    // Connect signals.
+    connect(
+                this->button,
+                SIGNAL(clicked(bool)),
+                SLOT(onBrowseButtonClicked(bool))
+                );
+
+    connect(
+                this->completer,
+                SIGNAL(activated(QModelIndex)),
+                SLOT(onCompleterActivated(QModelIndex))
+                );
+
+    connect(
+                this->lineEdit,
+                SIGNAL(textEdited(QString)),
+                SLOT(onLineEditTextEdited(QString))
+                );
+}
+
+RecordPickerWidget::~RecordPickerWidget()
+{
+    deleteLayout(this->layout);
+}
+
+QVariant RecordPickerWidget::getRecordId() const
+{
+    return this->recordId;
+}
+
+void RecordPickerWidget::setRecordId(const QVariant& recordId)
+{
+    const bool changed = this->recordId != recordId;
+
+    this->recordId = recordId;
+
+    // Show display name of the current record.
+    this->lineEdit->setText(this->recordsController.hasRecord(recordId)
+                            ? this->recordsController.getRecord(recordId).displayName
+                            : recordId.toString());
+
+    if (changed)
+    {
+        emit this->recordIdChanged(recordId);
+    }
+}
+
+void RecordPickerWidget::setRecordIds(const QVariantList& recordIds)
+{
+    this->model->setRecordIds(recordIds);
+}
+
+void RecordPickerWidget::onBrowseButtonClicked(bool checked)
+{
+    Q_UNUSED(checked)
+
+    // Suggest all records.
+    this->model->setFilterText(QString());
+    this->completer->complete();
+}
+
+void RecordPickerWidget::onCompleterActivated(const QModelIndex& index)
+{
+    // Completer passes indexes of its own proxy model.
+    this->setRecordId(index.data(Qt::UserRole));
+}
+
+void RecordPickerWidget::onLineEditTextEdited(const QString& text)
+{
+    // Typing discards the current record, until another one is picked.
+    if (!this->recordId.isNull())
+    {
+        this->recordId = QVariant();
+        emit this->recordIdChanged(this->recordId);
+    }
+
+    if (text.isEmpty())
+    {
+        this->completer->popup()->hide();
+        return;
+    }
+
+    // Suggest matching records.
+    this->model->setFilterText(text);
+    this->completer->complete();
+}
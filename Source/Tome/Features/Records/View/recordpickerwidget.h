@@ -0,0 +1,80 @@
+#ifndef RECORDPICKERWIDGET_H
+#define RECORDPICKERWIDGET_H
+
+#include <QCompleter>
+#include <QHBoxLayout>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QVariant>
+#include <QWidget>
+
+
+namespace Tome
+{
+    class RecordListModel;
+    class RecordsController;
+
+    /**
+     * @brief Widget that allows to search for a record by display name and shows the current record.
+     *
+     * Matching records are suggested in a popup whose rows are fetched lazily, so opening the widget doesn't require looking at all records.
+     */
+    class RecordPickerWidget : public QWidget
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new widget that allows to search for a record by display name and shows the current record.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param parent Optional owner widget.
+             */
+            explicit RecordPickerWidget(const RecordsController& recordsController, QWidget* parent = 0);
+            ~RecordPickerWidget();
+
+            /**
+             * @brief Gets the id of the current record.
+             * @return Id of the current record, or null if no record has been picked.
+             */
+            QVariant getRecordId() const;
+
+            /**
+             * @brief Sets the current record.
+             * @param recordId Id of the current record, or null to clear the widget.
+             */
+            void setRecordId(const QVariant& recordId);
+
+            /**
+             * @brief Sets the records that can be picked.
+             * @param recordIds Ids of the records that can be picked, in the order to suggest them in (e.g. as returned by RecordsController::getSortedDescendantIds).
+             */
+            void setRecordIds(const QVariantList& recordIds);
+
+        signals:
+            /**
+             * @brief Another record has been picked, or the widget has been cleared.
+             * @param recordId Id of the new current record, or null if the widget has been cleared.
+             */
+            void recordIdChanged(const QVariant& recordId);
+
+        private slots:
+            void onBrowseButtonClicked(bool checked);
+            void onCompleterActivated(const QModelIndex& index);
+            void onLineEditTextEdited(const QString& text);
+
+        private:
+            const RecordsController& recordsController;
+
+            QHBoxLayout* layout;
+
+            QLineEdit* lineEdit;
+            QPushButton* button;
+
+            QCompleter* completer;
+            RecordListModel* model;
+
+            QVariant recordId;
+    };
+}
+
+#endif // RECORDPICKERWIDGET_H
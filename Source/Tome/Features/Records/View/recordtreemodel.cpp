@@ -0,0 +1,729 @@
+#include "recordtreemodel.h"
+
+#include <QBrush>
+#include <QDataStream>
+#include <QMimeData>
+#include <QPixmap>
+#include <QSet>
+
+#include "../Controller/recordscontroller.h"
+#include "../Controller/thumbnailcontroller.h"
+#include "../../Facets/Controller/facetscontroller.h"
+#include "../../Facets/Controller/removedfileprefixfacet.h"
+#include "../../Facets/Controller/removedfilesuffixfacet.h"
+#include "../../Fields/Controller/fielddefinitionscontroller.h"
+#include "../../Projects/Controller/projectcontroller.h"
+#include "../../../Util/pathutils.h"
+
+
+using namespace Tome;
+
+
+RecordTreeModel::RecordTreeModel(RecordsController& recordsController,
+                                 FacetsController& facetsController,
+                                 FieldDefinitionsController& fieldDefinitionsController,
+                                 ProjectController& projectController,
+                                 ThumbnailController& thumbnailController)
+    : facetsController(facetsController),
+      fieldDefinitionsController(fieldDefinitionsController),
+      projectController(projectController),
+      recordsController(recordsController),
+      thumbnailController(thumbnailController),
+      root(new RecordTreeNode())
+{
+    connect(
+                &this->thumbnailController,
+                SIGNAL(thumbnailLoaded(const QString&)),
+                SLOT(onThumbnailLoaded(const QString&)));
+}
+
+RecordTreeModel::~RecordTreeModel()
+{
+    this->deleteChildren(this->root);
+    delete this->root;
+}
+
+int RecordTreeModel::columnCount(const QModelIndex& parent) const
+{
+    Q_UNUSED(parent)
+    return 1;
+}
+
+QVariant RecordTreeModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid())
+    {
+        return QVariant();
+    }
+
+    RecordTreeNode* node = this->getNode(index);
+
+    if (!this->recordsController.hasRecord(node->id))
+    {
+        return QVariant();
+    }
+
+    const Record& record = this->recordsController.getRecord(node->id);
+
+    switch (role)
+    {
+        case Qt::DisplayRole:
+            return record.displayName;
+
+        case Qt::DecorationRole:
+            if (!node->iconLoaded)
+            {
+                node->icon = this->getRecordIcon(record.id);
+                node->iconLoaded = true;
+            }
+            return node->icon;
+
+        case Qt::ForegroundRole:
+            return QBrush(record.readOnly ? Qt::blue : Qt::black);
+
+        case Qt::UserRole:
+            return record.id;
+    }
+
+    return QVariant();
+}
+
+bool RecordTreeModel::dropMimeData(const QMimeData* data, Qt::DropAction action, int row, int column, const QModelIndex& parent)
+{
+    Q_UNUSED(action)
+    Q_UNUSED(row)
+    Q_UNUSED(column)
+
+    // Get dropped content.
+    QByteArray encoded = data->data("application/x-qabstractitemmodeldatalist");
+    QDataStream stream(&encoded, QIODevice::ReadOnly);
+
+    // Get all dragged records.
+    QVariantList draggedRecordIds;
+
+    while (!stream.atEnd())
+    {
+        // Get data.
+        int draggedRow;
+        int draggedColumn;
+        QMap<int, QVariant> roleDataMap;
+        stream >> draggedRow >> draggedColumn >> roleDataMap;
+
+        // Get dragged record.
+        QVariant draggedRecordId = roleDataMap[Qt::UserRole];
+
+        if (!draggedRecordIds.contains(draggedRecordId))
+        {
+            draggedRecordIds << draggedRecordId;
+        }
+    }
+
+    // Check if not empty.
+    if (!draggedRecordIds.empty())
+    {
+        // Get drop target record.
+        QVariant dropTargetRecordId = this->getRecordId(parent);
+
+        // Emit signal.
+        emit recordsReparented(draggedRecordIds, dropTargetRecordId);
+    }
+
+    return true;
+}
+
+Qt::ItemFlags RecordTreeModel::flags(const QModelIndex& index) const
+{
+    // Allow dropping records onto the root of the hierarchy.
+    Qt::ItemFlags flags = Qt::ItemIsDropEnabled;
+
+    if (index.isValid())
+    {
+        flags |= Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsDragEnabled;
+    }
+
+    return flags;
+}
+
+bool RecordTreeModel::hasChildren(const QModelIndex& parent) const
+{
+    RecordTreeNode* node = this->getNode(parent);
+
+    if (node->childrenLoaded)
+    {
+        return !node->children.empty();
+    }
+
+    return !this->recordsController.getChildIds(node->id).empty();
+}
+
+QModelIndex RecordTreeModel::index(int row, int column, const QModelIndex& parent) const
+{
+    if (!this->hasIndex(row, column, parent))
+    {
+        return QModelIndex();
+    }
+
+    RecordTreeNode* parentNode = this->getNode(parent);
+    this->loadChildren(parentNode);
+    return this->createIndex(row, column, parentNode->children[row]);
+}
+
+QMap<int, QVariant> RecordTreeModel::itemData(const QModelIndex& index) const
+{
+    // Include record id for drag & drop.
+    QMap<int, QVariant> roles = QAbstractItemModel::itemData(index);
+    roles.insert(Qt::UserRole, this->getRecordId(index));
+    return roles;
+}
+
+QModelIndex RecordTreeModel::parent(const QModelIndex& index) const
+{
+    if (!index.isValid())
+    {
+        return QModelIndex();
+    }
+
+    RecordTreeNode* node = this->getNode(index);
+    return this->getNodeIndex(node->parent);
+}
+
+int RecordTreeModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.column() > 0)
+    {
+        return 0;
+    }
+
+    RecordTreeNode* node = this->getNode(parent);
+    this->loadChildren(node);
+    return node->children.count();
+}
+
+Qt::DropActions RecordTreeModel::supportedDropActions() const
+{
+    return Qt::MoveAction;
+}
+
+void RecordTreeModel::addRecord(const QVariant& id, const QVariant& parentId)
+{
+    if (this->getRecordNode(id) != nullptr)
+    {
+        return;
+    }
+
+    // Show records with missing parents as roots, as the records controller does.
+    RecordTreeNode* parent = this->recordsController.hasRecord(parentId)
+            ? this->getRecordNode(parentId)
+            : this->root;
+
+    if (parent == nullptr)
+    {
+        // Parent has never been shown, its children will be created on demand.
+        return;
+    }
+
+    const QModelIndex parentIndex = this->getNodeIndex(parent);
+    const QVariantList childIds = this->recordsController.getChildIds(parent->id);
+
+    if (!parent->childrenLoaded)
+    {
+        // Views have never asked for the children of the parent, so all of them are new to them.
+        if (!childIds.empty())
+        {
+            this->beginInsertRows(parentIndex, 0, childIds.count() - 1);
+            this->loadChildren(parent);
+            this->endInsertRows();
+        }
+        return;
+    }
+
+    // Keep siblings sorted by display name.
+    int row = childIds.indexOf(id);
+
+    if (row < 0 || row > parent->children.count())
+    {
+        row = parent->children.count();
+    }
+
+    this->beginInsertRows(parentIndex, row, row);
+
+    RecordTreeNode* node = new RecordTreeNode();
+    node->id = id;
+    node->parent = parent;
+    parent->children.insert(row, node);
+    this->nodes.insert(id.toString(), node);
+    this->updateNodeRows(parent, row);
+
+    this->endInsertRows();
+}
+
+QVariant RecordTreeModel::getRecordId(const QModelIndex& index) const
+{
+    if (!index.isValid())
+    {
+        return QVariant();
+    }
+
+    return this->getNode(index)->id;
+}
+
+QModelIndex RecordTreeModel::getRecordIndex(const QVariant& id) const
+{
+    RecordTreeNode* node = this->getRecordNode(id);
+
+    if (node == nullptr && this->recordsController.hasRecord(id))
+    {
+        // Create nodes along the path from the root of the record tree.
+        QVariantList path;
+        path << id;
+
+        const RecordList ancestors = this->recordsController.getAncestors(id);
+
+        for (const Record& ancestor : ancestors)
+        {
+            path.prepend(ancestor.id);
+        }
+
+        node = this->root;
+
+        for (const QVariant& pathId : path)
+        {
+            this->loadChildren(node);
+            node = this->nodes.value(pathId.toString());
+
+            if (node == nullptr)
+            {
+                break;
+            }
+        }
+    }
+
+    return this->getNodeIndex(node);
+}
+
+void RecordTreeModel::refreshRecords()
+{
+    this->beginResetModel();
+    this->deleteChildren(this->root);
+    this->pendingIcons.clear();
+    this->endResetModel();
+}
+
+void RecordTreeModel::removeRecord(const QVariant& id)
+{
+    RecordTreeNode* node = this->getRecordNode(id);
+
+    if (node == nullptr || node == this->root)
+    {
+        return;
+    }
+
+    RecordTreeNode* parent = node->parent;
+    const int row = this->getNodeRow(node);
+
+    this->beginRemoveRows(this->getNodeIndex(parent), row, row);
+
+    parent->children.removeAt(row);
+    this->updateNodeRows(parent, row);
+
+    this->deleteChildren(node);
+    this->nodes.remove(node->id.toString());
+    delete node;
+
+    this->endRemoveRows();
+}
+
+void RecordTreeModel::reparentRecord(const QVariant& id, const QVariant& newParentId)
+{
+    RecordTreeNode* node = this->getRecordNode(id);
+    RecordTreeNode* newParent = this->getRecordNode(newParentId);
+
+    if (node == nullptr || node == this->root)
+    {
+        this->addRecord(id, newParentId);
+        return;
+    }
+
+    if (newParent == nullptr || !newParent->childrenLoaded)
+    {
+        this->removeRecord(id);
+        this->addRecord(id, newParentId);
+        return;
+    }
+
+    this->moveNode(node, newParent);
+
+    // Icons might be inherited from the new ancestors.
+    this->invalidateIcons(node, true);
+
+    const QModelIndex index = this->getNodeIndex(node);
+    emit this->dataChanged(index, index);
+}
+
+void RecordTreeModel::reparentRecords(const QVariantList& ids)
+{
+    emit this->layoutAboutToBeChanged();
+
+    // Remember the records of all persistent indexes, e.g. selected ones, as their nodes might be moved or deleted.
+    const QModelIndexList oldPersistentIndexes = this->persistentIndexList();
+    QVariantList persistentIds;
+
+    for (const QModelIndex& index : oldPersistentIndexes)
+    {
+        persistentIds << this->getNode(index)->id;
+    }
+
+    // Find old and new parents of all moved nodes.
+    QHash<QString, RecordTreeNode*> detachedNodes;
+    QSet<RecordTreeNode*> oldParents;
+    QSet<RecordTreeNode*> newParents;
+
+    for (const QVariant& id : ids)
+    {
+        RecordTreeNode* node = this->getRecordNode(id);
+
+        if (node != nullptr && node != this->root)
+        {
+            detachedNodes.insert(id.toString(), node);
+            oldParents.insert(node->parent);
+        }
+
+        RecordTreeNode* newParent = this->getRecordNode(this->recordsController.getParentId(id));
+
+        if (newParent != nullptr && newParent->childrenLoaded)
+        {
+            newParents.insert(newParent);
+        }
+    }
+
+    // Detach moved nodes from their old parents.
+    for (RecordTreeNode* parent : oldParents)
+    {
+        QList<RecordTreeNode*> remainingChildren;
+
+        for (RecordTreeNode* child : parent->children)
+        {
+            if (!detachedNodes.contains(child->id.toString()))
+            {
+                remainingChildren << child;
+            }
+        }
+
+        parent->children = remainingChildren;
+        this->updateNodeRows(parent, 0);
+    }
+
+    // Attach moved nodes to their new parents, keeping siblings sorted by display name.
+    for (RecordTreeNode* parent : newParents)
+    {
+        QHash<QString, RecordTreeNode*> siblings;
+
+        for (RecordTreeNode* child : parent->children)
+        {
+            siblings.insert(child->id.toString(), child);
+        }
+
+        const QVariantList childIds = this->recordsController.getChildIds(parent->id);
+        parent->children.clear();
+
+        for (const QVariant& childId : childIds)
+        {
+            const QString key = childId.toString();
+            RecordTreeNode* child = siblings.value(key);
+
+            if (child == nullptr)
+            {
+                child = detachedNodes.take(key);
+
+                if (child == nullptr)
+                {
+                    child = new RecordTreeNode();
+                    child->id = childId;
+                    this->nodes.insert(key, child);
+                }
+            }
+
+            child->parent = parent;
+            parent->children << child;
+        }
+
+        this->updateNodeRows(parent, 0);
+    }
+
+    // Discard nodes of records whose new parents have never been shown. They will be created on demand.
+    for (RecordTreeNode* node : detachedNodes)
+    {
+        this->deleteChildren(node);
+        this->nodes.remove(node->id.toString());
+        delete node;
+    }
+
+    // Update persistent indexes.
+    QModelIndexList newPersistentIndexes;
+
+    for (const QVariant& id : persistentIds)
+    {
+        newPersistentIndexes << this->getNodeIndex(this->nodes.value(id.toString()));
+    }
+
+    this->changePersistentIndexList(oldPersistentIndexes, newPersistentIndexes);
+
+    emit this->layoutChanged();
+
+    // Icons might be inherited from the new ancestors.
+    for (const QVariant& id : ids)
+    {
+        RecordTreeNode* node = this->nodes.value(id.toString());
+
+        if (node == nullptr)
+        {
+            continue;
+        }
+
+        this->invalidateIcons(node, true);
+
+        const QModelIndex index = this->getNodeIndex(node);
+        emit this->dataChanged(index, index);
+    }
+}
+
+void RecordTreeModel::updateRecord(const QVariant& id, bool updateDescendants)
+{
+    RecordTreeNode* node = this->getRecordNode(id);
+
+    if (node == nullptr || node == this->root)
+    {
+        return;
+    }
+
+    this->invalidateIcons(node, updateDescendants);
+
+    // Keep siblings sorted by display name.
+    this->moveNode(node, node->parent);
+
+    const QModelIndex index = this->getNodeIndex(node);
+    emit this->dataChanged(index, index);
+}
+
+void RecordTreeModel::onThumbnailLoaded(const QString& filePath)
+{
+    const QVariantList ids = this->pendingIcons.values(filePath);
+    this->pendingIcons.remove(filePath);
+
+    for (const QVariant& id : ids)
+    {
+        RecordTreeNode* node = this->getRecordNode(id);
+
+        if (node == nullptr || node == this->root)
+        {
+            continue;
+        }
+
+        this->invalidateIcons(node, false);
+
+        const QModelIndex index = this->getNodeIndex(node);
+        emit this->dataChanged(index, index, QVector<int>() << Qt::DecorationRole);
+    }
+}
+
+void RecordTreeModel::deleteChildren(RecordTreeModel::RecordTreeNode* node) const
+{
+    for (RecordTreeNode* child : node->children)
+    {
+        this->deleteChildren(child);
+        this->nodes.remove(child->id.toString());
+        delete child;
+    }
+
+    node->children.clear();
+    node->childrenLoaded = false;
+}
+
+RecordTreeModel::RecordTreeNode* RecordTreeModel::getNode(const QModelIndex& index) const
+{
+    if (!index.isValid())
+    {
+        return this->root;
+    }
+
+    return static_cast<RecordTreeNode*>(index.internalPointer());
+}
+
+RecordTreeModel::RecordTreeNode* RecordTreeModel::getRecordNode(const QVariant& id) const
+{
+    if (id.toString().isEmpty())
+    {
+        return this->root;
+    }
+
+    return this->nodes.value(id.toString());
+}
+
+QModelIndex RecordTreeModel::getNodeIndex(RecordTreeModel::RecordTreeNode* node) const
+{
+    if (node == nullptr || node == this->root)
+    {
+        return QModelIndex();
+    }
+
+    return this->createIndex(this->getNodeRow(node), 0, node);
+}
+
+int RecordTreeModel::getNodeRow(RecordTreeModel::RecordTreeNode* node) const
+{
+    return node->row;
+}
+
+const QIcon RecordTreeModel::getRecordIcon(const QVariant& id) const
+{
+    const Record& record = this->recordsController.getRecord(id);
+
+    // Check if has preview icon.
+    const QString editorIconFieldId = this->recordsController.getRecordEditorIconFieldId(id);
+
+    if (!editorIconFieldId.isEmpty() && this->fieldDefinitionsController.hasFieldDefinition(editorIconFieldId))
+    {
+        const FieldDefinition& iconField = this->fieldDefinitionsController.getFieldDefinition(editorIconFieldId);
+        const RecordFieldValueMap recordFieldValues = this->recordsController.getRecordFieldValues(record.id);
+
+        QString iconFileName = recordFieldValues[iconField.id].toString();
+
+        QString removedPrefix = this->facetsController.getFacetValue(iconField.fieldType, RemovedFilePrefixFacet::FacetKey).toString();
+        QString removedSuffix = this->facetsController.getFacetValue(iconField.fieldType, RemovedFileSuffixFacet::FacetKey).toString();
+
+        iconFileName = removedPrefix + iconFileName + removedSuffix;
+        QString projectPath = this->projectController.getProjectPath();
+
+        iconFileName = combinePaths(projectPath, iconFileName);
+
+        // Get preview, showing a placeholder until it has been loaded in the background.
+        if (this->thumbnailController.isImageFile(iconFileName))
+        {
+            const QImage thumbnail = this->thumbnailController.getThumbnail(iconFileName);
+
+            if (!thumbnail.isNull())
+            {
+                return QIcon(QPixmap::fromImage(thumbnail));
+            }
+
+            if (this->thumbnailController.isLoadingThumbnail(iconFileName) &&
+                    !this->pendingIcons.contains(iconFileName, id))
+            {
+                this->pendingIcons.insert(iconFileName, id);
+            }
+        }
+    }
+
+    // If the record and all ancestors have no fields, use a folder style icon;
+    // else use a file style icon.
+    bool recordIsEmtpy = record.fieldValues.empty();
+    if (recordIsEmtpy)
+    {
+        const RecordList ancestors = this->recordsController.getAncestors(id);
+        for (int i = 0; ancestors.size() > i && recordIsEmtpy; ++i)
+        {
+            recordIsEmtpy &= ancestors[i].fieldValues.empty();
+        }
+    }
+
+    if (recordIsEmtpy)
+    {
+        return QIcon(":/Media/Icons/Folder_6221.png");
+    }
+    else
+    {
+        return QIcon(":/Media/Icons/Textfile_818_16x.png");
+    }
+}
+
+void RecordTreeModel::invalidateIcons(RecordTreeModel::RecordTreeNode* node, bool recursive)
+{
+    node->icon = QIcon();
+    node->iconLoaded = false;
+
+    if (!recursive || node->children.empty())
+    {
+        return;
+    }
+
+    for (RecordTreeNode* child : node->children)
+    {
+        this->invalidateIcons(child, true);
+    }
+
+    emit this->dataChanged(this->getNodeIndex(node->children.first()), this->getNodeIndex(node->children.last()));
+}
+
+void RecordTreeModel::loadChildren(RecordTreeModel::RecordTreeNode* node) const
+{
+    if (node->childrenLoaded)
+    {
+        return;
+    }
+
+    const QVariantList childIds = this->recordsController.getChildIds(node->id);
+
+    for (const QVariant& childId : childIds)
+    {
+        RecordTreeNode* child = new RecordTreeNode();
+        child->id = childId;
+        child->parent = node;
+        child->row = node->children.count();
+        node->children << child;
+        this->nodes.insert(childId.toString(), child);
+    }
+
+    node->childrenLoaded = true;
+}
+
+void RecordTreeModel::moveNode(RecordTreeModel::RecordTreeNode* node, RecordTreeModel::RecordTreeNode* newParent)
+{
+    RecordTreeNode* oldParent = node->parent;
+    const int oldRow = this->getNodeRow(node);
+
+    // Find position among new siblings, sorted by display name.
+    const int siblingCount = oldParent == newParent ? newParent->children.count() - 1 : newParent->children.count();
+    int newRow = this->recordsController.getChildIds(newParent->id).indexOf(node->id);
+
+    if (newRow < 0 || newRow > siblingCount)
+    {
+        newRow = siblingCount;
+    }
+
+    if (oldParent == newParent && oldRow == newRow)
+    {
+        return;
+    }
+
+    // Destination row is expected to be given relative to the rows before the move.
+    const int destinationRow = oldParent == newParent && newRow > oldRow ? newRow + 1 : newRow;
+
+    if (!this->beginMoveRows(this->getNodeIndex(oldParent), oldRow, oldRow, this->getNodeIndex(newParent), destinationRow))
+    {
+        return;
+    }
+
+    oldParent->children.removeAt(oldRow);
+    newParent->children.insert(newRow, node);
+    node->parent = newParent;
+
+    if (oldParent == newParent)
+    {
+        this->updateNodeRows(newParent, qMin(oldRow, newRow));
+    }
+    else
+    {
+        this->updateNodeRows(oldParent, oldRow);
+        this->updateNodeRows(newParent, newRow);
+    }
+
+    this->endMoveRows();
+}
+
+void RecordTreeModel::updateNodeRows(RecordTreeModel::RecordTreeNode* parent, int firstRow) const
+{
+    for (int row = firstRow; row < parent->children.count(); ++row)
+    {
+        parent->children[row]->row = row;
+    }
+}
@@ -0,0 +1,162 @@
+#ifndef RECORDTREEMODEL_H
+#define RECORDTREEMODEL_H
+
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QIcon>
+#include <QList>
+#include <QMultiHash>
+
+namespace Tome
+{
+    class FacetsController;
+    class FieldDefinitionsController;
+    class ProjectController;
+    class RecordsController;
+    class ThumbnailController;
+
+    /**
+     * @brief Model of the record hierarchy, backed by the hierarchy index of the records controller.
+     *
+     * Tree nodes are created lazily when views first ask for the children of a record,
+     * and display names, colors and icons are resolved on demand.
+     */
+    class RecordTreeModel : public QAbstractItemModel
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new model of the record hierarchy.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param facetsController Controller for validating type facets.
+             * @param fieldDefinitionsController Controller for adding, updating and removing field definitions.
+             * @param projectController Controller for creating, loading and saving projects.
+             * @param thumbnailController Controller for loading record icons in the background.
+             */
+            RecordTreeModel(RecordsController& recordsController,
+                            FacetsController& facetsController,
+                            FieldDefinitionsController& fieldDefinitionsController,
+                            ProjectController& projectController,
+                            ThumbnailController& thumbnailController);
+            ~RecordTreeModel();
+
+            int columnCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+            QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+            bool dropMimeData(const QMimeData* data, Qt::DropAction action, int row, int column, const QModelIndex& parent) Q_DECL_OVERRIDE;
+            Qt::ItemFlags flags(const QModelIndex& index) const Q_DECL_OVERRIDE;
+            bool hasChildren(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+            QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+            QMap<int, QVariant> itemData(const QModelIndex& index) const Q_DECL_OVERRIDE;
+            QModelIndex parent(const QModelIndex& index) const Q_DECL_OVERRIDE;
+            int rowCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+            Qt::DropActions supportedDropActions() const Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Inserts a row for the specified record, if its parent has already been shown.
+             * @param id Id of the record to add.
+             * @param parentId Id of the parent of the record to add, or null if the record is a root of the record tree.
+             */
+            void addRecord(const QVariant& id, const QVariant& parentId);
+
+            /**
+             * @brief Gets the id of the record at the specified index.
+             * @param index Index to get the record id of.
+             * @return Id of the record at the specified index, or null if the index is invalid.
+             */
+            QVariant getRecordId(const QModelIndex& index) const;
+
+            /**
+             * @brief Gets the index of the record with the specified id, creating the nodes of all of its ancestors if necessary.
+             * @param id Id of the record to get the index of.
+             * @return Index of the record with the specified id, or an invalid index if the record could not be found.
+             */
+            QModelIndex getRecordIndex(const QVariant& id) const;
+
+            /**
+             * @brief Discards all tree nodes, causing them to be recreated from the records controller on demand.
+             */
+            void refreshRecords();
+
+            /**
+             * @brief Removes the row of the specified record, including all of its descendants.
+             * @param id Id of the record to remove.
+             */
+            void removeRecord(const QVariant& id);
+
+            /**
+             * @brief Moves the row of the specified record to its new parent.
+             * @param id Id of the record to move.
+             * @param newParentId Id of the new parent of the record, or null if the record has been made a root of the record tree.
+             */
+            void reparentRecord(const QVariant& id, const QVariant& newParentId);
+
+            /**
+             * @brief Moves the rows of the specified records to their new parents, as a single layout change.
+             * @param ids Ids of the records to move.
+             */
+            void reparentRecords(const QVariantList& ids);
+
+            /**
+             * @brief Moves the row of the specified record to keep its siblings sorted, and refreshes its data.
+             * @param id Id of the record to update.
+             * @param updateDescendants Whether to refresh the icons of all descendants of the record as well, e.g. because its editor icon field has changed.
+             */
+            void updateRecord(const QVariant& id, bool updateDescendants);
+
+        signals:
+            /**
+             * @brief One or more records have been dragged & dropped onto another record in the hierarchy.
+             * @param recordIds Ids of the records which have been dropped.
+             * @param newParentId Id of the record the dragged records have been dropped onto, or null if they have been dropped onto the root of the hierarchy.
+             */
+            void recordsReparented(const QVariantList& recordIds, const QVariant& newParentId);
+
+        private slots:
+            void onThumbnailLoaded(const QString& filePath);
+
+        private:
+            class RecordTreeNode
+            {
+                public:
+                    QVariant id;
+                    RecordTreeNode* parent = nullptr;
+                    int row = 0;
+                    QList<RecordTreeNode*> children;
+                    bool childrenLoaded = false;
+                    QIcon icon;
+                    bool iconLoaded = false;
+            };
+
+            FacetsController& facetsController;
+            FieldDefinitionsController& fieldDefinitionsController;
+            ProjectController& projectController;
+            RecordsController& recordsController;
+            ThumbnailController& thumbnailController;
+
+            /**
+             * @brief Ids of the records whose icons are waiting for the thumbnail of the image file with the given path.
+             */
+            mutable QMultiHash<QString, QVariant> pendingIcons;
+
+            RecordTreeNode* root;
+
+            /**
+             * @brief All tree nodes that have been created so far, by record id.
+             */
+            mutable QHash<QString, RecordTreeNode*> nodes;
+
+            void deleteChildren(RecordTreeNode* node) const;
+            RecordTreeNode* getNode(const QModelIndex& index) const;
+            QModelIndex getNodeIndex(RecordTreeNode* node) const;
+            int getNodeRow(RecordTreeNode* node) const;
+            const QIcon getRecordIcon(const QVariant& id) const;
+            RecordTreeNode* getRecordNode(const QVariant& id) const;
+            void invalidateIcons(RecordTreeNode* node, bool recursive);
+            void loadChildren(RecordTreeNode* node) const;
+            void moveNode(RecordTreeNode* node, RecordTreeNode* newParent);
+            void updateNodeRows(RecordTreeNode* parent, int firstRow) const;
+    };
+}
+
+#endif // RECORDTREEMODEL_H
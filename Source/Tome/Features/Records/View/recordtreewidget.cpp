@@ -1,18 +1,9 @@
 #include "recordtreewidget.h"
 
-#include <QImageReader>
 #include <QMenu>
-#include <QMimeData>
-
-#include "recordtreewidgetitem.h"
-#include "../Controller/recordscontroller.h"
-#include "../../Facets/Controller/facetscontroller.h"
-#include "../../Facets/Controller/removedfileprefixfacet.h"
-#include "../../Facets/Controller/removedfilesuffixfacet.h"
-#include "../../Fields/Controller/fielddefinitionscontroller.h"
-#include "../../Projects/Controller/projectcontroller.h"
+
+#include "recordtreemodel.h"
 #include "../../Settings/Controller/settingscontroller.h"
-#include "../../../Util/pathutils.h"
 
 
 using namespace Tome;
@@ -22,7 +13,8 @@ RecordTreeWidget::RecordTreeWidget(RecordsController& recordsController,
                                    FacetsController& facetsController,
                                    FieldDefinitionsController& fieldDefinitionsController,
                                    ProjectController& projectController,
-                                   SettingsController& settingsController)
+                                   SettingsController& settingsController,
+                                   ThumbnailController& thumbnailController)
     : facetsController(facetsController),
       fieldDefinitionsController(fieldDefinitionsController),
       projectController(projectController),
@@ -30,92 +22,72 @@ RecordTreeWidget::RecordTreeWidget(RecordsController& recordsController,
       settingsController(settingsController),
       navigating(false)
 {
+    this->recordTreeModel = new RecordTreeModel(recordsController,
+                                                facetsController,
+                                                fieldDefinitionsController,
+                                                projectController,
+                                                thumbnailController);
+    this->setModel(this->recordTreeModel);
+
     this->setDragEnabled(true);
     this->viewport()->setAcceptDrops(true);
     this->setDropIndicatorShown(true);
     this->setHeaderHidden(true);
     this->setSelectionMode(QAbstractItemView::ExtendedSelection);
 
-    connect(this,
-            SIGNAL(currentItemChanged(QTreeWidgetItem*,QTreeWidgetItem*)),
-            SLOT(onCurrentItemChanged(QTreeWidgetItem*,QTreeWidgetItem*)));
+    // All rows share the same height, which allows the view to skip measuring them.
+    this->setUniformRowHeights(true);
+
+    connect(this->selectionModel(),
+            SIGNAL(currentChanged(const QModelIndex&, const QModelIndex&)),
+            SLOT(onCurrentChanged(const QModelIndex&, const QModelIndex&)));
+
+    connect(this->recordTreeModel,
+            SIGNAL(recordsReparented(const QVariantList&, const QVariant&)),
+            SIGNAL(recordsReparented(const QVariantList&, const QVariant&)));
 }
 
-void RecordTreeWidget::addRecord(const QVariant& id, const QString& displayName, const QVariant& parentId)
+RecordTreeWidget::~RecordTreeWidget()
 {
-    RecordTreeWidgetItem* recordItem = new RecordTreeWidgetItem(id, displayName, QVariant(), false);
-    RecordTreeWidgetItem* parentItem = this->getRecordItem(parentId);
+    delete this->recordTreeModel;
+}
 
-    if (parentItem != nullptr)
-    {
-        parentItem->addChild(recordItem);
-    }
-    else
-    {
-        this->insertTopLevelItem(0, recordItem);
-    }
+void RecordTreeWidget::addRecord(const QVariant& id, const QString& displayName, const QVariant& parentId)
+{
+    Q_UNUSED(displayName)
 
-    this->sort();
+    this->recordTreeModel->addRecord(id, parentId);
 
     // Select new record.
-    this->setCurrentItem(recordItem);
-    this->updateRecordItem(recordItem);
+    this->setCurrentIndex(this->recordTreeModel->getRecordIndex(id));
 }
 
 QVariant RecordTreeWidget::getSelectedRecordId() const
 {
-    RecordTreeWidgetItem* recordTreeItem = this->getSelectedRecordItem();
+    const QModelIndexList selectedIndexes = this->selectionModel()->selectedIndexes();
 
-    if (recordTreeItem == 0)
+    if (selectedIndexes.empty())
     {
         return QVariant();
     }
 
-    return recordTreeItem->getId();
+    return this->recordTreeModel->getRecordId(selectedIndexes.first());
 }
 
 QVariantList RecordTreeWidget::getSelectedRecordIds() const
 {
     QVariantList recordIds;
 
-    QList<RecordTreeWidgetItem*> recordTreeItems = this->getSelectedRecordItems();
+    const QModelIndexList selectedIndexes = this->selectionModel()->selectedIndexes();
 
-    for (int i = 0; i < recordTreeItems.count(); ++i)
+    for (int i = 0; i < selectedIndexes.count(); ++i)
     {
-        if (recordTreeItems[i] != nullptr)
-        {
-            recordIds << recordTreeItems[i]->getId();
-        }
+        recordIds << this->recordTreeModel->getRecordId(selectedIndexes[i]);
     }
 
     return recordIds;
 }
 
-RecordTreeWidgetItem* RecordTreeWidget::getSelectedRecordItem() const
-{
-    QList<QTreeWidgetItem*> selectedItems = this->selectedItems();
-
-    if (selectedItems.empty())
-    {
-        return 0;
-    }
-
-    return static_cast<RecordTreeWidgetItem*>(selectedItems.first());
-}
-
-QList<RecordTreeWidgetItem*> RecordTreeWidget::getSelectedRecordItems() const
-{
-    QList<RecordTreeWidgetItem*> selectedRecordItems;
-    QList<QTreeWidgetItem*> selectedItems = this->selectedItems();
-
-    for (int i = 0; i < selectedItems.count(); ++i)
-    {
-        selectedRecordItems << static_cast<RecordTreeWidgetItem*>(selectedItems[i]);
-    }
-
-    return selectedRecordItems;
-}
-
 void RecordTreeWidget::navigateForward()
 {
     if (this->selectedRecordRedoStack.empty())
@@ -144,135 +116,53 @@ void RecordTreeWidget::navigateBackward()
     this->selectRecord(this->selectedRecordUndoStack.top(), false);
 }
 
-void RecordTreeWidget::updateRecord(const QVariant& oldId,
-                                    const QString& oldDisplayName,
-                                    const QString& oldEditorIconFieldId,
-                                    const QVariant& newId,
-                                    const QString& newDisplayName,
-                                    const QString& newEditorIconFieldId)
+void RecordTreeWidget::refreshRecords()
 {
-    Q_UNUSED(oldId)
-    Q_UNUSED(oldDisplayName)
+    this->selectedRecordUndoStack.clear();
+    this->selectedRecordRedoStack.clear();
 
-    // Update view.
-    RecordTreeWidgetItem* recordItem = this->getRecordItem(newId);
-    recordItem->setDisplayName(newDisplayName);
+    this->recordTreeModel->refreshRecords();
 
-    // Sort by display name.
-    if (oldDisplayName != newDisplayName)
-    {
-        this->sort();
-    }
-
-    if (oldEditorIconFieldId != newEditorIconFieldId)
-    {
-        this->updateRecordItemRecursively(recordItem);
-    }
-    else
+    if (this->settingsController.getExpandRecordTreeOnRefresh())
     {
-        this->updateRecordItem(recordItem);
+        this->expandAll();
     }
 }
 
-void RecordTreeWidget::updateRecordItem(RecordTreeWidgetItem *recordTreeItem)
+void RecordTreeWidget::reparentRecord(const QVariant& id, const QVariant& newParentId)
 {
-    if (recordTreeItem == nullptr)
-    {
-        return;
-    }
-
-    const QVariant recordId = recordTreeItem->getId();
-    const Record& record = this->recordsController.getRecord(recordId);
-
-    // Set color.
-    if (recordTreeItem->isReadOnly())
-    {
-        recordTreeItem->setForeground(0, QBrush(Qt::blue));
-    }
-    else
-    {
-        recordTreeItem->setForeground(0, QBrush(Qt::black));
-    }
-
-    // Check if has preview icon.
-    const QString editorIconFieldId = this->recordsController.getRecordEditorIconFieldId(recordId);
-
-    if (!editorIconFieldId.isEmpty() && this->fieldDefinitionsController.hasFieldDefinition(editorIconFieldId))
-    {
-        const FieldDefinition& iconField = this->fieldDefinitionsController.getFieldDefinition(editorIconFieldId);
-        const RecordFieldValueMap recordFieldValues = this->recordsController.getRecordFieldValues(record.id);
-
-        QString iconFileName = recordFieldValues[iconField.id].toString();
-
-        QString removedPrefix = this->facetsController.getFacetValue(iconField.fieldType, RemovedFilePrefixFacet::FacetKey).toString();
-        QString removedSuffix = this->facetsController.getFacetValue(iconField.fieldType, RemovedFileSuffixFacet::FacetKey).toString();
-
-        iconFileName = removedPrefix + iconFileName + removedSuffix;
-        QString projectPath = this->projectController.getProjectPath();
-
-        iconFileName = combinePaths(projectPath, iconFileName);
-
-        // Get preview.
-        QPixmap iconPixmap;
-
-        QList<QByteArray> supportedImageFormats = QImageReader::supportedImageFormats();
-        for (QByteArray& format : supportedImageFormats)
-        {
-            if (iconFileName.endsWith(format))
-            {
-                iconPixmap.load(iconFileName);
-
-                if (!iconPixmap.isNull())
-                {
-                    recordTreeItem->setIcon(0, QIcon(iconPixmap));
-                    return;
-                }
-            }
-        }
-    }
-
-    // If the record and all ancestors have no fields, use a folder style icon;
-    // else use a file style icon.
-    bool recordIsEmtpy = record.fieldValues.empty();
-    if (recordIsEmtpy)
-    {
-        const RecordList ancestors = this->recordsController.getAncestors(recordId);
-        for (int i = 0; ancestors.size() > i && recordIsEmtpy; ++i)
-        {
-            recordIsEmtpy &= ancestors[i].fieldValues.empty();
-        }
-    }
+    this->recordTreeModel->reparentRecord(id, newParentId);
+}
 
-    if (recordIsEmtpy)
-    {
-        recordTreeItem->setIcon(0, QIcon(":/Media/Icons/Folder_6221.png"));
-    }
-    else
-    {
-        recordTreeItem->setIcon(0, QIcon(":/Media/Icons/Textfile_818_16x.png"));
-    }
+void RecordTreeWidget::reparentRecords(const QVariantList& ids)
+{
+    this->recordTreeModel->reparentRecords(ids);
 }
 
-void RecordTreeWidget::updateRecordItemRecursively(RecordTreeWidgetItem* recordTreeItem)
+void RecordTreeWidget::updateRecord(const QVariant& oldId,
+                                    const QString& oldDisplayName,
+                                    const QString& oldEditorIconFieldId,
+                                    const QVariant& newId,
+                                    const QString& newDisplayName,
+                                    const QString& newEditorIconFieldId)
 {
-    this->updateRecordItem(recordTreeItem);
+    Q_UNUSED(oldId)
+    Q_UNUSED(oldDisplayName)
+    Q_UNUSED(newDisplayName)
 
-    for (int i = 0; i < recordTreeItem->childCount(); ++i)
-    {
-        RecordTreeWidgetItem* child = static_cast<RecordTreeWidgetItem*>(recordTreeItem->child(i));
-        this->updateRecordItemRecursively(child);
-    }
+    // Descendants might inherit the editor icon.
+    this->recordTreeModel->updateRecord(newId, oldEditorIconFieldId != newEditorIconFieldId);
 }
 
 void RecordTreeWidget::selectRecord(const QVariant& id, const bool addToHistory)
 {
-    RecordTreeWidgetItem* item = this->getRecordItem(id);
+    const QModelIndex index = this->recordTreeModel->getRecordIndex(id);
 
     this->navigating = true;
     this->clearSelection();
 
     this->navigating = !addToHistory;
-    this->setCurrentItem(item);
+    this->setCurrentIndex(index);
 }
 
 void RecordTreeWidget::setContextMenuActions(QList<QAction*> actions)
@@ -280,79 +170,9 @@ void RecordTreeWidget::setContextMenuActions(QList<QAction*> actions)
     this->contextMenuActions = actions;
 }
 
-void RecordTreeWidget::setRecords(const RecordList& records)
-{
-    this->clear();
-
-    this->selectedRecordUndoStack.clear();
-    this->selectedRecordRedoStack.clear();
-
-    // Create record tree items.
-    QMap<QString, RecordTreeWidgetItem*> recordItems;
-
-    for (int i = 0; i < records.size(); ++i)
-    {
-        const Record& record = records[i];
-        RecordTreeWidgetItem* recordItem =
-                new RecordTreeWidgetItem(record.id, record.displayName, record.parentId, record.readOnly);
-        recordItems.insert(record.id.toString(), recordItem);
-        updateRecordItem( recordItem );
-
-        // Report progress.
-        emit this->progressChanged(tr("Refreshing Records"), record.displayName, i, records.size());
-    }
-
-    // Report finish.
-    emit this->progressChanged(tr("Refreshing Records"), QString(), 1, 1);
-
-    // Build hierarchy and prepare item list for tree widget.
-    QList<QTreeWidgetItem* > items;
-
-    for (QMap<QString, RecordTreeWidgetItem*>::iterator it = recordItems.begin();
-         it != recordItems.end();
-         ++it)
-    {
-        RecordTreeWidgetItem* recordItem = it.value();
-        QString recordItemParentId = recordItem->getParentId().toString();
-        if (!recordItemParentId.isEmpty())
-        {
-            if (recordItems.contains(recordItemParentId))
-            {
-                // Insert into tree.
-                RecordTreeWidgetItem* recordParent = recordItems[recordItemParentId];
-                recordParent->addChild(recordItem);
-            }
-        }
-
-        items.append(recordItem);
-    }
-
-    // Fill tree widget.
-    this->insertTopLevelItems(0, items);
-    this->sort();
-
-    if (this->settingsController.getExpandRecordTreeOnRefresh())
-    {
-        this->expandAll();
-    }
-}
-
 void RecordTreeWidget::removeRecord(const QVariant& id)
 {
-    // Update view.
-    RecordTreeWidgetItem* recordItem = this->getRecordItem(id);
-
-    if (recordItem->parent() != 0)
-    {
-        recordItem->parent()->removeChild(recordItem);
-    }
-    else
-    {
-        int index = this->indexOfTopLevelItem(recordItem);
-        this->takeTopLevelItem(index);
-    }
-
-    delete recordItem;
+    this->recordTreeModel->removeRecord(id);
 }
 
 void RecordTreeWidget::contextMenuEvent(QContextMenuEvent* event)
@@ -367,43 +187,6 @@ void RecordTreeWidget::contextMenuEvent(QContextMenuEvent* event)
     menu.exec(event->globalPos());
 }
 
-bool RecordTreeWidget::dropMimeData(QTreeWidgetItem* parent, int index, const QMimeData* data, Qt::DropAction action)
-{
-    Q_UNUSED(index)
-    Q_UNUSED(action)
-
-    // Get dropped content.
-    QByteArray encoded = data->data("application/x-qabstractitemmodeldatalist");
-    QDataStream stream(&encoded, QIODevice::ReadOnly);
-
-    // Check if not empty.
-    if (!stream.atEnd())
-    {
-        // Get data.
-        int row;
-        int col;
-        QMap<int,  QVariant> roleDataMap;
-        stream >> row >> col >> roleDataMap;
-
-        // Get dragged record.
-        QVariant draggedRecordId = roleDataMap[Qt::UserRole];
-
-        // Get drop target record.
-        QVariant dropTargetRecordId;
-
-        if (parent != 0)
-        {
-            RecordTreeWidgetItem* dropTarget = static_cast<RecordTreeWidgetItem*>(parent);
-            dropTargetRecordId = dropTarget->getId();
-        }
-
-        // Emit signal.
-        emit recordReparented(draggedRecordId, dropTargetRecordId);
-    }
-
-    return true;
-}
-
 void RecordTreeWidget::mousePressEvent(QMouseEvent* event)
 {
     QModelIndex item = indexAt(event->pos());
@@ -414,11 +197,11 @@ void RecordTreeWidget::mousePressEvent(QMouseEvent* event)
     }
     else
     {
-        this->setCurrentItem(nullptr);
+        this->setCurrentIndex(QModelIndex());
     }
 }
 
-void RecordTreeWidget::onCurrentItemChanged(QTreeWidgetItem* current, QTreeWidgetItem* previous)
+void RecordTreeWidget::onCurrentChanged(const QModelIndex& current, const QModelIndex& previous)
 {
     Q_UNUSED(previous)
 
@@ -429,38 +212,8 @@ void RecordTreeWidget::onCurrentItemChanged(QTreeWidgetItem* current, QTreeWidge
     }
 
     // Push id of selected record, or an empty string for "deselected".
-    QVariant selectedRecordId;
-
-    if (current != nullptr)
-    {
-        RecordTreeWidgetItem* item = static_cast<RecordTreeWidgetItem*>(current);
-        selectedRecordId = item->getId();
-    }
+    QVariant selectedRecordId = this->recordTreeModel->getRecordId(current);
 
     this->selectedRecordUndoStack.push(selectedRecordId);
     this->selectedRecordRedoStack.clear();
 }
-
-RecordTreeWidgetItem* RecordTreeWidget::getRecordItem(const QVariant& id)
-{
-    QTreeWidgetItemIterator it(this);
-
-    while (*it)
-    {
-        RecordTreeWidgetItem *item = static_cast<RecordTreeWidgetItem*>(*it);
-        if (item->getId() == id)
-        {
-            return item;
-        }
-        ++it;
-    }
-
-    return nullptr;
-}
-
-void RecordTreeWidget::sort()
-{
-    this->setSortingEnabled(true);
-    this->sortByColumn(0);
-    this->setSortingEnabled(false);
-}
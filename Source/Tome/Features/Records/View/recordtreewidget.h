@@ -2,11 +2,8 @@
 #define RECORDTREEWIDGET_H
 
 #include <QContextMenuEvent>
-#include <QMimeData>
 #include <QStack>
-#include <QTreeWidget>
-
-#include "../Model/recordlist.h"
+#include <QTreeView>
 
 namespace Tome
 {
@@ -14,13 +11,14 @@ namespace Tome
     class FieldDefinitionsController;
     class ProjectController;
     class RecordsController;
-    class RecordTreeWidgetItem;
+    class RecordTreeModel;
     class SettingsController;
+    class ThumbnailController;
 
     /**
      * @brief Shows the record of hierarchy and allows selecting one or more records.
      */
-    class RecordTreeWidget : public QTreeWidget
+    class RecordTreeWidget : public QTreeView
     {
             Q_OBJECT
 
@@ -32,12 +30,15 @@ namespace Tome
              * @param fieldDefinitionsController Controller for adding, updating and removing field definitions.
              * @param projectController Controller for creating, loading and saving projects.
              * @param settingsController Controller for accessing user settings.
+             * @param thumbnailController Controller for loading record icons in the background.
              */
             RecordTreeWidget(RecordsController& recordsController,
                              FacetsController& facetsController,
                              FieldDefinitionsController& fieldDefinitionsController,
                              ProjectController& projectController,
-                             SettingsController& settingsController);
+                             SettingsController& settingsController,
+                             ThumbnailController& thumbnailController);
+            ~RecordTreeWidget();
 
             /**
              * @brief Adds the specified record to show in the hierarchy.
@@ -69,6 +70,24 @@ namespace Tome
              */
             void navigateBackward();
 
+            /**
+             * @brief Rebuilds the hierarchy from the records of the current project.
+             */
+            void refreshRecords();
+
+            /**
+             * @brief Moves the specified record to its new parent in the hierarchy.
+             * @param id Id of the record to move.
+             * @param newParentId Id of the new parent of the record, or null if the record has been made a root of the hierarchy.
+             */
+            void reparentRecord(const QVariant& id, const QVariant& newParentId);
+
+            /**
+             * @brief Moves the specified records to their new parents in the hierarchy, all at once.
+             * @param ids Ids of the records to move.
+             */
+            void reparentRecords(const QVariantList& ids);
+
             /**
              * @brief Updates the specified record in the hierarchy.
              * @param oldId Previous id of the record to update.
@@ -98,12 +117,6 @@ namespace Tome
              */
             void setContextMenuActions(QList<QAction*> actions);
 
-            /**
-             * @brief Sets the records to show in the hierarchy.
-             * @param records Records to show in the hierarchy.
-             */
-            void setRecords(const RecordList& records);
-
             /**
              * @brief Removes the specified record from the hierarchy.
              * @param id Id of the record to remove.
@@ -112,20 +125,11 @@ namespace Tome
 
         signals:
             /**
-             * @brief Progress of the current record operation has changed.
-             * @param title Title of the current record operation step.
-             * @param text Details of the current record operation step.
-             * @param currentValue Current progress value of the current record operation step.
-             * @param maximumValue Maximum progress value of the current record operation step.
-             */
-            void progressChanged(const QString title, const QString text, const int currentValue, const int maximumValue) const;
-
-            /**
-             * @brief A record has been reparented to another record in the hierarchy.
-             * @param recordId Id of the record which has been reparented.
-             * @param newParentId Id of the new parent of the record, or null if the record has been made a root of the hierarchy.
+             * @brief One or more records have been reparented to another record in the hierarchy.
+             * @param recordIds Ids of the records which have been reparented.
+             * @param newParentId Id of the new parent of the records, or null if the records have been made roots of the hierarchy.
              */
-            void recordReparented(const QVariant& recordId, const QVariant& newParentId);
+            void recordsReparented(const QVariantList& recordIds, const QVariant& newParentId);
 
         protected:
             /**
@@ -134,16 +138,6 @@ namespace Tome
              */
             void contextMenuEvent(QContextMenuEvent *event) Q_DECL_OVERRIDE;
 
-            /**
-             * @brief Checks whether to reparent a record in the hierarchy by drag & drop.
-             * @param parent New parent to reparent the dragged record to.
-             * @param index Unused.
-             * @param data Dragged record.
-             * @param action Unused.
-             * @return True, if a record has been dragged & dropped onto another one, and false otherwise.
-             */
-            bool dropMimeData(QTreeWidgetItem* parent, int index, const QMimeData* data, Qt::DropAction action) Q_DECL_OVERRIDE;
-
             /**
              * @brief Selects a record in the hierarchy, or clears the current selection.
              * @param event Event to selecting a record in the hierarchy or clearing the selection.
@@ -151,7 +145,7 @@ namespace Tome
             void mousePressEvent(QMouseEvent *event) Q_DECL_OVERRIDE;
 
         private slots:
-            void onCurrentItemChanged(QTreeWidgetItem *current, QTreeWidgetItem *previous);
+            void onCurrentChanged(const QModelIndex& current, const QModelIndex& previous);
 
         private:
             FacetsController& facetsController;
@@ -160,18 +154,13 @@ namespace Tome
             RecordsController& recordsController;
             SettingsController& settingsController;
 
+            RecordTreeModel* recordTreeModel;
+
             QStack<QVariant> selectedRecordUndoStack;
             QStack<QVariant> selectedRecordRedoStack;
             bool navigating;
 
             QList<QAction*> contextMenuActions;
-
-            RecordTreeWidgetItem* getRecordItem(const QVariant& id);
-            RecordTreeWidgetItem* getSelectedRecordItem() const;
-            QList<RecordTreeWidgetItem*> getSelectedRecordItems() const;
-            void sort();
-            void updateRecordItem(RecordTreeWidgetItem* recordTreeItem);
-            void updateRecordItemRecursively(RecordTreeWidgetItem* recordTreeItem);
     };
 }
 
@@ -1,14 +1,101 @@
 #include "findrecordcontroller.h"
 
+#include <algorithm>
+
+#include "../../Fields/Controller/fielddefinitionscontroller.h"
 #include "../../Records/Controller/recordscontroller.h"
+#include "../../Types/Controller/typescontroller.h"
+#include "../../Types/Model/builtintype.h"
+#include "../../../Util/progressreporter.h"
 
 using namespace Tome;
 
-FindRecordController::FindRecordController(const Tome::RecordsController& recordsController)
-    : recordsController(recordsController)
+FindRecordController::FindRecordController(const FieldDefinitionsController& fieldDefinitionsController,
+                                           const Tome::RecordsController& recordsController,
+                                           const TypesController& typesController)
+    : fieldDefinitionsController(fieldDefinitionsController),
+      recordsController(recordsController),
+      typesController(typesController)
 {
 }
 
+const SearchResultList FindRecordController::findFieldValue(const QString& query, const QString& fieldId, const QString& typeName) const
+{
+    qInfo(qUtf8Printable(QString("Finding field values matching query %1.").arg(query)));
+
+    // Collect fields to search.
+    QStringList fieldIds;
+
+    for (const FieldDefinition& field : this->fieldDefinitionsController.getFieldDefinitions())
+    {
+        if (!this->isSearchableType(field.fieldType))
+        {
+            continue;
+        }
+
+        if (!fieldId.isEmpty() && field.id != fieldId)
+        {
+            continue;
+        }
+
+        if (!typeName.isEmpty() && !this->typesController.isTypeOrDerivedFromType(field.fieldType, typeName))
+        {
+            continue;
+        }
+
+        fieldIds << field.id;
+    }
+
+    // Find matching field values, sorted by record display name and field id.
+    const QMap<QString, QVariantList> recordIds = this->recordsController.findRecordFieldValues(query, fieldIds);
+    QList<QPair<QPair<QString, QString>, const Record*>> sortedFieldValues;
+
+    for (QMap<QString, QVariantList>::const_iterator it = recordIds.cbegin();
+         it != recordIds.cend();
+         ++it)
+    {
+        for (const QVariant& recordId : it.value())
+        {
+            const Record& record = this->recordsController.getRecord(recordId);
+            sortedFieldValues << qMakePair(qMakePair(record.displayName.toLower(), it.key()), &record);
+        }
+    }
+
+    std::sort(sortedFieldValues.begin(), sortedFieldValues.end());
+
+    // Build search result list.
+    SearchResultList results;
+    ProgressReporter progress(tr("Searching"), sortedFieldValues.length(), ProgressReporter::forSignal(this, &FindRecordController::progressChanged), true);
+
+    for (int i = 0; i < sortedFieldValues.length(); ++i)
+    {
+        const Record& record = *sortedFieldValues[i].second;
+        const QString& recordFieldId = sortedFieldValues[i].first.second;
+
+        // Report progress.
+        if (!progress.update(i, record.displayName))
+        {
+            break;
+        }
+
+        const QVariant fieldValue = this->recordsController.getRecordFieldValue(record.id, recordFieldId);
+
+        SearchResult result;
+        result.content = QString("%1 (%2): %3").arg(record.displayName, recordFieldId, fieldValue.toString());
+        result.targetSiteId = record.id;
+        result.targetSiteType = TargetSiteType::Record;
+        result.fieldId = recordFieldId;
+
+        results.append(result);
+    }
+
+    // Report finish.
+    progress.finish();
+
+    emit searchResultChanged("Find " + query + " in Field Values", results);
+    return results;
+}
+
 const SearchResultList FindRecordController::findRecord(const QString& searchPattern) const
 {
     qInfo(qUtf8Printable(QString("Finding records matching pattern %1.").arg(searchPattern)));
@@ -16,31 +103,84 @@ const SearchResultList FindRecordController::findRecord(const QString& searchPat
     // Build search result list.
     SearchResultList results;
 
-    // Find all record references.
-    const RecordList& records = this->recordsController.getRecords();
+    // Find matching records, sorted by display name.
+    const QVariantList recordIds = this->recordsController.findRecordIds(searchPattern);
+    QList<QPair<QString, const Record*>> sortedRecords;
 
-    for (int i = 0; i < records.length(); ++i)
+    for (const QVariant& recordId : recordIds)
     {
-        const Record& record = records[i];
+        const Record& record = this->recordsController.getRecord(recordId);
+        sortedRecords << QPair<QString, const Record*>(record.displayName.toLower(), &record);
+    }
 
-        // Report progress.
-        emit this->progressChanged(tr("Searching"), record.displayName, i, records.length());
+    std::sort(sortedRecords.begin(), sortedRecords.end());
 
-        if (record.id.toString().toLower().contains(searchPattern.toLower()) ||
-                record.displayName.toLower().contains(searchPattern.toLower()))
-        {
-            SearchResult result;
-            result.content = QString("%1 (%2)").arg(record.displayName, record.id.toString());
-            result.targetSiteId = record.id;
-            result.targetSiteType = TargetSiteType::Record;
+    ProgressReporter progress(tr("Searching"), sortedRecords.length(), ProgressReporter::forSignal(this, &FindRecordController::progressChanged), true);
 
-            results.append(result);
+    for (int i = 0; i < sortedRecords.length(); ++i)
+    {
+        const Record& record = *sortedRecords[i].second;
+
+        // Report progress.
+        if (!progress.update(i, record.displayName))
+        {
+            break;
         }
+
+        SearchResult result;
+        result.content = QString("%1 (%2)").arg(record.displayName, record.id.toString());
+        result.targetSiteId = record.id;
+        result.targetSiteType = TargetSiteType::Record;
+
+        results.append(result);
     }
 
     // Report finish.
-    emit this->progressChanged(tr("Searching"), QString(), 1, 1);
+    progress.finish();
 
     emit searchResultChanged("Find " + searchPattern, results);
     return results;
 }
+
+const QStringList FindRecordController::getSearchableFieldIds() const
+{
+    QStringList fieldIds;
+
+    for (const FieldDefinition& field : this->fieldDefinitionsController.getFieldDefinitions())
+    {
+        if (this->isSearchableType(field.fieldType))
+        {
+            fieldIds << field.id;
+        }
+    }
+
+    fieldIds.sort(Qt::CaseInsensitive);
+    return fieldIds;
+}
+
+const QStringList FindRecordController::getSearchableTypeNames() const
+{
+    QStringList typeNames;
+
+    for (const QString& typeName : this->typesController.getTypeNames())
+    {
+        if (this->isSearchableType(typeName))
+        {
+            typeNames << typeName;
+        }
+    }
+
+    return typeNames;
+}
+
+bool FindRecordController::isSearchableType(const QString& typeName) const
+{
+    if (this->typesController.isTypeOrDerivedFromType(typeName, BuiltInType::String) ||
+            this->typesController.isTypeOrDerivedFromType(typeName, BuiltInType::File))
+    {
+        return true;
+    }
+
+    return this->typesController.isCustomType(typeName) &&
+            this->typesController.getCustomType(typeName).isEnumeration();
+}
@@ -2,12 +2,15 @@
 #define FINDRECORDCONTROLLER_H
 
 #include <QObject>
+#include <QStringList>
 
 #include "../Model/searchresultlist.h"
 
 namespace Tome
 {
+    class FieldDefinitionsController;
     class RecordsController;
+    class TypesController;
 
     /**
      * @brief Controller for finding specific records.
@@ -19,9 +22,22 @@ namespace Tome
         public:
             /**
              * @brief Constructs a new controller for finding specific records.
+             * @param fieldDefinitionsController Controller for adding, updating and removing field definitions.
              * @param recordsController Controller for adding, updating and removing records.
+             * @param typesController Controller for adding, updating and removing custom types.
              */
-            FindRecordController(const RecordsController& recordsController);
+            FindRecordController(const FieldDefinitionsController& fieldDefinitionsController,
+                                 const RecordsController& recordsController,
+                                 const TypesController& typesController);
+
+            /**
+             * @brief Searches for records whose string, file or enumeration field values contain words starting with each word of the specified query.
+             * @param query Words to search for.
+             * @param fieldId Id of the only field to search the values of, or an empty string to search all fields.
+             * @param typeName Name of the type to search the values of, including derived types, or an empty string to search fields of all types.
+             * @return Records whose field values contain the specified words, along with the ids of the matching fields.
+             */
+            const SearchResultList findFieldValue(const QString& query, const QString& fieldId, const QString& typeName) const;
 
             /**
              * @brief Searches for records whose id or display name contain the specified string.
@@ -30,6 +46,18 @@ namespace Tome
              */
             const SearchResultList findRecord(const QString& searchPattern) const;
 
+            /**
+             * @brief Gets the ids of all fields whose values can be searched.
+             * @return Ids of all string, file and enumeration fields, including fields of derived types.
+             */
+            const QStringList getSearchableFieldIds() const;
+
+            /**
+             * @brief Gets the names of all types whose values can be searched.
+             * @return Names of all string, file and enumeration types, including derived types.
+             */
+            const QStringList getSearchableTypeNames() const;
+
         signals:
             /**
              * @brief Progress of the current search operation has changed.
@@ -48,7 +76,11 @@ namespace Tome
             void searchResultChanged(const QString& title, const Tome::SearchResultList results) const;
 
         private:
+            const FieldDefinitionsController& fieldDefinitionsController;
             const RecordsController& recordsController;
+            const TypesController& typesController;
+
+            bool isSearchableType(const QString& typeName) const;
     };
 }
 
@@ -4,6 +4,7 @@
 #include "../../Records/Controller/recordscontroller.h"
 #include "../../Types/Controller/typescontroller.h"
 #include "../../Types/Model/builtintype.h"
+#include "../../../Util/progressreporter.h"
 
 using namespace Tome;
 
@@ -24,13 +25,17 @@ const SearchResultList FindUsagesController::findUsagesOfField(const QString& fi
 
     // Find all record references.
     const RecordList& records = this->recordsController.getRecords();
+    ProgressReporter progress(tr("Searching"), records.length(), ProgressReporter::forSignal(this, &FindUsagesController::progressChanged), true);
 
     for (int i = 0; i < records.length(); ++i)
     {
         const Record& record = records[i];
 
         // Report progress.
-        emit this->progressChanged(tr("Searching"), record.displayName, i, records.length());
+        if (!progress.update(i, record.displayName))
+        {
+            break;
+        }
 
         const RecordFieldValueMap& fieldValues = this->recordsController.getRecordFieldValues(record.id);
 
@@ -53,7 +58,7 @@ const SearchResultList FindUsagesController::findUsagesOfField(const QString& fi
     }
 
     // Report finish.
-    emit this->progressChanged(tr("Searching"), QString(), 1, 1);
+    progress.finish();
 
     emit searchResultChanged("Usages of " + fieldId, results);
     return results;
@@ -68,13 +73,17 @@ const SearchResultList FindUsagesController::findUsagesOfRecord(const QVariant&
 
     // Find all record references.
     const RecordList& records = this->recordsController.getRecords();
+    ProgressReporter progress(tr("Searching"), records.length(), ProgressReporter::forSignal(this, &FindUsagesController::progressChanged), true);
 
     for (int i = 0; i < records.length(); ++i)
     {
         const Record& record = records[i];
 
         // Report progress.
-        emit this->progressChanged(tr("Searching"), record.displayName, i, records.length());
+        if (!progress.update(i, record.displayName))
+        {
+            break;
+        }
 
         const RecordFieldValueMap& fieldValues = this->recordsController.getRecordFieldValues(record.id);
 
@@ -99,7 +108,7 @@ const SearchResultList FindUsagesController::findUsagesOfRecord(const QVariant&
     }
 
     // Report finish.
-    emit this->progressChanged(tr("Searching"), QString(), 1, 1);
+    progress.finish();
 
     emit searchResultChanged("Usages of " + recordId.toString(), results);
     return results;
@@ -114,13 +123,17 @@ const SearchResultList FindUsagesController::findUsagesOfType(const QString& typ
 
     // Find all record references.
     const RecordList& records = this->recordsController.getRecords();
+    ProgressReporter progress(tr("Searching"), records.length(), ProgressReporter::forSignal(this, &FindUsagesController::progressChanged), true);
 
     for (int i = 0; i < records.length(); ++i)
     {
         const Record& record = records[i];
 
         // Report progress.
-        emit this->progressChanged(tr("Searching"), record.displayName, i, records.length());
+        if (!progress.update(i, record.displayName))
+        {
+            break;
+        }
 
         const RecordFieldValueMap& fieldValues = this->recordsController.getRecordFieldValues(record.id);
 
@@ -143,7 +156,7 @@ const SearchResultList FindUsagesController::findUsagesOfType(const QString& typ
     }
 
     // Report finish.
-    emit this->progressChanged(tr("Searching"), QString(), 1, 1);
+    progress.finish();
 
     emit searchResultChanged("Usages of " + typeName, results);
     return results;
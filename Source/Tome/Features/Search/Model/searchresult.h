@@ -23,6 +23,11 @@ namespace Tome
              */
             QVariant targetSiteId;
 
+            /**
+             * @brief Id of the field whose value matched the search, if any.
+             */
+            QString fieldId;
+
             /**
              * @brief Type of the location where the search result was found.
              */
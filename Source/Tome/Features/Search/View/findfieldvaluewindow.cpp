@@ -0,0 +1,49 @@
+#include "findfieldvaluewindow.h"
+#include "ui_findfieldvaluewindow.h"
+
+FindFieldValueWindow::FindFieldValueWindow(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::FindFieldValueWindow)
+{
+    ui->setupUi(this);
+}
+
+FindFieldValueWindow::~FindFieldValueWindow()
+{
+    delete ui;
+}
+
+QString FindFieldValueWindow::getFieldId() const
+{
+    return this->ui->comboBoxField->currentText();
+}
+
+QString FindFieldValueWindow::getQuery() const
+{
+    return this->ui->lineEdit->text();
+}
+
+QString FindFieldValueWindow::getTypeName() const
+{
+    return this->ui->comboBoxType->currentText();
+}
+
+void FindFieldValueWindow::setFieldIds(const QStringList& fieldIds)
+{
+    const QString fieldId = this->getFieldId();
+
+    this->ui->comboBoxField->clear();
+    this->ui->comboBoxField->addItem(QString());
+    this->ui->comboBoxField->addItems(fieldIds);
+    this->ui->comboBoxField->setCurrentText(fieldId);
+}
+
+void FindFieldValueWindow::setTypeNames(const QStringList& typeNames)
+{
+    const QString typeName = this->getTypeName();
+
+    this->ui->comboBoxType->clear();
+    this->ui->comboBoxType->addItem(QString());
+    this->ui->comboBoxType->addItems(typeNames);
+    this->ui->comboBoxType->setCurrentText(typeName);
+}
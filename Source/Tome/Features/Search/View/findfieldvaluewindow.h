@@ -0,0 +1,59 @@
+#ifndef FINDFIELDVALUEWINDOW_H
+#define FINDFIELDVALUEWINDOW_H
+
+#include <QDialog>
+
+namespace Ui {
+    class FindFieldValueWindow;
+}
+
+/**
+ * @brief Window for finding records by the words of their field values.
+ */
+class FindFieldValueWindow : public QDialog
+{
+        Q_OBJECT
+
+    public:
+        /**
+         * @brief Constructs a new window for finding records by the words of their field values.
+         * @param parent Optional owner widget.
+         */
+        explicit FindFieldValueWindow(QWidget *parent = 0);
+        ~FindFieldValueWindow();
+
+        /**
+         * @brief Gets the id of the only field to search the values of.
+         * @return Id of the only field to search the values of, or an empty string to search all fields.
+         */
+        QString getFieldId() const;
+
+        /**
+         * @brief Gets the words to search for.
+         * @return Words to search for.
+         */
+        QString getQuery() const;
+
+        /**
+         * @brief Gets the name of the type to search the values of.
+         * @return Name of the type to search the values of, or an empty string to search fields of all types.
+         */
+        QString getTypeName() const;
+
+        /**
+         * @brief Sets the ids of the fields that can be searched, keeping the current field if it's still available.
+         * @param fieldIds Ids of the fields that can be searched.
+         */
+        void setFieldIds(const QStringList& fieldIds);
+
+        /**
+         * @brief Sets the names of the types that can be searched, keeping the current type if it's still available.
+         * @param typeNames Names of the types that can be searched.
+         */
+        void setTypeNames(const QStringList& typeNames);
+
+    private:
+        Ui::FindFieldValueWindow *ui;
+};
+
+#endif // FINDFIELDVALUEWINDOW_H
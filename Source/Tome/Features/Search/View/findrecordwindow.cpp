@@ -1,6 +1,10 @@
 #include "findrecordwindow.h"
 #include "ui_findrecordwindow.h"
 
+
+const int FindRecordWindow::MinimumLiveSearchPatternLength = 3;
+
+
 FindRecordWindow::FindRecordWindow(QWidget *parent) :
     QDialog(parent),
     ui(new Ui::FindRecordWindow)
@@ -17,3 +21,12 @@ QString FindRecordWindow::getSearchPattern() const
 {
     return this->ui->lineEdit->text();
 }
+
+void FindRecordWindow::on_lineEdit_textEdited(const QString& text)
+{
+    // Shorter patterns would match too many records to show while typing.
+    if (text.length() >= MinimumLiveSearchPatternLength)
+    {
+        emit this->searchPatternChanged(text);
+    }
+}
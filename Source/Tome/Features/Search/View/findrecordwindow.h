@@ -28,7 +28,19 @@ class FindRecordWindow : public QDialog
          */
         QString getSearchPattern() const;
 
+    signals:
+        /**
+         * @brief The user has typed a record id or display name to search for that is long enough for searching as they type.
+         * @param searchPattern New record id or display name to search for.
+         */
+        void searchPatternChanged(const QString& searchPattern);
+
+    private slots:
+        void on_lineEdit_textEdited(const QString& text);
+
     private:
+        static const int MinimumLiveSearchPatternLength;
+
         Ui::FindRecordWindow *ui;
 };
 
@@ -4,6 +4,7 @@
 #include <QLabel>
 
 #include "../Model/searchresult.h"
+#include "../../../Util/progressreporter.h"
 
 
 using namespace Tome;
@@ -48,12 +49,14 @@ void SearchResultsDockWidget::showResults(const QString& title, const SearchResu
     this->tableWidget->setColumnCount(1);
 
     // Show results.
+    ProgressReporter progress(tr("Collecting results"), this->results.count(), ProgressReporter::forSignal(this, &SearchResultsDockWidget::progressChanged));
+
     for (int i = 0; i < this->results.count(); ++i)
     {
         const SearchResult& result = this->results.at(i);
 
         // Report progress.
-        emit this->progressChanged(tr("Collecting results"), result.content, i, this->results.count());
+        progress.update(i, result.content);
 
         // Create table row.
         this->tableWidget->setItem(i, 0, new QTableWidgetItem());
@@ -82,7 +85,7 @@ void SearchResultsDockWidget::showResults(const QString& title, const SearchResu
     }
 
     // Report finish.
-    emit this->progressChanged(tr("Collecting results"), QString(), 1, 1);
+    progress.finish();
 }
 
 void SearchResultsDockWidget::onRecordLinkActivated(const QString& recordId)
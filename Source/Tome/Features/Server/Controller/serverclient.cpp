@@ -0,0 +1,60 @@
+#include "serverclient.h"
+
+#include <stdexcept>
+
+#include <QJsonDocument>
+#include <QLocalSocket>
+
+using namespace Tome;
+
+
+const int ServerClient::ConnectTimeoutInMilliseconds = 5000;
+
+
+ServerClient::ServerClient()
+{
+}
+
+const QJsonObject ServerClient::sendRequest(const QString& serverName, const QJsonObject& request) const
+{
+    QLocalSocket socket;
+    socket.connectToServer(serverName);
+
+    if (!socket.waitForConnected(ConnectTimeoutInMilliseconds))
+    {
+        QString errorMessage = QObject::tr("Server could not be reached: %1\r\n%2")
+                .arg(serverName, socket.errorString());
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::runtime_error(errorMessage.toStdString());
+    }
+
+    // Send request.
+    socket.write(QJsonDocument(request).toJson(QJsonDocument::Compact));
+    socket.write("\n");
+    socket.flush();
+
+    // Wait for response, which may take a while for large exports.
+    while (!socket.canReadLine())
+    {
+        if (!socket.waitForReadyRead(-1))
+        {
+            QString errorMessage = QObject::tr("Server did not respond: %1\r\n%2")
+                    .arg(serverName, socket.errorString());
+            qCritical(qUtf8Printable(errorMessage));
+            throw std::runtime_error(errorMessage.toStdString());
+        }
+    }
+
+    const QJsonDocument response = QJsonDocument::fromJson(socket.readLine());
+
+    if (!response.isObject())
+    {
+        QString errorMessage = QObject::tr("Server sent an invalid response: %1").arg(serverName);
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::runtime_error(errorMessage.toStdString());
+    }
+
+    socket.disconnectFromServer();
+
+    return response.object();
+}
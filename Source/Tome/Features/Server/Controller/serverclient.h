@@ -0,0 +1,36 @@
+#ifndef SERVERCLIENT_H
+#define SERVERCLIENT_H
+
+#include <QJsonObject>
+#include <QString>
+
+namespace Tome
+{
+    /**
+     * @brief Sends requests to a running Tome server, e.g. for exporting records without loading the project again.
+     */
+    class ServerClient
+    {
+        public:
+            /**
+             * @brief Constructs a new client for sending requests to a running Tome server.
+             */
+            ServerClient();
+
+            /**
+             * @brief Sends the passed request to the server listening at the specified local socket, and waits for its response.
+             *
+             * @exception std::runtime_error if the server could not be reached, or didn't respond.
+             *
+             * @param serverName Name of the local socket the server is listening at.
+             * @param request Request to send.
+             * @return Response of the server.
+             */
+            const QJsonObject sendRequest(const QString& serverName, const QJsonObject& request) const;
+
+        private:
+            static const int ConnectTimeoutInMilliseconds;
+    };
+}
+
+#endif // SERVERCLIENT_H
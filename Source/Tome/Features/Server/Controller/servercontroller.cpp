@@ -0,0 +1,344 @@
+#include "servercontroller.h"
+
+#include <stdexcept>
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QLocalServer>
+#include <QLocalSocket>
+
+#include "../../Export/Controller/exportcontroller.h"
+#include "../../Projects/Controller/filewatchercontroller.h"
+#include "../../Projects/Controller/projectcontroller.h"
+#include "../../Records/Controller/recordscontroller.h"
+#include "../../Tasks/Controller/taskresultserializer.h"
+#include "../../Tasks/Controller/taskscontroller.h"
+
+using namespace Tome;
+
+
+const QString ServerController::CommandCheck = "check";
+const QString ServerController::CommandExport = "export";
+const QString ServerController::CommandQuery = "query";
+const QString ServerController::CommandShutdown = "shutdown";
+const QString ServerController::KeyCommand = "command";
+const QString ServerController::KeyExportPath = "path";
+const QString ServerController::KeyExportTemplates = "templates";
+const QString ServerController::KeyId = "id";
+const QString ServerController::KeyRecordId = "recordId";
+const QString ServerController::KeyError = "error";
+const QString ServerController::KeyExitCode = "exitCode";
+const QString ServerController::KeySuccess = "success";
+
+const QString ServerController::KeyDisplayName = "displayName";
+const QString ServerController::KeyFieldValues = "fieldValues";
+const QString ServerController::KeyHash = "hash";
+const QString ServerController::KeyParentId = "parentId";
+const QString ServerController::KeyRecord = "record";
+const QString ServerController::KeyRecords = "records";
+const QString ServerController::KeyRecordSetName = "recordSetName";
+const QString ServerController::KeyReport = "report";
+const QString ServerController::KeyWritten = "written";
+
+const int ServerController::ServerProbeTimeoutInMilliseconds = 1000;
+
+
+ServerController::ServerController(const ExportController& exportController,
+                                   FileWatcherController& fileWatcherController,
+                                   ProjectController& projectController,
+                                   const RecordsController& recordsController,
+                                   const TasksController& tasksController)
+    : exportController(exportController),
+      fileWatcherController(fileWatcherController),
+      projectController(projectController),
+      recordsController(recordsController),
+      tasksController(tasksController),
+      server(new QLocalServer())
+{
+    connect(
+                this->server,
+                SIGNAL(newConnection()),
+                SLOT(onNewConnection()));
+
+    connect(
+                &this->fileWatcherController,
+                SIGNAL(projectFilesChanged(const QStringList&)),
+                SLOT(onProjectFilesChanged(const QStringList&)));
+}
+
+ServerController::~ServerController()
+{
+    delete this->server;
+}
+
+const QString ServerController::getDefaultServerName(const QString& projectFileName)
+{
+    if (projectFileName.isEmpty())
+    {
+        return "Tome";
+    }
+
+    // Allow serving several projects at the same time.
+    const QString absoluteFilePath = QFileInfo(projectFileName).absoluteFilePath();
+    const QByteArray hash = QCryptographicHash::hash(absoluteFilePath.toUtf8(), QCryptographicHash::Md5).toHex();
+    return "Tome-" + QString::fromLatin1(hash.left(16));
+}
+
+void ServerController::listen(const QString& serverName)
+{
+    // Don't take over from servers that are still running.
+    QLocalSocket probeSocket;
+    probeSocket.connectToServer(serverName);
+
+    if (probeSocket.waitForConnected(ServerProbeTimeoutInMilliseconds))
+    {
+        probeSocket.disconnectFromServer();
+
+        QString errorMessage = QObject::tr("Server could not be started: %1\r\nAnother server is already running.")
+                .arg(serverName);
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::runtime_error(errorMessage.toStdString());
+    }
+
+    // Requests may write files, so only allow the current user to send them.
+    this->server->setSocketOptions(QLocalServer::UserAccessOption);
+
+    bool listening = this->server->listen(serverName);
+
+    if (!listening && this->server->serverError() == QAbstractSocket::AddressInUseError)
+    {
+        // Clean up after servers that didn't shut down properly.
+        QLocalServer::removeServer(serverName);
+        listening = this->server->listen(serverName);
+    }
+
+    if (!listening)
+    {
+        QString errorMessage = QObject::tr("Server could not be started: %1\r\n%2")
+                .arg(serverName, this->server->errorString());
+        qCritical(qUtf8Printable(errorMessage));
+        throw std::runtime_error(errorMessage.toStdString());
+    }
+
+    qInfo(qUtf8Printable(QString("Serving requests at %1.").arg(this->server->fullServerName())));
+
+    this->fileWatcherController.watchProjectFiles();
+}
+
+void ServerController::onNewConnection()
+{
+    while (this->server->hasPendingConnections())
+    {
+        QLocalSocket* socket = this->server->nextPendingConnection();
+
+        connect(
+                    socket,
+                    SIGNAL(readyRead()),
+                    SLOT(onReadyRead()));
+
+        connect(
+                    socket,
+                    SIGNAL(disconnected()),
+                    socket,
+                    SLOT(deleteLater()));
+    }
+}
+
+void ServerController::onProjectFilesChanged(const QStringList& filePaths)
+{
+    Q_UNUSED(filePaths)
+
+    if (this->fileWatcherController.reloadChangedFiles())
+    {
+        return;
+    }
+
+    const QString projectFileName = this->projectController.getFullProjectPath();
+
+    qInfo(qUtf8Printable(QString("Reloading project %1.").arg(projectFileName)));
+
+    try
+    {
+        this->projectController.openProject(projectFileName);
+    }
+    catch (const std::runtime_error& e)
+    {
+        // Keep serving the previous state, and try again with the next change (e.g. file was written only partially).
+        qCritical(e.what());
+    }
+
+    // Files that have been replaced instead of changed are no longer being watched.
+    this->fileWatcherController.watchProjectFiles();
+}
+
+void ServerController::onReadyRead()
+{
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(this->sender());
+
+    if (socket == nullptr)
+    {
+        return;
+    }
+
+    // Handle one request per line.
+    while (socket->canReadLine())
+    {
+        const QByteArray line = socket->readLine().trimmed();
+
+        if (line.isEmpty())
+        {
+            continue;
+        }
+
+        QJsonParseError parseError;
+        const QJsonDocument requestDocument = QJsonDocument::fromJson(line, &parseError);
+
+        QJsonObject response;
+
+        if (!requestDocument.isObject())
+        {
+            response[KeySuccess] = false;
+            response[KeyExitCode] = 1;
+            response[KeyError] = QObject::tr("Invalid request: %1").arg(parseError.errorString());
+        }
+        else
+        {
+            response = this->handleRequest(requestDocument.object());
+        }
+
+        socket->write(QJsonDocument(response).toJson(QJsonDocument::Compact));
+        socket->write("\n");
+        socket->flush();
+
+        if (requestDocument.object().value(KeyCommand).toString() == CommandShutdown)
+        {
+            socket->waitForBytesWritten();
+            QMetaObject::invokeMethod(QCoreApplication::instance(), "quit", Qt::QueuedConnection);
+            return;
+        }
+    }
+}
+
+const QJsonObject ServerController::handleRequest(const QJsonObject& request)
+{
+    const QString command = request.value(KeyCommand).toString();
+
+    qInfo(qUtf8Printable(QString("Handling %1 request.").arg(command)));
+
+    QJsonObject response;
+
+    try
+    {
+        if (!this->projectController.isProjectLoaded())
+        {
+            throw std::runtime_error(QObject::tr("No project loaded.").toStdString());
+        }
+
+        if (command == CommandCheck)
+        {
+            response = this->handleCheckRequest(request);
+        }
+        else if (command == CommandExport)
+        {
+            response = this->handleExportRequest(request);
+        }
+        else if (command == CommandQuery)
+        {
+            response = this->handleQueryRequest(request);
+        }
+        else if (command == CommandShutdown)
+        {
+            response[KeySuccess] = true;
+            response[KeyExitCode] = 0;
+        }
+        else
+        {
+            throw std::out_of_range(QObject::tr("Unknown command: %1").arg(command).toStdString());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        response = QJsonObject();
+        response[KeySuccess] = false;
+        response[KeyExitCode] = 1;
+        response[KeyError] = QString(e.what());
+    }
+
+    if (request.contains(KeyId))
+    {
+        response[KeyId] = request.value(KeyId);
+    }
+
+    return response;
+}
+
+const QJsonObject ServerController::handleCheckRequest(const QJsonObject& request)
+{
+    Q_UNUSED(request)
+
+    const TaskResultList results = this->tasksController.runAllTasksInParallel();
+    const QJsonObject report = TaskResultSerializer().toJson(results);
+
+    QJsonObject response;
+    response[KeySuccess] = true;
+    response[KeyExitCode] = report.value("errors").toInt() > 0 ? 1 : 0;
+    response[KeyReport] = report;
+    return response;
+}
+
+const QJsonObject ServerController::handleExportRequest(const QJsonObject& request)
+{
+    QStringList exportTemplateNames;
+
+    for (const QJsonValue& exportTemplateName : request.value(KeyExportTemplates).toArray())
+    {
+        exportTemplateNames << exportTemplateName.toString();
+    }
+
+    const QString exportPath = request.value(KeyExportPath).toString();
+
+    if (exportTemplateNames.isEmpty() || exportPath.isEmpty())
+    {
+        throw std::out_of_range(QObject::tr("Export requires templates and path.").toStdString());
+    }
+
+    const int written = this->exportController.exportChangedRecords(exportTemplateNames, exportPath);
+
+    QJsonObject response;
+    response[KeySuccess] = true;
+    response[KeyExitCode] = 0;
+    response[KeyWritten] = written;
+    return response;
+}
+
+const QJsonObject ServerController::handleQueryRequest(const QJsonObject& request)
+{
+    QJsonObject response;
+    response[KeySuccess] = true;
+    response[KeyExitCode] = 0;
+
+    if (!request.contains(KeyRecordId))
+    {
+        // List all records.
+        response[KeyHash] = this->recordsController.computeRecordsHash();
+        response[KeyRecords] = QJsonArray::fromVariantList(this->recordsController.getRecordIds());
+        return response;
+    }
+
+    // Get single record, including inherited field values.
+    const QVariant recordId = request.value(KeyRecordId).toVariant();
+    const Record& record = this->recordsController.getRecord(recordId);
+
+    QJsonObject recordObject;
+    recordObject[KeyRecordId] = record.id.toString();
+    recordObject[KeyDisplayName] = record.displayName;
+    recordObject[KeyParentId] = record.parentId.toString();
+    recordObject[KeyRecordSetName] = record.recordSetName;
+    recordObject[KeyFieldValues] = QJsonObject::fromVariantMap(this->recordsController.getRecordFieldValues(recordId));
+
+    response[KeyRecord] = recordObject;
+    return response;
+}
@@ -0,0 +1,159 @@
+#ifndef SERVERCONTROLLER_H
+#define SERVERCONTROLLER_H
+
+#include <QJsonObject>
+#include <QObject>
+#include <QStringList>
+
+class QLocalServer;
+class QLocalSocket;
+
+namespace Tome
+{
+    class ExportController;
+    class FileWatcherController;
+    class ProjectController;
+    class RecordsController;
+    class TasksController;
+
+    /**
+     * @brief Keeps the current project loaded and serves export, check and query requests from other processes over a local socket.
+     *
+     * Requests and responses are JSON objects, each written in a single line.
+     * Every request has a "command" (export, check, query or shutdown) and an optional "id" which is passed back in the response.
+     * Every response has a "success" flag, an "exitCode" for command-line clients, and an "error" text if the request failed.
+     *
+     * Project files are watched, and changed files are reloaded as soon as they have been written.
+     */
+    class ServerController : public QObject
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new controller for serving requests from other processes.
+             * @param exportController Controller for exporting records using templates.
+             * @param fileWatcherController Controller for watching project files.
+             * @param projectController Controller for creating, loading and saving projects.
+             * @param recordsController Controller for adding, updating and removing records.
+             * @param tasksController Controller for runnings tasks on all records.
+             */
+            ServerController(const ExportController& exportController,
+                             FileWatcherController& fileWatcherController,
+                             ProjectController& projectController,
+                             const RecordsController& recordsController,
+                             const TasksController& tasksController);
+            ~ServerController();
+
+            /**
+             * @brief Gets the name of the local socket to serve requests for the specified project at, if no other name is specified.
+             * @param projectFileName Name of the project file to serve requests for.
+             * @return Name of the local socket to serve requests for the specified project at.
+             */
+            static const QString getDefaultServerName(const QString& projectFileName);
+
+            /**
+             * @brief Starts serving requests at the local socket with the specified name, and starts watching all project files.
+             *
+             * Only the current user may connect to the socket.
+             *
+             * @exception std::runtime_error if another server is already serving requests at that socket, or the local socket could not be opened.
+             *
+             * @param serverName Name of the local socket to serve requests at.
+             */
+            void listen(const QString& serverName);
+
+            /**
+             * @brief Runs all integrity checks and responds with their results.
+             */
+            static const QString CommandCheck;
+
+            /**
+             * @brief Exports all records using the specified templates, skipping files that are already up-to-date.
+             */
+            static const QString CommandExport;
+
+            /**
+             * @brief Responds with the specified record, or with the ids of all records if none is specified.
+             */
+            static const QString CommandQuery;
+
+            /**
+             * @brief Stops serving requests and quits the application.
+             */
+            static const QString CommandShutdown;
+
+            /**
+             * @brief Name of the request property containing the command to execute.
+             */
+            static const QString KeyCommand;
+
+            /**
+             * @brief Name of the request property containing the path to export to, without file extension.
+             */
+            static const QString KeyExportPath;
+
+            /**
+             * @brief Name of the request property containing the names of the export templates to use.
+             */
+            static const QString KeyExportTemplates;
+
+            /**
+             * @brief Name of the request and response property identifying the request.
+             */
+            static const QString KeyId;
+
+            /**
+             * @brief Name of the request property containing the id of the record to query.
+             */
+            static const QString KeyRecordId;
+
+            /**
+             * @brief Name of the response property containing the error, if the request failed.
+             */
+            static const QString KeyError;
+
+            /**
+             * @brief Name of the response property containing the exit code for command-line clients.
+             */
+            static const QString KeyExitCode;
+
+            /**
+             * @brief Name of the response property telling whether the request succeeded.
+             */
+            static const QString KeySuccess;
+
+        private slots:
+            void onNewConnection();
+            void onProjectFilesChanged(const QStringList& filePaths);
+            void onReadyRead();
+
+        private:
+            static const QString KeyDisplayName;
+            static const QString KeyFieldValues;
+            static const QString KeyHash;
+            static const QString KeyParentId;
+            static const QString KeyRecord;
+            static const QString KeyRecords;
+            static const QString KeyRecordSetName;
+            static const QString KeyReport;
+            static const QString KeyWritten;
+
+            static const int ServerProbeTimeoutInMilliseconds;
+
+            const ExportController& exportController;
+            FileWatcherController& fileWatcherController;
+            ProjectController& projectController;
+            const RecordsController& recordsController;
+            const TasksController& tasksController;
+
+            QLocalServer* server;
+
+            const QJsonObject handleRequest(const QJsonObject& request);
+            const QJsonObject handleCheckRequest(const QJsonObject& request);
+            const QJsonObject handleExportRequest(const QJsonObject& request);
+            const QJsonObject handleQueryRequest(const QJsonObject& request);
+    };
+}
+
+#endif // SERVERCONTROLLER_H
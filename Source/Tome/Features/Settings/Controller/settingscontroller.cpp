@@ -5,6 +5,8 @@
 using namespace Tome;
 
 
+const int SettingsController::DefaultUndoMemoryLimit = 64;
+
 const QString SettingsController::SettingPath = "path";
 const QString SettingsController::SettingRecentProjects = "recentProjects";
 const QString SettingsController::SettingRunIntegrityChecksOnLoad = "runIntegrityChecksOnLoad";
@@ -12,6 +14,8 @@ const QString SettingsController::SettingRunIntegrityChecksOnSave = "runIntegrit
 const QString SettingsController::SettingShowComponentNamesInRecordTable = "showComponentNamesInRecordTable";
 const QString SettingsController::SettingShowDescriptionColumnInsteadOfFieldTooltips = "showDetailsColumnInsteadOfFieldTooltips";
 const QString SettingsController::SettingExpandRecordTreeOnRefresh = "expandRecordTreeOnRefresh";
+const QString SettingsController::SettingRecordPerformanceTrace = "recordPerformanceTrace";
+const QString SettingsController::SettingUndoMemoryLimit = "undoMemoryLimit";
 const QString SettingsController::SettingLastProjectPath = "lastProjectPath";
 
 
@@ -82,6 +86,16 @@ bool SettingsController::getExpandRecordTreeOnRefresh() const
     return this->settings->value(SettingExpandRecordTreeOnRefresh).toBool();
 }
 
+bool SettingsController::getRecordPerformanceTrace() const
+{
+    return this->settings->value(SettingRecordPerformanceTrace).toBool();
+}
+
+int SettingsController::getUndoMemoryLimit() const
+{
+    return this->settings->value(SettingUndoMemoryLimit, DefaultUndoMemoryLimit).toInt();
+}
+
 const QString SettingsController::getLastProjectPath() const
 {
     return this->settings->value(SettingLastProjectPath).toString();
@@ -142,6 +156,20 @@ void SettingsController::setExpandRecordTreeOnRefresh(bool expandRecordTreeOnRef
     this->settings->setValue(SettingExpandRecordTreeOnRefresh, expandRecordTreeOnRefresh);
 }
 
+void SettingsController::setRecordPerformanceTrace(bool recordPerformanceTrace)
+{
+    qInfo(qUtf8Printable(QString("Setting record performance trace to %1.")
+          .arg(recordPerformanceTrace ? "true" : "false")));
+    this->settings->setValue(SettingRecordPerformanceTrace, recordPerformanceTrace);
+}
+
+void SettingsController::setUndoMemoryLimit(int undoMemoryLimit)
+{
+    qInfo(qUtf8Printable(QString("Setting undo memory limit to %1 MB.")
+          .arg(undoMemoryLimit)));
+    this->settings->setValue(SettingUndoMemoryLimit, undoMemoryLimit);
+}
+
 void SettingsController::setLastProjectPath( const QString &path )
 
 {
@@ -60,6 +60,18 @@ namespace Tome
              */
             bool getExpandRecordTreeOnRefresh() const;
 
+            /**
+             * @brief Gets whether to record how long loading, saving, exporting and running tasks takes, for finding performance issues.
+             * @return Whether to record a performance trace, or not.
+             */
+            bool getRecordPerformanceTrace() const;
+
+            /**
+             * @brief Gets the maximum size of the undo history, in megabytes.
+             * @return Maximum size of the undo history, in megabytes.
+             */
+            int getUndoMemoryLimit() const;
+
             /**
              * @brief Gets the full path to the most recently opened project.
              * @return Full path of the most recently opened project.
@@ -108,6 +120,18 @@ namespace Tome
              */
             void setExpandRecordTreeOnRefresh(bool expandRecordTreeOnRefresh);
 
+            /**
+             * @brief Sets whether to record how long loading, saving, exporting and running tasks takes, for finding performance issues.
+             * @param recordPerformanceTrace Whether to record a performance trace.
+             */
+            void setRecordPerformanceTrace(bool recordPerformanceTrace);
+
+            /**
+             * @brief Sets the maximum size of the undo history, in megabytes. The oldest commands are discarded first.
+             * @param undoMemoryLimit Maximum size of the undo history, in megabytes.
+             */
+            void setUndoMemoryLimit(int undoMemoryLimit);
+
             /**
              * @brief Sets the full path to the most recently opened project.
              * @param path Full path to the most recently opened project.
@@ -115,6 +139,8 @@ namespace Tome
             void setLastProjectPath(const QString &path);
 
         private:
+            static const int DefaultUndoMemoryLimit;
+
             static const QString SettingPath;
             static const QString SettingRecentProjects;
             static const QString SettingRunIntegrityChecksOnLoad;
@@ -122,6 +148,8 @@ namespace Tome
             static const QString SettingShowComponentNamesInRecordTable;
             static const QString SettingShowDescriptionColumnInsteadOfFieldTooltips;
             static const QString SettingExpandRecordTreeOnRefresh;
+            static const QString SettingRecordPerformanceTrace;
+            static const QString SettingUndoMemoryLimit;
             static const QString SettingLastProjectPath;
 
             QSettings* settings;
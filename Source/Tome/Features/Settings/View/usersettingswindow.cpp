@@ -45,6 +45,16 @@ bool UserSettingsWindow::getExpandRecordTreeOnRefresh()
     return this->ui->checkBoxExpandRecordTreeOnRefresh->isChecked();
 }
 
+bool UserSettingsWindow::getRecordPerformanceTrace()
+{
+    return this->ui->checkBoxRecordPerformanceTrace->isChecked();
+}
+
+int UserSettingsWindow::getUndoMemoryLimit()
+{
+    return this->ui->spinBoxUndoMemoryLimit->value();
+}
+
 void UserSettingsWindow::showEvent(QShowEvent* event)
 {
     Q_UNUSED(event)
@@ -64,4 +74,10 @@ void UserSettingsWindow::showEvent(QShowEvent* event)
 
     bool expandRecordTreeOnRefresh = this->settingsController.getExpandRecordTreeOnRefresh();
     this->ui->checkBoxExpandRecordTreeOnRefresh->setChecked(expandRecordTreeOnRefresh);
+
+    bool recordPerformanceTrace = this->settingsController.getRecordPerformanceTrace();
+    this->ui->checkBoxRecordPerformanceTrace->setChecked(recordPerformanceTrace);
+
+    int undoMemoryLimit = this->settingsController.getUndoMemoryLimit();
+    this->ui->spinBoxUndoMemoryLimit->setValue(undoMemoryLimit);
 }
@@ -60,6 +60,18 @@ class UserSettingsWindow : public QDialog
          */
         bool getExpandRecordTreeOnRefresh();
 
+        /**
+         * @brief Gets whether to record how long loading, saving, exporting and running tasks takes, for finding performance issues.
+         * @return Whether to record a performance trace, or not.
+         */
+        bool getRecordPerformanceTrace();
+
+        /**
+         * @brief Gets the maximum size of the undo history, in megabytes.
+         * @return Maximum size of the undo history, in megabytes.
+         */
+        int getUndoMemoryLimit();
+
     protected:
         /**
          * @brief Sets up this window, updating the view with the stored settings.
@@ -0,0 +1,204 @@
+#include "taskresultserializer.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QXmlStreamWriter>
+
+#include "../../Diagnostics/Controller/tracer.h"
+
+using namespace Tome;
+
+
+const QString TaskResultSerializer::AttributeClassName = "classname";
+const QString TaskResultSerializer::AttributeFailures = "failures";
+const QString TaskResultSerializer::AttributeMessage = "message";
+const QString TaskResultSerializer::AttributeName = "name";
+const QString TaskResultSerializer::AttributeTests = "tests";
+const QString TaskResultSerializer::AttributeTime = "time";
+const QString TaskResultSerializer::AttributeType = "type";
+const QString TaskResultSerializer::ElementFailure = "failure";
+const QString TaskResultSerializer::ElementSystemOut = "system-out";
+const QString TaskResultSerializer::ElementTestCase = "testcase";
+const QString TaskResultSerializer::ElementTestSuite = "testsuite";
+const QString TaskResultSerializer::ElementTestSuites = "testsuites";
+const QString TaskResultSerializer::KeyContent = "content";
+const QString TaskResultSerializer::KeyElapsedMilliseconds = "elapsedMilliseconds";
+const QString TaskResultSerializer::KeyErrors = "errors";
+const QString TaskResultSerializer::KeyHelpLink = "helpLink";
+const QString TaskResultSerializer::KeyInformation = "information";
+const QString TaskResultSerializer::KeyMessageCode = "messageCode";
+const QString TaskResultSerializer::KeyMessages = "messages";
+const QString TaskResultSerializer::KeyName = "name";
+const QString TaskResultSerializer::KeySeverity = "severity";
+const QString TaskResultSerializer::KeyTargetSiteId = "targetSiteId";
+const QString TaskResultSerializer::KeyTargetSiteType = "targetSiteType";
+const QString TaskResultSerializer::KeyTasks = "tasks";
+const QString TaskResultSerializer::KeyWarnings = "warnings";
+
+
+TaskResultSerializer::TaskResultSerializer()
+{
+}
+
+void TaskResultSerializer::serializeJson(QIODevice& device, const TaskResultList& results) const
+{
+    TOME_TRACE("Serialization", "serializeTaskResultsJson");
+
+    device.write(QJsonDocument(this->toJson(results)).toJson());
+}
+
+const QJsonObject TaskResultSerializer::toJson(const TaskResultList& results) const
+{
+    QJsonArray tasks;
+    int errors = 0;
+    int warnings = 0;
+    int information = 0;
+
+    for (const TaskResult& result : results)
+    {
+        QJsonArray messages;
+
+        for (const Message& message : result.messages)
+        {
+            QJsonObject messageObject;
+            messageObject[KeySeverity] = Severity::toString(message.severity);
+            messageObject[KeyMessageCode] = message.messageCode;
+            messageObject[KeyContent] = message.content;
+            messageObject[KeyHelpLink] = message.helpLink;
+            messageObject[KeyTargetSiteType] = TargetSiteType::toString(message.targetSiteType);
+            messageObject[KeyTargetSiteId] = message.targetSiteId.toString();
+            messages.append(messageObject);
+
+            switch (message.severity)
+            {
+                case Severity::Error:
+                    ++errors;
+                    break;
+
+                case Severity::Warning:
+                    ++warnings;
+                    break;
+
+                case Severity::Information:
+                    ++information;
+                    break;
+            }
+        }
+
+        QJsonObject taskObject;
+        taskObject[KeyName] = result.taskName;
+        taskObject[KeyElapsedMilliseconds] = result.elapsedMilliseconds;
+        taskObject[KeyMessages] = messages;
+        tasks.append(taskObject);
+    }
+
+    QJsonObject root;
+    root[KeyErrors] = errors;
+    root[KeyWarnings] = warnings;
+    root[KeyInformation] = information;
+    root[KeyTasks] = tasks;
+
+    return root;
+}
+
+void TaskResultSerializer::serializeJUnit(QIODevice& device, const TaskResultList& results) const
+{
+    TOME_TRACE("Serialization", "serializeTaskResultsJUnit");
+
+    // Count tests.
+    int failures = 0;
+    qint64 elapsedMilliseconds = 0;
+
+    for (const TaskResult& result : results)
+    {
+        for (const Message& message : result.messages)
+        {
+            if (message.severity == Severity::Error)
+            {
+                ++failures;
+                break;
+            }
+        }
+
+        elapsedMilliseconds += result.elapsedMilliseconds;
+    }
+
+    const QString tests = QString::number(results.count());
+    const QString time = QString::number(elapsedMilliseconds / 1000.0, 'f', 3);
+
+    // Open device stream.
+    QXmlStreamWriter writer(&device);
+    writer.setAutoFormatting(true);
+
+    // Begin document.
+    writer.writeStartDocument();
+    {
+        writer.writeStartElement(ElementTestSuites);
+        writer.writeAttribute(AttributeName, "Tome");
+        writer.writeAttribute(AttributeTests, tests);
+        writer.writeAttribute(AttributeFailures, QString::number(failures));
+        writer.writeAttribute(AttributeTime, time);
+        {
+            writer.writeStartElement(ElementTestSuite);
+            writer.writeAttribute(AttributeName, "Integrity");
+            writer.writeAttribute(AttributeTests, tests);
+            writer.writeAttribute(AttributeFailures, QString::number(failures));
+            writer.writeAttribute(AttributeTime, time);
+            {
+                // Write one test case per task.
+                for (const TaskResult& result : results)
+                {
+                    QStringList errors;
+                    QStringList otherMessages;
+
+                    for (const Message& message : result.messages)
+                    {
+                        if (message.severity == Severity::Error)
+                        {
+                            errors << this->formatMessage(message);
+                        }
+                        else
+                        {
+                            otherMessages << this->formatMessage(message);
+                        }
+                    }
+
+                    writer.writeStartElement(ElementTestCase);
+                    writer.writeAttribute(AttributeClassName, "Tome.Integrity");
+                    writer.writeAttribute(AttributeName, result.taskName);
+                    writer.writeAttribute(AttributeTime, QString::number(result.elapsedMilliseconds / 1000.0, 'f', 3));
+                    {
+                        if (!errors.isEmpty())
+                        {
+                            writer.writeStartElement(ElementFailure);
+                            writer.writeAttribute(AttributeMessage, QString("%1 error(s)").arg(errors.count()));
+                            writer.writeAttribute(AttributeType, Severity::toString(Severity::Error));
+                            writer.writeCharacters(errors.join("\n"));
+                            writer.writeEndElement();
+                        }
+
+                        if (!otherMessages.isEmpty())
+                        {
+                            writer.writeTextElement(ElementSystemOut, otherMessages.join("\n"));
+                        }
+                    }
+                    writer.writeEndElement();
+                }
+            }
+            writer.writeEndElement();
+        }
+        writer.writeEndElement();
+    }
+    // End document.
+    writer.writeEndDocument();
+}
+
+const QString TaskResultSerializer::formatMessage(const Message& message) const
+{
+    return QString("[%1] %2: %3 (%4 - %5)")
+            .arg(Severity::toString(message.severity),
+                 message.messageCode,
+                 message.content,
+                 TargetSiteType::toString(message.targetSiteType),
+                 message.targetSiteId.toString());
+}
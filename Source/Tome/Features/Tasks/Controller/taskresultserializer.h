@@ -0,0 +1,77 @@
+#ifndef TASKRESULTSERIALIZER_H
+#define TASKRESULTSERIALIZER_H
+
+#include <QIODevice>
+#include <QJsonObject>
+
+#include "../Model/taskresultlist.h"
+
+namespace Tome
+{
+    /**
+     * @brief Writes task results to any device, for being processed by other tools (e.g. continuous integration servers).
+     */
+    class TaskResultSerializer
+    {
+        public:
+            /**
+             * @brief Constructs a new serializer for writing task results to any device.
+             */
+            TaskResultSerializer();
+
+            /**
+             * @brief Writes the passed task results to the specified device as JSON document.
+             * @param device Device to write the task results to.
+             * @param results Task results to write.
+             */
+            void serializeJson(QIODevice& device, const TaskResultList& results) const;
+
+            /**
+             * @brief Writes the passed task results to the specified device as JUnit XML report, with one test case per task.
+             *
+             * Errors make a test case fail. Warnings and information messages are written to the standard output of their test case.
+             *
+             * @param device Device to write the task results to.
+             * @param results Task results to write.
+             */
+            void serializeJUnit(QIODevice& device, const TaskResultList& results) const;
+
+            /**
+             * @brief Converts the passed task results to a JSON object, as written by serializeJson.
+             * @param results Task results to convert.
+             * @return JSON object containing the passed task results and the number of errors, warnings and information messages.
+             */
+            const QJsonObject toJson(const TaskResultList& results) const;
+
+        private:
+            static const QString AttributeClassName;
+            static const QString AttributeFailures;
+            static const QString AttributeMessage;
+            static const QString AttributeName;
+            static const QString AttributeTests;
+            static const QString AttributeTime;
+            static const QString AttributeType;
+            static const QString ElementFailure;
+            static const QString ElementSystemOut;
+            static const QString ElementTestCase;
+            static const QString ElementTestSuite;
+            static const QString ElementTestSuites;
+            static const QString KeyContent;
+            static const QString KeyElapsedMilliseconds;
+            static const QString KeyErrors;
+            static const QString KeyHelpLink;
+            static const QString KeyInformation;
+            static const QString KeyMessageCode;
+            static const QString KeyMessages;
+            static const QString KeyName;
+            static const QString KeySeverity;
+            static const QString KeyTargetSiteId;
+            static const QString KeyTargetSiteType;
+            static const QString KeyTasks;
+            static const QString KeyWarnings;
+
+            const QString formatMessage(const Message& message) const;
+    };
+}
+
+#endif // TASKRESULTSERIALIZER_H
@@ -1,16 +1,55 @@
 #include "taskscontroller.h"
 
+#include <QElapsedTimer>
+#include <QRunnable>
+#include <QThreadPool>
+
 #include "task.h"
 #include "../Model/taskcontext.h"
 
 #include "../../Components/Controller/componentscontroller.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../Fields/Controller/fielddefinitionscontroller.h"
 #include "../../Records/Controller/recordscontroller.h"
 #include "../../Types/Controller/typescontroller.h"
+#include "../../../Util/progressreporter.h"
 
 using namespace Tome;
 
 
+namespace Tome
+{
+    /**
+     * @brief Runs a single task on a worker thread, and stores its messages and execution time.
+     */
+    class TaskRunner : public QRunnable
+    {
+        public:
+            TaskRunner(const Task& task, const TaskContext& context, TaskResult& result)
+                : task(task),
+                  context(context),
+                  result(result)
+            {
+            }
+
+            void run() Q_DECL_OVERRIDE
+            {
+                QElapsedTimer timer;
+                timer.start();
+
+                TOME_TRACE("Tasks", this->result.taskName);
+                this->result.messages = this->task.execute(this->context);
+                this->result.elapsedMilliseconds = timer.elapsed();
+            }
+
+        private:
+            const Task& task;
+            const TaskContext& context;
+            TaskResult& result;
+    };
+}
+
+
 TasksController::TasksController(const ComponentsController& componentsController,
         const FacetsController& facetsController,
         const FieldDefinitionsController& fieldDefinitionsController,
@@ -41,6 +80,8 @@ void TasksController::addTask(Task* task)
 
 const MessageList TasksController::runAllTasks() const
 {
+    TOME_TRACE("Tasks", "runAllTasks");
+
     // Build context.
     TaskContext context(
                 this->componentsController,
@@ -54,15 +95,26 @@ const MessageList TasksController::runAllTasks() const
     MessageList messages;
 
     // Run all tasks.
+    ProgressReporter progress(tr("Running Tasks"), this->tasks.count(), ProgressReporter::forSignal(this, &TasksController::progressChanged), true);
+
     for (int i = 0; i < this->tasks.count(); ++i)
     {
         const Task* task = this->tasks.at(i);
 
         // Update progress.
-        emit this->progressChanged(tr("Running Tasks"), task->getDisplayName(), i, this->tasks.count());
+        if (!progress.update(i, task->getDisplayName()))
+        {
+            qInfo("Running tasks canceled.");
+            break;
+        }
 
         // Run task.
-        const MessageList taskMessages = task->execute(context);
+        MessageList taskMessages;
+
+        {
+            TOME_TRACE("Tasks", task->getDisplayName());
+            taskMessages = task->execute(context);
+        }
 
         // Compose messages.
         for (int j = 0; j < taskMessages.count(); ++j)
@@ -72,7 +124,44 @@ const MessageList TasksController::runAllTasks() const
         }
     }
 
-    emit this->progressChanged(tr("Running Tasks"), QString(), 1, 1);
+    progress.finish();
 
     return messages;
 }
+
+const TaskResultList TasksController::runAllTasksInParallel() const
+{
+    TOME_TRACE("Tasks", "runAllTasksInParallel");
+
+    // Build context.
+    TaskContext context(
+                this->componentsController,
+                this->facetsController,
+                this->fieldDefinitionsController,
+                this->projectController,
+                this->recordsController,
+                this->typesController);
+
+    // Prepare results, so that workers never need to resize the list.
+    TaskResultList results;
+
+    for (const Task* task : this->tasks)
+    {
+        TaskResult result;
+        result.taskName = task->getDisplayName();
+        results << result;
+    }
+
+    // Run all tasks. Tasks only read project data, so they can share the context.
+    // Indexes that are built lazily by const queries (e.g. record hierarchy labels and search indexes) are guarded by their controllers.
+    QThreadPool threadPool;
+
+    for (int i = 0; i < this->tasks.count(); ++i)
+    {
+        threadPool.start(new TaskRunner(*this->tasks[i], context, results[i]));
+    }
+
+    threadPool.waitForDone();
+
+    return results;
+}
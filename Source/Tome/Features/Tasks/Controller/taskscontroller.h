@@ -5,6 +5,7 @@
 #include <QObject>
 
 #include "../Model/messagelist.h"
+#include "../Model/taskresultlist.h"
 
 
 namespace Tome
@@ -55,6 +56,15 @@ namespace Tome
              */
             const MessageList runAllTasks() const;
 
+            /**
+             * @brief Runs all registered automated tasks on worker threads at the same time, measuring how long each task takes.
+             *
+             * Doesn't report any progress, as tasks can finish in any order.
+             *
+             * @return Results of all tasks, in the order the tasks have been registered in.
+             */
+            const TaskResultList runAllTasksInParallel() const;
+
         signals:
             /**
              * @brief Progress of the current tasks operation has changed.
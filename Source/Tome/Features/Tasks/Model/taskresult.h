@@ -0,0 +1,33 @@
+#ifndef TASKRESULT_H
+#define TASKRESULT_H
+
+#include <QString>
+
+#include "messagelist.h"
+
+namespace Tome
+{
+    /**
+     * @brief Outcome of running a single automated task.
+     */
+    class TaskResult
+    {
+        public:
+            /**
+             * @brief Localized display name of the task.
+             */
+            QString taskName;
+
+            /**
+             * @brief Messages, warnings and errors generated by the task.
+             */
+            MessageList messages;
+
+            /**
+             * @brief Time it took to execute the task, in milliseconds.
+             */
+            qint64 elapsedMilliseconds = 0;
+    };
+}
+
+#endif // TASKRESULT_H
@@ -0,0 +1,12 @@
+#ifndef TASKRESULTLIST_H
+#define TASKRESULTLIST_H
+
+#include <QList>
+#include "taskresult.h"
+
+namespace Tome
+{
+    typedef QList<TaskResult> TaskResultList;
+}
+
+#endif // TASKRESULTLIST_H
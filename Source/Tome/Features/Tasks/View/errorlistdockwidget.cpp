@@ -1,8 +1,12 @@
 #include "errorlistdockwidget.h"
 
+#include <QDesktopServices>
 #include <QHeaderView>
-#include <QLabel>
 #include <QString>
+#include <QUrl>
+
+#include "errorlistfilterproxymodel.h"
+#include "errorlistmodel.h"
 
 using namespace Tome;
 
@@ -40,20 +44,34 @@ ErrorListDockWidget::ErrorListDockWidget(QWidget* parent) :
     this->toolButtonsLayout->addWidget(this->toolButtonWarnings);
     this->toolButtonsLayout->addWidget(this->toolButtonMessages);
 
+    // Add message code filter.
+    this->comboBoxMessageCode = new QComboBox();
+    this->comboBoxMessageCode->setSizeAdjustPolicy(QComboBox::AdjustToContents);
+    this->toolButtonsLayout->addWidget(this->comboBoxMessageCode);
+
     this->toolButtonsLayout->addStretch(1);
 
     this->verticalLayout->addLayout(this->toolButtonsLayout);
 
     // Add error list.
-    this->tableWidgetErrorList = new QTableWidget();
-    this->tableWidgetErrorList->setEditTriggers(QTableWidget::NoEditTriggers);
-    this->tableWidgetErrorList->setSelectionMode(QTableWidget::SingleSelection);
-    this->tableWidgetErrorList->setSelectionBehavior(QTableWidget::SelectRows);
-    this->tableWidgetErrorList->horizontalHeader()->setStretchLastSection(true);
-    this->tableWidgetErrorList->verticalHeader()->setVisible(false);
-    this->tableWidgetErrorList->setSortingEnabled(true);
+    this->errorListModel = new ErrorListModel(this);
+    this->errorListProxyModel = new ErrorListFilterProxyModel(*this->errorListModel, this);
+
+    this->tableViewErrorList = new QTableView();
+    this->tableViewErrorList->setModel(this->errorListProxyModel);
+    this->tableViewErrorList->setEditTriggers(QTableView::NoEditTriggers);
+    this->tableViewErrorList->setSelectionMode(QTableView::SingleSelection);
+    this->tableViewErrorList->setSelectionBehavior(QTableView::SelectRows);
+    this->tableViewErrorList->horizontalHeader()->setStretchLastSection(true);
+    this->tableViewErrorList->verticalHeader()->setVisible(false);
+    this->tableViewErrorList->setSortingEnabled(true);
+
+    // Size columns by a sample of the messages only.
+    this->tableViewErrorList->horizontalHeader()->setResizeContentsPrecision(100);
 
-    this->verticalLayout->addWidget(this->tableWidgetErrorList);
+    this->verticalLayout->addWidget(this->tableViewErrorList);
+
+    this->refreshMessageCodes();
 
     // Finish layout.
     this->widget->setLayout(this->verticalLayout);
@@ -77,12 +95,27 @@ ErrorListDockWidget::ErrorListDockWidget(QWidget* parent) :
                 SIGNAL(toggled(bool)),
                 SLOT(onToolButtonWarningsToggled(bool))
                 );
+
+    connect(
+                this->comboBoxMessageCode,
+                SIGNAL(currentIndexChanged(int)),
+                SLOT(onComboBoxMessageCodeCurrentIndexChanged(int))
+                );
+
+    connect(
+                this->tableViewErrorList,
+                SIGNAL(clicked(const QModelIndex&)),
+                SLOT(onTableViewErrorListClicked(const QModelIndex&))
+                );
 }
 
 ErrorListDockWidget::~ErrorListDockWidget()
 {
-    delete this->tableWidgetErrorList;
+    delete this->tableViewErrorList;
+    delete this->errorListProxyModel;
+    delete this->errorListModel;
 
+    delete this->comboBoxMessageCode;
     delete this->toolButtonWarnings;
     delete this->toolButtonMessages;
     delete this->toolButtonErrors;
@@ -96,167 +129,87 @@ ErrorListDockWidget::~ErrorListDockWidget()
 
 void ErrorListDockWidget::showMessages(const MessageList& messages)
 {
-    this->messages = messages;
-    this->refreshMessages();
-}
+    this->errorListModel->setMessages(messages);
 
-void ErrorListDockWidget::refreshMessages()
-{
-    // Reset output window.
-    this->tableWidgetErrorList->setRowCount(this->messages.count());
-    this->tableWidgetErrorList->setColumnCount(4);
+    // Finish layout.
+    this->tableViewErrorList->resizeColumnsToContents();
 
-    QStringList headers;
-    headers << tr("Severity");
-    headers << tr("Code");
-    headers << tr("Message");
-    headers << tr("Location");
+    // Show item counts.
+    this->refreshSeverityCounts();
+    this->refreshMessageCodes();
+}
 
-    this->tableWidgetErrorList->setHorizontalHeaderLabels(headers);
+void ErrorListDockWidget::refreshMessageCodes()
+{
+    const QString selectedMessageCode = this->comboBoxMessageCode->currentData().toString();
 
-    // Show results.
-    int messagesShown = 0;
+    // Group messages by code.
+    this->comboBoxMessageCode->blockSignals(true);
+    this->comboBoxMessageCode->clear();
+    this->comboBoxMessageCode->addItem(tr("All Codes"), QString());
 
-    int errors = 0;
-    int warnings = 0;
-    int messages = 0;
+    const QStringList messageCodes = this->errorListModel->getMessageCodes();
 
-    for (int i = 0; i < this->messages.count(); ++i)
+    for (const QString& messageCode : messageCodes)
     {
-        const Message message = this->messages.at(i);
-
-        // Update progress bar.
-        if (i % 10 == 0)
-        {
-            emit this->progressChanged(tr("Refreshing Error List"), QString(), i, this->messages.count());
-        }
-
-        // Check filter.
-        switch (message.severity)
-        {
-            case Severity::Error:
-                ++errors;
-
-                if (!this->toolButtonErrors->isChecked())
-                {
-                    continue;
-                }
-                break;
-
-            case Severity::Warning:
-                ++warnings;
-
-                if (!this->toolButtonWarnings->isChecked())
-                {
-                    continue;
-                }
-                break;
-
-            case Severity::Information:
-                ++messages;
-
-                if (!this->toolButtonMessages->isChecked())
-                {
-                    continue;
-                }
-                break;
-
-            default:
-                break;
-        }
-
-        // Show severity.
-        this->tableWidgetErrorList->setItem(messagesShown, 0, new QTableWidgetItem(Severity::toString(message.severity)));
-
-        switch (message.severity)
-        {
-            case Severity::Error:
-                this->tableWidgetErrorList->item(messagesShown, 0)->setData(Qt::DecorationRole, QIcon(":/Error"));
-                break;
-
-            case Severity::Warning:
-                this->tableWidgetErrorList->item(messagesShown, 0)->setData(Qt::DecorationRole, QIcon(":/Warning"));
-                break;
-
-            case Severity::Information:
-                this->tableWidgetErrorList->item(messagesShown, 0)->setData(Qt::DecorationRole, QIcon(":/Information"));
-                break;
-
-            default:
-                break;
-        }
-
-        // Show help link.
-        QString helpLink = message.helpLink.isEmpty() ? "https://github.com/npruehs/tome-editor/wiki/" + message.messageCode : message.helpLink;
-        QLabel* helpLinkLabel = new QLabel("<a href=\"" + helpLink + "\">" + message.messageCode + "</a>");
-        helpLinkLabel->setToolTip(helpLink);
-        helpLinkLabel->setOpenExternalLinks(true);
-
-        QModelIndex index = this->tableWidgetErrorList->model()->index(messagesShown, 1);
-        this->tableWidgetErrorList->setIndexWidget(index, helpLinkLabel);
-
-        // Show message.
-        this->tableWidgetErrorList->setItem(messagesShown, 2, new QTableWidgetItem(message.content));
-
-        // Show location.
-        QLabel* locationLabel;
-
-        if (message.targetSiteType == TargetSiteType::Record)
-        {
-            QString locationLink = QString("Record - <a href='%1'>%1</a>").arg(message.targetSiteId.toString());
-            locationLabel = new QLabel(locationLink);
-
-            connect(
-                        locationLabel,
-                        SIGNAL(linkActivated(const QString&)),
-                        SLOT(onRecordLinkActivated(const QString&))
-                        );
-        }
-        else
-        {
-            QString locationString = TargetSiteType::toString(message.targetSiteType) + " - " + message.targetSiteId.toString();
-            locationLabel = new QLabel(locationString);
-        }
-
-        index = this->tableWidgetErrorList->model()->index(messagesShown, 3);
-        this->tableWidgetErrorList->setIndexWidget(index, locationLabel);
-
-        // Increase row counter.
-        ++messagesShown;
+        this->comboBoxMessageCode->addItem(
+                    tr("%1 (%2)").arg(messageCode).arg(this->errorListModel->getMessageCodeCount(messageCode)),
+                    messageCode);
     }
 
-    // Finish layout.
-    this->tableWidgetErrorList->setRowCount(messagesShown);
-    this->tableWidgetErrorList->resizeColumnsToContents();
+    // Keep filter, if possible.
+    const int selectedIndex = this->comboBoxMessageCode->findData(selectedMessageCode);
+    this->comboBoxMessageCode->setCurrentIndex(selectedIndex >= 0 ? selectedIndex : 0);
+    this->comboBoxMessageCode->blockSignals(false);
+
+    this->errorListProxyModel->setMessageCodeFilter(this->comboBoxMessageCode->currentData().toString());
+}
 
-    // Show item count.
-    this->toolButtonErrors->setText(tr("%1 Errors").arg(errors));
-    this->toolButtonMessages->setText(tr("%1 Messages").arg(messages));
-    this->toolButtonWarnings->setText(tr("%1 Warnings").arg(warnings));
+void ErrorListDockWidget::refreshSeverityCounts()
+{
+    this->toolButtonErrors->setText(tr("%1 Errors").arg(this->errorListModel->getSeverityCount(Severity::Error)));
+    this->toolButtonMessages->setText(tr("%1 Messages").arg(this->errorListModel->getSeverityCount(Severity::Information)));
+    this->toolButtonWarnings->setText(tr("%1 Warnings").arg(this->errorListModel->getSeverityCount(Severity::Warning)));
+}
 
-    // Hide progress bar.
-    emit this->progressChanged(tr("Refreshing Error List"), QString(), 1, 1);
+void ErrorListDockWidget::onComboBoxMessageCodeCurrentIndexChanged(int index)
+{
+    this->errorListProxyModel->setMessageCodeFilter(this->comboBoxMessageCode->itemData(index).toString());
 }
 
-void ErrorListDockWidget::onRecordLinkActivated(const QString& recordId)
+void ErrorListDockWidget::onTableViewErrorListClicked(const QModelIndex& index)
 {
-    emit this->recordLinkActivated(recordId);
+    const QModelIndex sourceIndex = this->errorListProxyModel->mapToSource(index);
+
+    if (!sourceIndex.isValid())
+    {
+        return;
+    }
+
+    const Message& message = this->errorListModel->getMessage(sourceIndex.row());
+
+    if (sourceIndex.column() == ErrorListModel::ColumnCode)
+    {
+        // Show help.
+        QDesktopServices::openUrl(QUrl(this->errorListModel->getHelpLink(sourceIndex.row())));
+    }
+    else if (sourceIndex.column() == ErrorListModel::ColumnLocation && message.targetSiteType == TargetSiteType::Record)
+    {
+        emit this->recordLinkActivated(message.targetSiteId.toString());
+    }
 }
 
 void ErrorListDockWidget::onToolButtonErrorsToggled(bool checked)
 {
-    Q_UNUSED(checked)
-    this->refreshMessages();
+    this->errorListProxyModel->setSeverityVisible(Severity::Error, checked);
 }
 
 void ErrorListDockWidget::onToolButtonWarningsToggled(bool checked)
 {
-    Q_UNUSED(checked)
-    this->refreshMessages();
+    this->errorListProxyModel->setSeverityVisible(Severity::Warning, checked);
 }
 
 void ErrorListDockWidget::onToolButtonMessagesToggled(bool checked)
 {
-    Q_UNUSED(checked)
-    this->refreshMessages();
+    this->errorListProxyModel->setSeverityVisible(Severity::Information, checked);
 }
@@ -1,9 +1,10 @@
 #ifndef ERRORLISTDOCKWIDGET_H
 #define ERRORLISTDOCKWIDGET_H
 
+#include <QComboBox>
 #include <QDockWidget>
 #include <QHBoxLayout>
-#include <QTableWidget>
+#include <QTableView>
 #include <QToolButton>
 #include <QVBoxLayout>
 
@@ -11,6 +12,9 @@
 
 namespace Tome
 {
+    class ErrorListFilterProxyModel;
+    class ErrorListModel;
+
     /**
      * @brief Shows messages, warnings and errors generated by automated tasks.
      */
@@ -33,15 +37,6 @@ namespace Tome
             void showMessages(const MessageList& messages);
 
         signals:
-            /**
-             * @brief Progress of the refreshing the message list has changed.
-             * @param title Title of the current refresh operation.
-             * @param text Details of the current refresh operation.
-             * @param currentValue Current progress value of the current refresh operation.
-             * @param maximumValue Maximum progress value of the current refresh operation.
-             */
-            void progressChanged(const QString title, const QString text, const int currentValue, const int maximumValue) const;
-
             /**
              * @brief A link to another Tome record has been activated.
              * @param recordId Id of the selected record.
@@ -53,7 +48,10 @@ namespace Tome
 
             QVBoxLayout* verticalLayout;
 
-            QTableWidget* tableWidgetErrorList;
+            QTableView* tableViewErrorList;
+
+            ErrorListModel* errorListModel;
+            ErrorListFilterProxyModel* errorListProxyModel;
 
             QHBoxLayout* toolButtonsLayout;
 
@@ -61,12 +59,14 @@ namespace Tome
             QToolButton* toolButtonMessages;
             QToolButton* toolButtonWarnings;
 
-            MessageList messages;
+            QComboBox* comboBoxMessageCode;
 
-            void refreshMessages();
+            void refreshMessageCodes();
+            void refreshSeverityCounts();
 
         private slots:
-            void onRecordLinkActivated(const QString& recordId);
+            void onComboBoxMessageCodeCurrentIndexChanged(int index);
+            void onTableViewErrorListClicked(const QModelIndex& index);
             void onToolButtonErrorsToggled(bool checked);
             void onToolButtonWarningsToggled(bool checked);
             void onToolButtonMessagesToggled(bool checked);
@@ -0,0 +1,74 @@
+#include "errorlistfilterproxymodel.h"
+
+#include "errorlistmodel.h"
+
+using namespace Tome;
+
+
+ErrorListFilterProxyModel::ErrorListFilterProxyModel(ErrorListModel& errorListModel, QObject* parent)
+    : QSortFilterProxyModel(parent),
+      errorListModel(errorListModel),
+      errorsVisible(true),
+      warningsVisible(true),
+      informationVisible(true)
+{
+    this->setSourceModel(&this->errorListModel);
+}
+
+void ErrorListFilterProxyModel::setMessageCodeFilter(const QString& messageCode)
+{
+    if (this->messageCodeFilter == messageCode)
+    {
+        return;
+    }
+
+    this->messageCodeFilter = messageCode;
+    this->invalidateFilter();
+}
+
+void ErrorListFilterProxyModel::setSeverityVisible(Severity::Severity severity, bool visible)
+{
+    switch (severity)
+    {
+        case Severity::Error:
+            this->errorsVisible = visible;
+            break;
+
+        case Severity::Warning:
+            this->warningsVisible = visible;
+            break;
+
+        case Severity::Information:
+            this->informationVisible = visible;
+            break;
+    }
+
+    this->invalidateFilter();
+}
+
+bool ErrorListFilterProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const
+{
+    Q_UNUSED(sourceParent)
+
+    // Check the messages directly instead of going through their display strings.
+    const Message& message = this->errorListModel.getMessage(sourceRow);
+
+    if (!this->messageCodeFilter.isEmpty() && message.messageCode != this->messageCodeFilter)
+    {
+        return false;
+    }
+
+    switch (message.severity)
+    {
+        case Severity::Error:
+            return this->errorsVisible;
+
+        case Severity::Warning:
+            return this->warningsVisible;
+
+        case Severity::Information:
+            return this->informationVisible;
+    }
+
+    return true;
+}
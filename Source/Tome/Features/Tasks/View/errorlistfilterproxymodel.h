@@ -0,0 +1,53 @@
+#ifndef ERRORLISTFILTERPROXYMODEL_H
+#define ERRORLISTFILTERPROXYMODEL_H
+
+#include <QSortFilterProxyModel>
+
+#include "../Model/severity.h"
+
+namespace Tome
+{
+    class ErrorListModel;
+
+    /**
+     * @brief Sorts messages, warnings and errors, and filters them by severity and code.
+     */
+    class ErrorListFilterProxyModel : public QSortFilterProxyModel
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new proxy model for sorting and filtering messages, warnings and errors.
+             * @param errorListModel Model of the messages to sort and filter.
+             * @param parent Optional owner object.
+             */
+            ErrorListFilterProxyModel(ErrorListModel& errorListModel, QObject* parent = 0);
+
+            /**
+             * @brief Shows only messages with the specified code.
+             * @param messageCode Code of the messages to show, or an empty string for showing messages with any code.
+             */
+            void setMessageCodeFilter(const QString& messageCode);
+
+            /**
+             * @brief Sets whether to show messages with the specified severity, or not.
+             * @param severity Severity to show or hide.
+             * @param visible Whether to show messages with the specified severity, or not.
+             */
+            void setSeverityVisible(Severity::Severity severity, bool visible);
+
+        protected:
+            bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const Q_DECL_OVERRIDE;
+
+        private:
+            ErrorListModel& errorListModel;
+
+            QString messageCodeFilter;
+            bool errorsVisible;
+            bool warningsVisible;
+            bool informationVisible;
+    };
+}
+
+#endif // ERRORLISTFILTERPROXYMODEL_H
@@ -0,0 +1,216 @@
+#include "errorlistmodel.h"
+
+#include <QBrush>
+#include <QFont>
+
+using namespace Tome;
+
+
+const int ErrorListModel::ColumnSeverity = 0;
+const int ErrorListModel::ColumnCode = 1;
+const int ErrorListModel::ColumnMessage = 2;
+const int ErrorListModel::ColumnLocation = 3;
+
+
+ErrorListModel::ErrorListModel(QObject* parent)
+    : QAbstractTableModel(parent),
+      errorCount(0),
+      warningCount(0),
+      informationCount(0),
+      errorIcon(":/Error"),
+      informationIcon(":/Information"),
+      warningIcon(":/Warning")
+{
+}
+
+int ErrorListModel::columnCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return 4;
+}
+
+QVariant ErrorListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= this->messages.count())
+    {
+        return QVariant();
+    }
+
+    const Message& message = this->messages[index.row()];
+    const bool isRecordLocation = message.targetSiteType == TargetSiteType::Record;
+
+    switch (role)
+    {
+        case Qt::DisplayRole:
+            switch (index.column())
+            {
+                case ColumnSeverity:
+                    return Severity::toString(message.severity);
+
+                case ColumnCode:
+                    return message.messageCode;
+
+                case ColumnMessage:
+                    return message.content;
+
+                case ColumnLocation:
+                    return TargetSiteType::toString(message.targetSiteType) + " - " + message.targetSiteId.toString();
+            }
+            break;
+
+        case Qt::DecorationRole:
+            if (index.column() == ColumnSeverity)
+            {
+                switch (message.severity)
+                {
+                    case Severity::Error:
+                        return this->errorIcon;
+
+                    case Severity::Warning:
+                        return this->warningIcon;
+
+                    case Severity::Information:
+                        return this->informationIcon;
+                }
+            }
+            break;
+
+        case Qt::ToolTipRole:
+            if (index.column() == ColumnCode)
+            {
+                return this->getHelpLink(index.row());
+            }
+            break;
+
+        case Qt::FontRole:
+            // Show help and record links as hyperlinks.
+            if (index.column() == ColumnCode || (index.column() == ColumnLocation && isRecordLocation))
+            {
+                QFont font;
+                font.setUnderline(true);
+                return font;
+            }
+            break;
+
+        case Qt::ForegroundRole:
+            if (index.column() == ColumnCode || (index.column() == ColumnLocation && isRecordLocation))
+            {
+                return QBrush(Qt::blue);
+            }
+            break;
+    }
+
+    return QVariant();
+}
+
+QVariant ErrorListModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+    {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section)
+    {
+        case ColumnSeverity:
+            return tr("Severity");
+
+        case ColumnCode:
+            return tr("Code");
+
+        case ColumnMessage:
+            return tr("Message");
+
+        case ColumnLocation:
+            return tr("Location");
+    }
+
+    return QVariant();
+}
+
+int ErrorListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return this->messages.count();
+}
+
+QString ErrorListModel::getHelpLink(int row) const
+{
+    const Message& message = this->messages[row];
+    return message.helpLink.isEmpty() ? "https://github.com/npruehs/tome-editor/wiki/" + message.messageCode : message.helpLink;
+}
+
+const Message& ErrorListModel::getMessage(int row) const
+{
+    return this->messages[row];
+}
+
+int ErrorListModel::getMessageCodeCount(const QString& messageCode) const
+{
+    return this->messageCodeCounts.value(messageCode);
+}
+
+QStringList ErrorListModel::getMessageCodes() const
+{
+    return this->messageCodeCounts.keys();
+}
+
+int ErrorListModel::getSeverityCount(Severity::Severity severity) const
+{
+    switch (severity)
+    {
+        case Severity::Error:
+            return this->errorCount;
+
+        case Severity::Warning:
+            return this->warningCount;
+
+        case Severity::Information:
+            return this->informationCount;
+    }
+
+    return 0;
+}
+
+void ErrorListModel::setMessages(const MessageList& messages)
+{
+    this->beginResetModel();
+
+    this->messages = messages;
+
+    // Count messages by severity and code.
+    this->messageCodeCounts.clear();
+    this->errorCount = 0;
+    this->warningCount = 0;
+    this->informationCount = 0;
+
+    for (const Message& message : this->messages)
+    {
+        ++this->messageCodeCounts[message.messageCode];
+
+        switch (message.severity)
+        {
+            case Severity::Error:
+                ++this->errorCount;
+                break;
+
+            case Severity::Warning:
+                ++this->warningCount;
+                break;
+
+            case Severity::Information:
+                ++this->informationCount;
+                break;
+        }
+    }
+
+    this->endResetModel();
+}
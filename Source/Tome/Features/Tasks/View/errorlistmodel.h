@@ -0,0 +1,107 @@
+#ifndef ERRORLISTMODEL_H
+#define ERRORLISTMODEL_H
+
+#include <QAbstractTableModel>
+#include <QIcon>
+#include <QMap>
+
+#include "../Model/messagelist.h"
+
+namespace Tome
+{
+    /**
+     * @brief Model of messages, warnings and errors generated by automated tasks.
+     *
+     * Cells are resolved on demand when views ask for them, so the cost of showing messages doesn't depend on their number.
+     */
+    class ErrorListModel : public QAbstractTableModel
+    {
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief Constructs a new model of messages, warnings and errors generated by automated tasks.
+             * @param parent Optional owner object.
+             */
+            explicit ErrorListModel(QObject* parent = 0);
+
+            int columnCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+            QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+            QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+            int rowCount(const QModelIndex& parent = QModelIndex()) const Q_DECL_OVERRIDE;
+
+            /**
+             * @brief Column showing the severity of each message.
+             */
+            static const int ColumnSeverity;
+
+            /**
+             * @brief Column showing the code of each message, linking to additional help.
+             */
+            static const int ColumnCode;
+
+            /**
+             * @brief Column showing the text of each message.
+             */
+            static const int ColumnMessage;
+
+            /**
+             * @brief Column showing where each message has been generated.
+             */
+            static const int ColumnLocation;
+
+            /**
+             * @brief Gets the URL to get additional help on the message in the specified row at.
+             * @param row Row of the message to get the help link of.
+             * @return URL to get additional help on the message in the specified row at.
+             */
+            QString getHelpLink(int row) const;
+
+            /**
+             * @brief Gets the message in the specified row.
+             * @param row Row of the message to get.
+             * @return Message in the specified row.
+             */
+            const Message& getMessage(int row) const;
+
+            /**
+             * @brief Gets the number of messages with the specified code.
+             * @param messageCode Code of the messages to count.
+             * @return Number of messages with the specified code.
+             */
+            int getMessageCodeCount(const QString& messageCode) const;
+
+            /**
+             * @brief Gets the sorted list of all codes of the shown messages.
+             * @return Sorted list of all codes of the shown messages.
+             */
+            QStringList getMessageCodes() const;
+
+            /**
+             * @brief Gets the number of messages with the specified severity.
+             * @param severity Severity of the messages to count.
+             * @return Number of messages with the specified severity.
+             */
+            int getSeverityCount(Severity::Severity severity) const;
+
+            /**
+             * @brief Shows the passed messages, warnings and errors.
+             * @param messages Messages to show.
+             */
+            void setMessages(const MessageList& messages);
+
+        private:
+            MessageList messages;
+
+            QMap<QString, int> messageCodeCounts;
+            int errorCount;
+            int warningCount;
+            int informationCount;
+
+            QIcon errorIcon;
+            QIcon informationIcon;
+            QIcon warningIcon;
+    };
+}
+
+#endif // ERRORLISTMODEL_H
@@ -3,6 +3,7 @@
 #include <QXmlStreamWriter>
 
 #include "../Model/customtypeset.h"
+#include "../../Diagnostics/Controller/tracer.h"
 #include "../../../IO/xmlreader.h"
 
 using namespace Tome;
@@ -27,6 +28,8 @@ const int CustomTypeSetSerializer::Version = 2;
 
 void CustomTypeSetSerializer::serialize(QIODevice& device, const CustomTypeSet& customTypeSet) const
 {
+    TOME_TRACE("Serialization", "serializeCustomTypeSet");
+
     // Open device stream.
     QXmlStreamWriter writer(&device);
     writer.setAutoFormatting(true);
@@ -88,6 +91,8 @@ void CustomTypeSetSerializer::serialize(QIODevice& device, const CustomTypeSet&
 
 void CustomTypeSetSerializer::deserialize(QIODevice& device, CustomTypeSet& customTypeSet) const
 {
+    TOME_TRACE("Serialization", "deserializeCustomTypeSet");
+
     // Open device stream.
     XmlReader reader(&device);
 
@@ -2,6 +2,9 @@
 
 #include <stdexcept>
 
+#include <QMap>
+#include <QStringList>
+
 #include "../Model/builtintype.h"
 #include "../Model/vector.h"
 #include "../../../Util/listutils.h"
@@ -222,6 +225,91 @@ void TypesController::setCustomTypes(CustomTypeSetList& model)
     this->model = &model;
 }
 
+bool TypesController::updateCustomTypeSet(const CustomTypeSet& customTypeSet)
+{
+    CustomTypeSet* currentCustomTypeSet = nullptr;
+
+    for (CustomTypeSet& existingCustomTypeSet : *this->model)
+    {
+        if (existingCustomTypeSet.name == customTypeSet.name)
+        {
+            currentCustomTypeSet = &existingCustomTypeSet;
+            break;
+        }
+    }
+
+    if (currentCustomTypeSet == nullptr)
+    {
+        return false;
+    }
+
+    QMap<QString, CustomType> oldTypes;
+
+    for (const CustomType& type : currentCustomTypeSet->types)
+    {
+        oldTypes.insert(type.name, type);
+    }
+
+    // Types moved in from other sets would have to be removed there first.
+    for (const CustomType& type : customTypeSet.types)
+    {
+        if (!oldTypes.contains(type.name) && this->isCustomType(type.name))
+        {
+            return false;
+        }
+    }
+
+    qInfo(qUtf8Printable(QString("Updating type set %1 with %2 types.")
+          .arg(customTypeSet.name, QString::number(customTypeSet.types.count()))));
+
+    // Update model.
+    currentCustomTypeSet->types = customTypeSet.types;
+
+    for (CustomType& type : currentCustomTypeSet->types)
+    {
+        type.typeSetName = currentCustomTypeSet->name;
+    }
+
+    std::sort(currentCustomTypeSet->types.begin(), currentCustomTypeSet->types.end(), customTypeLessThanName);
+
+    // Notify listeners.
+    QStringList newTypeNames;
+
+    for (const CustomType& type : customTypeSet.types)
+    {
+        newTypeNames << type.name;
+    }
+
+    for (const CustomType& oldType : oldTypes)
+    {
+        if (!newTypeNames.contains(oldType.name))
+        {
+            emit this->typeRemoved(oldType);
+        }
+    }
+
+    for (CustomType newType : customTypeSet.types)
+    {
+        newType.typeSetName = customTypeSet.name;
+
+        if (!oldTypes.contains(newType.name))
+        {
+            emit this->typeAdded(newType);
+            continue;
+        }
+
+        const CustomType& oldType = oldTypes[newType.name];
+
+        if (oldType.fundamentalFacets != newType.fundamentalFacets ||
+                oldType.constrainingFacets != newType.constrainingFacets)
+        {
+            emit this->typeUpdated(newType);
+        }
+    }
+
+    return true;
+}
+
 void TypesController::updateDerivedType(const QString& oldName, const QString& newName, const QString& baseType, const QVariantMap facets, const QString& typeSetName)
 {
     CustomType& type = *this->getCustomTypeByName(oldName);
@@ -164,6 +164,13 @@ namespace Tome
              */
             void setCustomTypes(CustomTypeSetList& model);
 
+            /**
+             * @brief Replaces the custom types of the set with the same name by the custom types of the specified set, e.g. after the type set file has been changed outside of Tome.
+             * @param customTypeSet Custom type set to take the custom types from.
+             * @return true, if the custom types could be updated, and false, if the custom type set could not be found, or custom types have been moved between sets.
+             */
+            bool updateCustomTypeSet(const CustomTypeSet& customTypeSet);
+
             /**
              * @brief Updates the properties of the specified derived type.
              *
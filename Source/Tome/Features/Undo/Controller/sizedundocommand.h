@@ -0,0 +1,26 @@
+#ifndef SIZEDUNDOCOMMAND_H
+#define SIZEDUNDOCOMMAND_H
+
+#include <QtGlobal>
+
+namespace Tome
+{
+    /**
+     * @brief Undo-able command that can tell how much memory it occupies, for limiting the size of the undo history.
+     *
+     * Should be implemented by all commands that store data proportional to the size of the project.
+     */
+    class SizedUndoCommand
+    {
+        public:
+            virtual ~SizedUndoCommand() {}
+
+            /**
+             * @brief Approximates the number of bytes this command occupies in memory, including all data stored for undoing or redoing it.
+             * @return Approximate number of bytes this command occupies in memory.
+             */
+            virtual qint64 getApproximateSize() const = 0;
+    };
+}
+
+#endif // SIZEDUNDOCOMMAND_H
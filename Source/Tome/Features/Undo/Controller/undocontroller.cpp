@@ -1,48 +1,281 @@
 #include "undocontroller.h"
 
+#include "sizedundocommand.h"
+#include "../../../Util/memoryutils.h"
+
 using namespace Tome;
 
 
+const qint64 UndoController::DefaultMemoryLimit = 64 * 1024 * 1024;
+const qint64 UndoController::UnsizedCommandSize = 256;
+
+
 UndoController::UndoController()
-    : undoStack(new QUndoStack())
+    : index(0),
+      cleanIndex(0),
+      memoryLimit(DefaultMemoryLimit),
+      memoryUsage(0)
+{
+}
+
+UndoController::~UndoController()
 {
-    connect(this->undoStack,
-            SIGNAL(cleanChanged(bool)),
-            SLOT(onCleanChanged(bool)));
+    qDeleteAll(this->commands);
 }
 
 void UndoController::clear()
 {
-    this->undoStack->clear();
+    const bool wasClean = this->isClean();
+
+    qDeleteAll(this->commands);
+    this->commands.clear();
+    this->commandSizes.clear();
+
+    this->index = 0;
+    this->cleanIndex = 0;
+    this->memoryUsage = 0;
+
+    this->updateState(wasClean);
 }
 
 QAction* UndoController::createRedoAction(QObject* parent, const QString& prefix)
 {
-    return this->undoStack->createRedoAction(parent, prefix);
+    QAction* action = new QAction(parent);
+    action->setData(prefix);
+
+    connect(action,
+            SIGNAL(triggered()),
+            SLOT(redo()));
+
+    this->redoActions << action;
+    this->updateActions();
+
+    return action;
 }
 
 QAction* UndoController::createUndoAction(QObject* parent, const QString& prefix)
 {
-    return this->undoStack->createUndoAction(parent, prefix);
+    QAction* action = new QAction(parent);
+    action->setData(prefix);
+
+    connect(action,
+            SIGNAL(triggered()),
+            SLOT(undo()));
+
+    this->undoActions << action;
+    this->updateActions();
+
+    return action;
 }
 
 void UndoController::doCommand(QUndoCommand* command)
 {
-    this->undoStack->push(command);
+    const bool wasClean = this->isClean();
+
+    // Discard undone commands, as they can't be redone anymore.
+    while (this->commands.count() > this->index)
+    {
+        this->removeCommand(this->commands.count() - 1);
+    }
+
+    if (this->cleanIndex > this->index)
+    {
+        this->cleanIndex = -1;
+    }
+
+    // Apply command.
+    command->redo();
+
+    // Merge with previous command, if possible, unless that would make the clean state unreachable.
+    if (this->index > 0 && this->index != this->cleanIndex && command->id() != -1)
+    {
+        QUndoCommand* previousCommand = this->commands[this->index - 1];
+
+        if (previousCommand->id() == command->id() && previousCommand->mergeWith(command))
+        {
+            delete command;
+
+            this->updateCommandSize(this->index - 1);
+            this->enforceMemoryLimit();
+            this->updateState(wasClean);
+            return;
+        }
+    }
+
+    this->commands << command;
+    this->commandSizes << 0;
+    this->updateCommandSize(this->index);
+    ++this->index;
+
+    this->enforceMemoryLimit();
+    this->updateState(wasClean);
+}
+
+qint64 UndoController::getMemoryLimit() const
+{
+    return this->memoryLimit;
+}
+
+qint64 UndoController::getMemoryUsage() const
+{
+    return this->memoryUsage;
 }
 
 bool UndoController::isClean() const
 {
-    return this->undoStack->isClean();
+    return this->index == this->cleanIndex;
+}
+
+void UndoController::resetClean()
+{
+    const bool wasClean = this->isClean();
+    this->cleanIndex = -1;
+    this->updateState(wasClean);
 }
 
 void UndoController::setClean()
 {
-    this->undoStack->setClean();
+    const bool wasClean = this->isClean();
+    this->cleanIndex = this->index;
+    this->updateState(wasClean);
+}
+
+void UndoController::setMemoryLimit(qint64 memoryLimit)
+{
+    const bool wasClean = this->isClean();
+
+    this->memoryLimit = memoryLimit;
+
+    this->enforceMemoryLimit();
+    this->updateState(wasClean);
+}
+
+void UndoController::redo()
+{
+    if (this->index >= this->commands.count())
+    {
+        return;
+    }
+
+    const bool wasClean = this->isClean();
+
+    this->commands[this->index]->redo();
+    this->updateCommandSize(this->index);
+    ++this->index;
+
+    this->enforceMemoryLimit();
+    this->updateState(wasClean);
 }
 
-void UndoController::onCleanChanged(bool clean)
+void UndoController::undo()
 {
+    if (this->index <= 0)
+    {
+        return;
+    }
+
+    const bool wasClean = this->isClean();
+
+    --this->index;
+    this->commands[this->index]->undo();
+    this->updateCommandSize(this->index);
+
+    this->updateState(wasClean);
+}
+
+void UndoController::enforceMemoryLimit()
+{
+    // Always keep the most recent command, even if it exceeds the limit on its own.
+    while (this->memoryUsage > this->memoryLimit && this->commands.count() > 1)
+    {
+        if (this->index > 0)
+        {
+            // Discard oldest command.
+            qInfo(qUtf8Printable(QString("Discarding undo command %1 to stay within the undo memory limit.")
+                  .arg(this->commands.first()->text())));
+
+            this->removeCommand(0);
+            --this->index;
+            this->cleanIndex = this->cleanIndex > 0 ? this->cleanIndex - 1 : -1;
+        }
+        else
+        {
+            // Nothing left to undo, discard most recently undone command.
+            this->removeCommand(this->commands.count() - 1);
+
+            if (this->cleanIndex > this->commands.count())
+            {
+                this->cleanIndex = -1;
+            }
+        }
+    }
+}
+
+qint64 UndoController::getApproximateSize(const QUndoCommand* command)
+{
+    const SizedUndoCommand* sizedCommand = dynamic_cast<const SizedUndoCommand*>(command);
+    qint64 size = sizedCommand != nullptr ? sizedCommand->getApproximateSize() : UnsizedCommandSize;
+
+    size += approximateSize(command->text());
+
+    // Add size of child commands, e.g. of macros.
+    for (int i = 0; i < command->childCount(); ++i)
+    {
+        size += getApproximateSize(command->child(i));
+    }
+
+    return size;
+}
+
+void UndoController::removeCommand(int commandIndex)
+{
+    delete this->commands.takeAt(commandIndex);
+    this->memoryUsage -= this->commandSizes.takeAt(commandIndex);
+}
+
+void UndoController::updateActions()
+{
+    const bool canUndo = this->index > 0;
+    const bool canRedo = this->index < this->commands.count();
+
+    const QString undoText = canUndo ? this->commands[this->index - 1]->actionText() : QString();
+    const QString redoText = canRedo ? this->commands[this->index]->actionText() : QString();
+
+    for (QPointer<QAction>& action : this->undoActions)
+    {
+        if (!action.isNull())
+        {
+            action->setEnabled(canUndo);
+            action->setText(QString("%1 %2").arg(action->data().toString(), undoText).trimmed());
+        }
+    }
+
+    for (QPointer<QAction>& action : this->redoActions)
+    {
+        if (!action.isNull())
+        {
+            action->setEnabled(canRedo);
+            action->setText(QString("%1 %2").arg(action->data().toString(), redoText).trimmed());
+        }
+    }
+}
+
+void UndoController::updateCommandSize(int commandIndex)
+{
+    this->memoryUsage -= this->commandSizes[commandIndex];
+    this->commandSizes[commandIndex] = getApproximateSize(this->commands[commandIndex]);
+    this->memoryUsage += this->commandSizes[commandIndex];
+}
+
+void UndoController::updateState(bool wasClean)
+{
+    this->updateActions();
+
     // Notify listeners.
-    emit this->undoStackChanged(clean);
+    const bool clean = this->isClean();
+
+    if (clean != wasClean)
+    {
+        emit this->undoStackChanged(clean);
+    }
 }
@@ -1,24 +1,35 @@
 #ifndef UNDOCONTROLLER_H
 #define UNDOCONTROLLER_H
 
+#include <QAction>
+#include <QList>
+#include <QPointer>
 #include <QUndoCommand>
-#include <QUndoStack>
 
 
 namespace Tome
 {
     /**
      * @brief Controller for performing undo-able commands.
+     *
+     * Keeps the history of applied commands within a memory limit, discarding the oldest commands first.
+     * Commands with the same id are merged, if they allow it.
      */
     class UndoController : public QObject
     {
             Q_OBJECT
 
         public:
+            /**
+             * @brief Default maximum number of bytes the undo history may occupy.
+             */
+            static const qint64 DefaultMemoryLimit;
+
             /**
              * @brief Constructs a new controller for performing undo-able commands.
              */
             UndoController();
+            ~UndoController();
 
             /**
              * @brief Removes all recent undo-able commands from the undo stack.
@@ -42,22 +53,48 @@ namespace Tome
             QAction* createUndoAction(QObject* parent, const QString& prefix);
 
             /**
-             * @brief Applies the passed command, pushing it to the undo stack.
+             * @brief Applies the passed command, pushing it to the undo stack or merging it with the most recent command.
              * @param command Command to apply.
              */
             void doCommand(QUndoCommand* command);
 
+            /**
+             * @brief Gets the maximum number of bytes the undo history may occupy.
+             * @return Maximum number of bytes the undo history may occupy.
+             */
+            qint64 getMemoryLimit() const;
+
+            /**
+             * @brief Gets the approximate number of bytes the undo history currently occupies.
+             * @return Approximate number of bytes the undo history currently occupies.
+             */
+            qint64 getMemoryUsage() const;
+
             /**
              * @brief Whether any commands have been applied since the project was opened or saved.
              * @return Whether any commands have been applied since the project was opened or saved, or not.
              */
             bool isClean() const;
 
+            /**
+             * @brief Marks the undo stack as unclean, as if commands have been applied since the project was opened or saved, even if there are none left to undo.
+             */
+            void resetClean();
+
             /**
              * @brief Marks the undo stack as clean, as if no commands have been applied since the project was opened or saved.
              */
             void setClean();
 
+            /**
+             * @brief Sets the maximum number of bytes the undo history may occupy, discarding the oldest commands if necessary.
+             *
+             * The most recent command is always kept, even if it exceeds the limit on its own.
+             *
+             * @param memoryLimit Maximum number of bytes the undo history may occupy.
+             */
+            void setMemoryLimit(qint64 memoryLimit);
+
         signals:
             /**
              * @brief Undo stack has become dirty or clean.
@@ -65,11 +102,40 @@ namespace Tome
              */
             void undoStackChanged(bool clean);
 
-        private slots:
-            void onCleanChanged(bool clean);
+        public slots:
+            /**
+             * @brief Re-does the most recently undone command, if any.
+             */
+            void redo();
+
+            /**
+             * @brief Un-does the most recent command, if any.
+             */
+            void undo();
 
         private:
-            QUndoStack* undoStack;
+            static const qint64 UnsizedCommandSize;
+
+            QList<QUndoCommand*> commands;
+            QList<qint64> commandSizes;
+
+            // Number of commands currently applied, and number of commands applied when the project was opened or saved,
+            // or -1 if that state can't be reached anymore.
+            int index;
+            int cleanIndex;
+
+            qint64 memoryLimit;
+            qint64 memoryUsage;
+
+            QList<QPointer<QAction>> redoActions;
+            QList<QPointer<QAction>> undoActions;
+
+            void enforceMemoryLimit();
+            static qint64 getApproximateSize(const QUndoCommand* command);
+            void removeCommand(int commandIndex);
+            void updateActions();
+            void updateCommandSize(int commandIndex);
+            void updateState(bool wasClean);
     };
 }
 
@@ -0,0 +1,61 @@
+#include "testfilewatchercontroller.h"
+
+#include "testprojectfixture.h"
+#include "../Features/Projects/Controller/filewatchercontroller.h"
+#include "../Features/Projects/Controller/projectcontroller.h"
+
+using namespace Tome;
+
+
+// Longer than the delay of the file watcher for collecting changes.
+static const int ReportTimeoutInMilliseconds = 2000;
+
+
+void TestFileWatcherController::init()
+{
+    this->fixture = new TestProjectFixture();
+    this->fileWatcherController = new FileWatcherController(this->fixture->getFieldDefinitionsController(),
+                                                            this->fixture->getProjectController(),
+                                                            this->fixture->getRecordsController(),
+                                                            this->fixture->getTypesController());
+    this->fileWatcherController->watchProjectFiles();
+}
+
+void TestFileWatcherController::cleanup()
+{
+    delete this->fileWatcherController;
+    delete this->fixture;
+}
+
+void TestFileWatcherController::saveProjectDoesNotReportChanges()
+{
+    // ARRANGE.
+    QSignalSpy spy(this->fileWatcherController, SIGNAL(projectFilesChanged(const QStringList&)));
+
+    // ACT.
+    this->fixture->getProjectController().saveProject();
+
+    // ASSERT.
+    QVERIFY(!spy.wait(ReportTimeoutInMilliseconds));
+    QVERIFY(this->fileWatcherController->getChangedFilePaths().isEmpty());
+}
+
+void TestFileWatcherController::changeAfterSaveIsReported()
+{
+    // ARRANGE.
+    this->fixture->getProjectController().saveProject();
+    QTest::qWait(ReportTimeoutInMilliseconds);
+
+    QSignalSpy spy(this->fileWatcherController, SIGNAL(projectFilesChanged(const QStringList&)));
+    const QString projectFilePath = this->fixture->getProjectController().getFullProjectPath();
+
+    // ACT.
+    QFile projectFile(projectFilePath);
+    QVERIFY(projectFile.open(QIODevice::Append));
+    projectFile.write("\n");
+    projectFile.close();
+
+    // ASSERT.
+    QVERIFY(spy.wait(ReportTimeoutInMilliseconds));
+    QCOMPARE(this->fileWatcherController->getChangedFilePaths(), QStringList() << projectFilePath);
+}
@@ -0,0 +1,33 @@
+#ifndef TESTFILEWATCHERCONTROLLER_H
+#define TESTFILEWATCHERCONTROLLER_H
+
+#include <QtTest/QtTest>
+
+namespace Tome
+{
+    class FileWatcherController;
+}
+
+class TestProjectFixture;
+
+
+/**
+ * @brief Unit tests for watching project files for changes made outside of Tome.
+ */
+class TestFileWatcherController : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void init();
+        void cleanup();
+
+        void saveProjectDoesNotReportChanges();
+        void changeAfterSaveIsReported();
+
+    private:
+        TestProjectFixture* fixture;
+        Tome::FileWatcherController* fileWatcherController;
+};
+
+#endif // TESTFILEWATCHERCONTROLLER_H
@@ -0,0 +1,101 @@
+#include "testfulltextindex.h"
+
+#include "../Util/fulltextindex.h"
+
+using namespace Tome;
+
+
+void TestFullTextIndex::findIgnoresCase()
+{
+    // ARRANGE.
+    FullTextIndex index;
+    index.insert("Dagger", "Deals Poison damage.");
+
+    // ACT.
+    QStringList keys = index.find("POISON");
+
+    // ASSERT.
+    QCOMPARE(keys, QStringList() << "Dagger");
+}
+
+void TestFullTextIndex::findWordPrefix()
+{
+    // ARRANGE.
+    FullTextIndex index;
+    index.insert("Potion", "Cures poisoning.");
+
+    // ACT.
+    QStringList keys = index.find("poison");
+
+    // ASSERT.
+    QCOMPARE(keys, QStringList() << "Potion");
+}
+
+void TestFullTextIndex::findAllWords()
+{
+    // ARRANGE.
+    FullTextIndex index;
+    index.insert("Dagger", "Deals poison damage.");
+    index.insert("Sword", "Deals damage.");
+
+    // ACT.
+    QStringList keys = index.find("damage, poison");
+
+    // ASSERT.
+    QCOMPARE(keys, QStringList() << "Dagger");
+}
+
+void TestFullTextIndex::findIgnoresWordInfix()
+{
+    // ARRANGE.
+    FullTextIndex index;
+    index.insert("Dagger", "Deals poison damage.");
+
+    // ACT.
+    QStringList keys = index.find("oison");
+
+    // ASSERT.
+    QVERIFY(keys.isEmpty());
+}
+
+void TestFullTextIndex::findWithoutWords()
+{
+    // ARRANGE.
+    FullTextIndex index;
+    index.insert("Dagger", "Deals poison damage.");
+
+    // ACT.
+    QStringList keys = index.find(" .,");
+
+    // ASSERT.
+    QVERIFY(keys.isEmpty());
+}
+
+void TestFullTextIndex::insertReplacesText()
+{
+    // ARRANGE.
+    FullTextIndex index;
+    index.insert("Potion", "Cures poison.");
+
+    // ACT.
+    index.insert("Potion", "Heals.");
+
+    // ASSERT.
+    QVERIFY(index.find("poison").isEmpty());
+    QCOMPARE(index.find("heals"), QStringList() << "Potion");
+    QCOMPARE(index.count(), 1);
+}
+
+void TestFullTextIndex::findAfterRemove()
+{
+    // ARRANGE.
+    FullTextIndex index;
+    index.insert("Dagger", "Deals poison damage.");
+
+    // ACT.
+    index.remove("Dagger");
+
+    // ASSERT.
+    QVERIFY(index.find("poison").isEmpty());
+    QCOMPARE(index.count(), 0);
+}
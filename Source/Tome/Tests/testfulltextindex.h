@@ -0,0 +1,24 @@
+#ifndef TESTFULLTEXTINDEX_H
+#define TESTFULLTEXTINDEX_H
+
+#include <QtTest/QtTest>
+
+
+/**
+ * @brief Unit tests for finding entries by the words of their texts.
+ */
+class TestFullTextIndex : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void findIgnoresCase();
+        void findWordPrefix();
+        void findAllWords();
+        void findIgnoresWordInfix();
+        void findWithoutWords();
+        void insertReplacesText();
+        void findAfterRemove();
+};
+
+#endif // TESTFULLTEXTINDEX_H
@@ -0,0 +1,82 @@
+#include "testhashutils.h"
+
+#include "../Util/hashutils.h"
+
+using namespace Tome;
+
+
+void TestHashUtils::fnv1a64Empty()
+{
+    // ARRANGE.
+    QByteArray data;
+
+    // ACT.
+    quint64 hash = fnv1a64(data);
+
+    // ASSERT.
+    QCOMPARE(hash, Q_UINT64_C(0xcbf29ce484222325));
+}
+
+void TestHashUtils::fnv1a64OneCharacter()
+{
+    // ARRANGE.
+    QByteArray data("a");
+
+    // ACT.
+    quint64 hash = fnv1a64(data);
+
+    // ASSERT.
+    QCOMPARE(hash, Q_UINT64_C(0xaf63dc4c8601ec8c));
+}
+
+void TestHashUtils::fnv1a64Word()
+{
+    // ARRANGE.
+    QByteArray data("foobar");
+
+    // ACT.
+    quint64 hash = fnv1a64(data);
+
+    // ASSERT.
+    QCOMPARE(hash, Q_UINT64_C(0x85944171f73967e8));
+}
+
+void TestHashUtils::fnv1a64Continued()
+{
+    // ARRANGE.
+    QByteArray first("foo");
+    QByteArray second("bar");
+
+    // ACT.
+    quint64 hash = fnv1a64(second, fnv1a64(first));
+
+    // ASSERT.
+    QCOMPARE(hash, fnv1a64(QByteArray("foobar")));
+}
+
+void TestHashUtils::mixHashDifferentInputs()
+{
+    // ARRANGE.
+    quint64 first = 1;
+    quint64 second = 2;
+
+    // ACT.
+    quint64 firstMixed = mixHash(first);
+    quint64 secondMixed = mixHash(second);
+
+    // ASSERT.
+    QVERIFY(firstMixed != secondMixed);
+    QVERIFY(firstMixed + secondMixed != mixHash(first + second));
+}
+
+void TestHashUtils::hashToStringLeadingZeros()
+{
+    // ARRANGE.
+    quint64 hash = Q_UINT64_C(0xff);
+
+    // ACT.
+    QString s = hashToString(hash);
+
+    // ASSERT.
+    QCOMPARE(s, QString("00000000000000ff"));
+}
@@ -0,0 +1,25 @@
+#ifndef TESTHASHUTILS_H
+#define TESTHASHUTILS_H
+
+#include <QtTest/QtTest>
+
+
+/**
+ * @brief Unit tests for hash utility functions.
+ */
+class TestHashUtils : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void fnv1a64Empty();
+        void fnv1a64OneCharacter();
+        void fnv1a64Word();
+        void fnv1a64Continued();
+
+        void mixHashDifferentInputs();
+
+        void hashToStringLeadingZeros();
+};
+
+#endif // TESTHASHUTILS_H
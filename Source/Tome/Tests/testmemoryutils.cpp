@@ -0,0 +1,65 @@
+#include "testmemoryutils.h"
+
+#include "../Util/memoryutils.h"
+
+using namespace Tome;
+
+
+void TestMemoryUtils::approximateSizeGrowsWithStringLength()
+{
+    // ARRANGE.
+    QString shortString = "a";
+    QString longString = "abcdefghij";
+
+    // ACT.
+    qint64 shortSize = approximateSize(shortString);
+    qint64 longSize = approximateSize(longString);
+
+    // ASSERT.
+    QCOMPARE(longSize - shortSize, qint64(9 * sizeof(QChar)));
+}
+
+void TestMemoryUtils::approximateSizeOfVariantIncludesString()
+{
+    // ARRANGE.
+    QString string = "abcdefghij";
+    QVariant variant = string;
+
+    // ACT.
+    qint64 size = approximateSize(variant);
+
+    // ASSERT.
+    QCOMPARE(size, qint64(sizeof(QVariant)) + approximateSize(string));
+}
+
+void TestMemoryUtils::approximateSizeOfMapIncludesEntries()
+{
+    // ARRANGE.
+    QMap<QString, QVariant> emptyMap;
+    QMap<QString, QVariant> map;
+    map.insert("key", "value");
+
+    // ACT.
+    qint64 emptySize = approximateSize(emptyMap);
+    qint64 size = approximateSize(map);
+
+    // ASSERT.
+    QVERIFY(size >= emptySize + approximateSize(QString("key")) + approximateSize(QVariant("value")));
+}
+
+void TestMemoryUtils::approximateSizeOfNestedListIncludesElements()
+{
+    // ARRANGE.
+    QVariantList innerList;
+    innerList << "a" << "b" << "c";
+
+    QVariantList outerList;
+    outerList << QVariant(innerList);
+
+    // ACT.
+    qint64 innerSize = approximateSize(innerList);
+    qint64 outerSize = approximateSize(outerList);
+
+    // ASSERT.
+    QVERIFY(outerSize > innerSize);
+}
@@ -0,0 +1,21 @@
+#ifndef TESTMEMORYUTILS_H
+#define TESTMEMORYUTILS_H
+
+#include <QtTest/QtTest>
+
+
+/**
+ * @brief Unit tests for memory utility functions.
+ */
+class TestMemoryUtils : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void approximateSizeGrowsWithStringLength();
+        void approximateSizeOfVariantIncludesString();
+        void approximateSizeOfMapIncludesEntries();
+        void approximateSizeOfNestedListIncludesElements();
+};
+
+#endif // TESTMEMORYUTILS_H
@@ -0,0 +1,175 @@
+#include "testprogressreporter.h"
+
+#include "../Util/progressreporter.h"
+
+using namespace Tome;
+
+
+namespace
+{
+    struct Notification
+    {
+        QString title;
+        QString text;
+        int currentValue;
+        int maximumValue;
+    };
+
+    ProgressReporter::Callback recordTo(QList<Notification>& notifications)
+    {
+        return [&notifications](const QString& title, const QString& text, int currentValue, int maximumValue)
+        {
+            Notification notification;
+            notification.title = title;
+            notification.text = text;
+            notification.currentValue = currentValue;
+            notification.maximumValue = maximumValue;
+            notifications << notification;
+        };
+    }
+}
+
+
+void TestProgressReporter::updateFirstNotifies()
+{
+    // ARRANGE.
+    QList<Notification> notifications;
+    ProgressReporter progress("Title", 10, recordTo(notifications));
+
+    // ACT.
+    progress.update(0, "First");
+
+    // ASSERT.
+    QCOMPARE(notifications.count(), 1);
+    QCOMPARE(notifications[0].title, QString("Title"));
+    QCOMPARE(notifications[0].text, QString("First"));
+    QCOMPARE(notifications[0].currentValue, 0);
+    QCOMPARE(notifications[0].maximumValue, 10);
+}
+
+void TestProgressReporter::updateThrottled()
+{
+    // ARRANGE.
+    QList<Notification> notifications;
+    ProgressReporter progress("Title", 100000, recordTo(notifications));
+
+    // ACT.
+    for (int i = 0; i < 1000; ++i)
+    {
+        progress.update(i);
+    }
+
+    // ASSERT.
+    QVERIFY(notifications.count() < 10);
+}
+
+void TestProgressReporter::updateAfterInterval()
+{
+    // ARRANGE.
+    QList<Notification> notifications;
+    ProgressReporter progress("Title", 100, recordTo(notifications));
+    progress.update(0);
+
+    // ACT.
+    QTest::qSleep(ProgressReporter::MinimumIntervalMilliseconds + 10);
+    progress.update(50, "Half");
+
+    // ASSERT.
+    QCOMPARE(notifications.count(), 2);
+    QCOMPARE(notifications[1].text, QString("Half"));
+    QCOMPARE(notifications[1].currentValue, 50);
+}
+
+void TestProgressReporter::finishNotifiesOnce()
+{
+    // ARRANGE.
+    QList<Notification> notifications;
+
+    {
+        ProgressReporter progress("Title", 10, recordTo(notifications));
+
+        // ACT.
+        progress.finish();
+    }
+
+    // ASSERT.
+    QCOMPARE(notifications.count(), 1);
+    QCOMPARE(notifications[0].currentValue, 1);
+    QCOMPARE(notifications[0].maximumValue, 1);
+    QVERIFY(ProgressReporter::current() == nullptr);
+}
+
+void TestProgressReporter::nestedPhaseReportsRelativeToOuter()
+{
+    // ARRANGE.
+    QList<Notification> outerNotifications;
+    QList<Notification> innerNotifications;
+
+    ProgressReporter outer("Outer", 4, recordTo(outerNotifications));
+    outer.update(2);
+
+    QTest::qSleep(ProgressReporter::MinimumIntervalMilliseconds + 10);
+
+    ProgressReporter inner("Inner", 10, recordTo(innerNotifications));
+
+    // ACT.
+    inner.update(5, "Half");
+
+    // ASSERT.
+    QCOMPARE(innerNotifications.count(), 1);
+    QCOMPARE(innerNotifications[0].title, QString("Inner"));
+    QCOMPARE(innerNotifications[0].currentValue, ProgressReporter::NestedMaximumValue * 5 / 8);
+    QCOMPARE(innerNotifications[0].maximumValue, ProgressReporter::NestedMaximumValue);
+}
+
+void TestProgressReporter::nestedPhaseDoesNotFinishOuter()
+{
+    // ARRANGE.
+    QList<Notification> outerNotifications;
+    QList<Notification> innerNotifications;
+
+    ProgressReporter outer("Outer", 2, recordTo(outerNotifications));
+
+    {
+        ProgressReporter inner("Inner", 10, recordTo(innerNotifications));
+
+        // ACT.
+        inner.finish();
+
+        // ASSERT.
+        QVERIFY(ProgressReporter::current() == &outer);
+    }
+
+    QVERIFY(innerNotifications.isEmpty());
+    QVERIFY(outerNotifications.isEmpty());
+}
+
+void TestProgressReporter::cancelStopsNestedPhases()
+{
+    // ARRANGE.
+    QList<Notification> notifications;
+
+    ProgressReporter outer("Outer", 2, recordTo(notifications), true);
+    ProgressReporter inner("Inner", 10, recordTo(notifications), true);
+
+    // ACT.
+    outer.cancel();
+
+    // ASSERT.
+    QVERIFY(inner.isCanceled());
+    QVERIFY(!inner.update(1));
+}
+
+void TestProgressReporter::cancelCurrentRequiresCancelable()
+{
+    // ARRANGE.
+    QList<Notification> notifications;
+    ProgressReporter progress("Title", 10, recordTo(notifications));
+
+    // ACT.
+    ProgressReporter::cancelCurrent();
+
+    // ASSERT.
+    QVERIFY(!progress.isCanceled());
+    QVERIFY(progress.update(1));
+}
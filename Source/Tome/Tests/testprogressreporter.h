@@ -0,0 +1,28 @@
+#ifndef TESTPROGRESSREPORTER_H
+#define TESTPROGRESSREPORTER_H
+
+#include <QtTest/QtTest>
+
+
+/**
+ * @brief Unit tests for reporting progress of long operations.
+ */
+class TestProgressReporter : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void updateFirstNotifies();
+        void updateThrottled();
+        void updateAfterInterval();
+
+        void finishNotifiesOnce();
+
+        void nestedPhaseReportsRelativeToOuter();
+        void nestedPhaseDoesNotFinishOuter();
+
+        void cancelStopsNestedPhases();
+        void cancelCurrentRequiresCancelable();
+};
+
+#endif // TESTPROGRESSREPORTER_H
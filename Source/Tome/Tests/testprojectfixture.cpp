@@ -0,0 +1,70 @@
+#include "testprojectfixture.h"
+
+#include "../Features/Components/Controller/componentscontroller.h"
+#include "../Features/Fields/Controller/fielddefinitionscontroller.h"
+#include "../Features/Projects/Controller/projectcontroller.h"
+#include "../Features/Projects/Model/project.h"
+#include "../Features/Projects/Model/recordidtype.h"
+#include "../Features/Records/Controller/recordscontroller.h"
+#include "../Features/Types/Controller/typescontroller.h"
+
+using namespace Tome;
+
+
+const QString TestProjectFixture::ProjectName = "Test";
+
+
+TestProjectFixture::TestProjectFixture()
+{
+    this->componentsController = new ComponentsController();
+    this->typesController = new TypesController();
+    this->fieldDefinitionsController = new FieldDefinitionsController(*this->componentsController, *this->typesController);
+    this->projectController = new ProjectController();
+    this->recordsController = new RecordsController(*this->fieldDefinitionsController, *this->projectController, *this->typesController);
+
+    connect(
+                this->projectController,
+                SIGNAL(projectChanged(QSharedPointer<Tome::Project>)),
+                SLOT(onProjectChanged(QSharedPointer<Tome::Project>))
+                );
+
+    this->projectController->createProject(ProjectName, this->projectDir.path(), RecordIdType::String);
+}
+
+TestProjectFixture::~TestProjectFixture()
+{
+    delete this->recordsController;
+    delete this->projectController;
+    delete this->fieldDefinitionsController;
+    delete this->typesController;
+    delete this->componentsController;
+}
+
+FieldDefinitionsController& TestProjectFixture::getFieldDefinitionsController() const
+{
+    return *this->fieldDefinitionsController;
+}
+
+ProjectController& TestProjectFixture::getProjectController() const
+{
+    return *this->projectController;
+}
+
+RecordsController& TestProjectFixture::getRecordsController() const
+{
+    return *this->recordsController;
+}
+
+TypesController& TestProjectFixture::getTypesController() const
+{
+    return *this->typesController;
+}
+
+void TestProjectFixture::onProjectChanged(QSharedPointer<Project> project)
+{
+    // Edit the project the same way the application does.
+    this->componentsController->setComponents(project->componentSets);
+    this->fieldDefinitionsController->setFieldDefinitionSets(project->fieldDefinitionSets);
+    this->recordsController->setRecordSets(project->recordSets);
+    this->typesController->setCustomTypes(project->typeSets);
+}
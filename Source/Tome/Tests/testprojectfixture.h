@@ -0,0 +1,56 @@
+#ifndef TESTPROJECTFIXTURE_H
+#define TESTPROJECTFIXTURE_H
+
+#include <QObject>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+
+namespace Tome
+{
+    class ComponentsController;
+    class FieldDefinitionsController;
+    class Project;
+    class ProjectController;
+    class RecordsController;
+    class TypesController;
+}
+
+
+/**
+ * @brief Empty project in a temporary directory, along with the controllers for editing it, shared by unit tests.
+ */
+class TestProjectFixture : public QObject
+{
+    Q_OBJECT
+
+    public:
+        /**
+         * @brief Name of the project, and of its field definition set, record set, component set and custom type set.
+         */
+        static const QString ProjectName;
+
+        /**
+         * @brief Creates a new empty project with string record ids in a temporary directory.
+         */
+        TestProjectFixture();
+        ~TestProjectFixture();
+
+        Tome::FieldDefinitionsController& getFieldDefinitionsController() const;
+        Tome::ProjectController& getProjectController() const;
+        Tome::RecordsController& getRecordsController() const;
+        Tome::TypesController& getTypesController() const;
+
+    private slots:
+        void onProjectChanged(QSharedPointer<Tome::Project> project);
+
+    private:
+        QTemporaryDir projectDir;
+
+        Tome::ComponentsController* componentsController;
+        Tome::TypesController* typesController;
+        Tome::FieldDefinitionsController* fieldDefinitionsController;
+        Tome::ProjectController* projectController;
+        Tome::RecordsController* recordsController;
+};
+
+#endif // TESTPROJECTFIXTURE_H
@@ -0,0 +1,101 @@
+#include "teststringreplacer.h"
+
+#include "../Util/stringreplacer.h"
+
+using namespace Tome;
+
+
+void TestStringReplacer::replaceNone()
+{
+    // ARRANGE.
+    QMap<QString, QString> replacements;
+    replacements.insert("x", "y");
+
+    StringReplacer replacer(replacements);
+
+    // ACT.
+    QString replaced = replacer.replace("abc");
+
+    // ASSERT.
+    QCOMPARE(replaced, QString("abc"));
+}
+
+void TestStringReplacer::replaceEscapesWithoutCascading()
+{
+    // ARRANGE.
+    QMap<QString, QString> replacements;
+    replacements.insert("\\", "\\\\");
+    replacements.insert("\"", "\\\"");
+
+    StringReplacer replacer(replacements);
+
+    // ACT.
+    QString replaced = replacer.replace("a\"b\\c");
+
+    // ASSERT.
+    QCOMPARE(replaced, QString("a\\\"b\\\\c"));
+}
+
+void TestStringReplacer::replacePrefersLeftmostMatch()
+{
+    // ARRANGE.
+    QMap<QString, QString> replacements;
+    replacements.insert("bc", "1");
+    replacements.insert("cdx", "2");
+
+    StringReplacer replacer(replacements);
+
+    // ACT.
+    QString replaced = replacer.replace("abcdx");
+
+    // ASSERT.
+    QCOMPARE(replaced, QString("a1dx"));
+}
+
+void TestStringReplacer::replacePrefersLongestMatch()
+{
+    // ARRANGE.
+    QMap<QString, QString> replacements;
+    replacements.insert("a", "1");
+    replacements.insert("ab", "2");
+    replacements.insert("abc", "3");
+
+    StringReplacer replacer(replacements);
+
+    // ACT.
+    QString replaced = replacer.replace("abcab");
+
+    // ASSERT.
+    QCOMPARE(replaced, QString("32"));
+}
+
+void TestStringReplacer::replaceContinuesAfterMatch()
+{
+    // ARRANGE.
+    QMap<QString, QString> replacements;
+    replacements.insert("aa", "b");
+
+    StringReplacer replacer(replacements);
+
+    // ACT.
+    QString replaced = replacer.replace("aaaaa");
+
+    // ASSERT.
+    QCOMPARE(replaced, QString("bba"));
+}
+
+void TestStringReplacer::replaceIgnoresEmptyPattern()
+{
+    // ARRANGE.
+    QMap<QString, QString> replacements;
+    replacements.insert("", "x");
+
+    StringReplacer replacer(replacements);
+
+    // ACT.
+    QString replaced = replacer.replace("abc");
+
+    // ASSERT.
+    QCOMPARE(replacer.isEmpty(), true);
+    QCOMPARE(replaced, QString("abc"));
+}
@@ -0,0 +1,23 @@
+#ifndef TESTSTRINGREPLACER_H
+#define TESTSTRINGREPLACER_H
+
+#include <QtTest/QtTest>
+
+
+/**
+ * @brief Unit tests for replacing many patterns in a single pass.
+ */
+class TestStringReplacer : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void replaceNone();
+        void replaceEscapesWithoutCascading();
+        void replacePrefersLeftmostMatch();
+        void replacePrefersLongestMatch();
+        void replaceContinuesAfterMatch();
+        void replaceIgnoresEmptyPattern();
+};
+
+#endif // TESTSTRINGREPLACER_H
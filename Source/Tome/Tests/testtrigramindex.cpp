@@ -0,0 +1,77 @@
+#include "testtrigramindex.h"
+
+#include "../Util/trigramindex.h"
+
+using namespace Tome;
+
+
+void TestTrigramIndex::findIgnoresCase()
+{
+    // ARRANGE.
+    TrigramIndex index;
+    index.insert("Sword", QStringList() << "Sword" << "Long Sword");
+    index.insert("Shield", QStringList() << "Shield" << "Wooden Shield");
+
+    // ACT.
+    QStringList keys = index.find("WOOD");
+
+    // ASSERT.
+    QCOMPARE(keys, QStringList() << "Shield");
+}
+
+void TestTrigramIndex::findShortPattern()
+{
+    // ARRANGE.
+    TrigramIndex index;
+    index.insert("Sword", QStringList() << "Sword");
+    index.insert("Axe", QStringList() << "Axe");
+
+    // ACT.
+    QStringList keys = index.find("x");
+
+    // ASSERT.
+    QCOMPARE(keys, QStringList() << "Axe");
+}
+
+void TestTrigramIndex::findVerifiesCandidates()
+{
+    // ARRANGE.
+    TrigramIndex index;
+    index.insert("Sword", QStringList() << "Long Sword");
+
+    // ACT.
+    // All trigrams of the pattern occur in the text, but the pattern doesn't.
+    QStringList keys = index.find("ordlon");
+
+    // ASSERT.
+    QVERIFY(keys.isEmpty());
+}
+
+void TestTrigramIndex::findAfterRemove()
+{
+    // ARRANGE.
+    TrigramIndex index;
+    index.insert("Sword", QStringList() << "Sword");
+
+    // ACT.
+    index.remove("Sword");
+
+    // ASSERT.
+    QVERIFY(index.find("sword").isEmpty());
+    QCOMPARE(index.count(), 0);
+}
+
+void TestTrigramIndex::insertReplacesTexts()
+{
+    // ARRANGE.
+    TrigramIndex index;
+    index.insert("Shield", QStringList() << "Wooden Shield");
+
+    // ACT.
+    index.insert("Shield", QStringList() << "Iron Shield");
+
+    // ASSERT.
+    QVERIFY(index.find("wood").isEmpty());
+    QCOMPARE(index.find("iron"), QStringList() << "Shield");
+    QCOMPARE(index.count(), 1);
+}
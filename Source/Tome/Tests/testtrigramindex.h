@@ -0,0 +1,22 @@
+#ifndef TESTTRIGRAMINDEX_H
+#define TESTTRIGRAMINDEX_H
+
+#include <QtTest/QtTest>
+
+
+/**
+ * @brief Unit tests for finding entries by substrings of their texts.
+ */
+class TestTrigramIndex : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void findIgnoresCase();
+        void findShortPattern();
+        void findVerifiesCandidates();
+        void findAfterRemove();
+        void insertReplacesTexts();
+};
+
+#endif // TESTTRIGRAMINDEX_H
@@ -0,0 +1,66 @@
+#include "testupdaterecordfieldvaluescommand.h"
+
+#include "testprojectfixture.h"
+#include "../Features/Fields/Controller/fielddefinitionscontroller.h"
+#include "../Features/Records/Controller/recordscontroller.h"
+#include "../Features/Records/Controller/Commands/updaterecordfieldvaluescommand.h"
+#include "../Features/Types/Model/builtintype.h"
+
+using namespace Tome;
+
+
+void TestUpdateRecordFieldValuesCommand::init()
+{
+    this->fixture = new TestProjectFixture();
+
+    this->fixture->getFieldDefinitionsController().addFieldDefinition("Description",
+                                                                      "Description",
+                                                                      BuiltInType::String,
+                                                                      QString(),
+                                                                      QString(),
+                                                                      QString(),
+                                                                      TestProjectFixture::ProjectName);
+
+    // Parent with own value, and child inheriting it.
+    RecordsController& recordsController = this->fixture->getRecordsController();
+    recordsController.addRecord("Parent", "Parent", QString(), QStringList() << "Description", TestProjectFixture::ProjectName);
+    recordsController.addRecord("Child", "Child", QString(), QStringList(), TestProjectFixture::ProjectName);
+    recordsController.updateRecordFieldValue("Parent", "Description", "Old");
+    recordsController.reparentRecord("Child", "Parent");
+}
+
+void TestUpdateRecordFieldValuesCommand::cleanup()
+{
+    delete this->fixture;
+}
+
+void TestUpdateRecordFieldValuesCommand::redoDropsChildValueEqualToParentValue()
+{
+    // ARRANGE.
+    UpdateRecordFieldValuesCommand command(this->fixture->getRecordsController(), QVariantList() << "Child" << "Parent", "Description", QVariant("New"));
+
+    // ACT.
+    command.redo();
+
+    // ASSERT.
+    QVERIFY(!this->fixture->getRecordsController().getRecord("Child").fieldValues.contains("Description"));
+    QCOMPARE(this->fixture->getRecordsController().getRecordFieldValue("Child", "Description"), QVariant("New"));
+}
+
+void TestUpdateRecordFieldValuesCommand::undoKeepsChildInheritingFromParent()
+{
+    // ARRANGE.
+    UpdateRecordFieldValuesCommand command(this->fixture->getRecordsController(), QVariantList() << "Parent" << "Child", "Description", QVariant("New"));
+    command.redo();
+
+    // ACT.
+    command.undo();
+
+    // ASSERT.
+    QCOMPARE(this->fixture->getRecordsController().getRecordFieldValue("Parent", "Description"), QVariant("Old"));
+    QVERIFY(!this->fixture->getRecordsController().getRecord("Child").fieldValues.contains("Description"));
+
+    // Child must still follow its parent.
+    this->fixture->getRecordsController().updateRecordFieldValue("Parent", "Description", "Changed");
+    QCOMPARE(this->fixture->getRecordsController().getRecordFieldValue("Child", "Description"), QVariant("Changed"));
+}
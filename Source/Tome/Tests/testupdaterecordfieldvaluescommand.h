@@ -0,0 +1,27 @@
+#ifndef TESTUPDATERECORDFIELDVALUESCOMMAND_H
+#define TESTUPDATERECORDFIELDVALUESCOMMAND_H
+
+#include <QtTest/QtTest>
+
+class TestProjectFixture;
+
+
+/**
+ * @brief Unit tests for updating the same field of many records as a single undo step.
+ */
+class TestUpdateRecordFieldValuesCommand : public QObject
+{
+    Q_OBJECT
+
+    private slots:
+        void init();
+        void cleanup();
+
+        void redoDropsChildValueEqualToParentValue();
+        void undoKeepsChildInheritingFromParent();
+
+    private:
+        TestProjectFixture* fixture;
+};
+
+#endif // TESTUPDATERECORDFIELDVALUESCOMMAND_H
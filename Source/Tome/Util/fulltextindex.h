@@ -0,0 +1,190 @@
+#ifndef FULLTEXTINDEX_H
+#define FULLTEXTINDEX_H
+
+#include <algorithm>
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+namespace Tome
+{
+    /**
+     * @brief Inverted index of the words of the texts of many entries, for finding all entries containing all words of a query, ignoring case.
+     *
+     * Words are runs of letters and digits. Each word of a query matches all indexed words starting with it,
+     * e.g. "poison" matches "poisonous".
+     */
+    class FullTextIndex
+    {
+        public:
+            /**
+             * @brief Removes all entries from the index.
+             */
+            void clear()
+            {
+                this->entryWords.clear();
+                this->wordKeys.clear();
+            }
+
+            /**
+             * @brief Gets the number of indexed entries.
+             * @return Number of indexed entries.
+             */
+            int count() const
+            {
+                return this->entryWords.count();
+            }
+
+            /**
+             * @brief Finds all entries whose text contains words starting with each word of the specified query, ignoring case.
+             * @param query Words to look for.
+             * @return Keys of all entries whose text contains words starting with each word of the specified query, in no particular order.
+             */
+            QStringList find(const QString& query) const
+            {
+                QStringList keys;
+                const QStringList queryWords = getWords(query);
+
+                if (queryWords.isEmpty())
+                {
+                    return keys;
+                }
+
+                // Collect entries for each query word, smallest first.
+                QList<QSet<QString>> candidateSets;
+
+                for (const QString& queryWord : queryWords)
+                {
+                    QSet<QString> candidates;
+
+                    for (QMap<QString, QSet<QString>>::const_iterator it = this->wordKeys.lowerBound(queryWord);
+                         it != this->wordKeys.cend() && it.key().startsWith(queryWord);
+                         ++it)
+                    {
+                        candidates.unite(it.value());
+                    }
+
+                    if (candidates.isEmpty())
+                    {
+                        return keys;
+                    }
+
+                    candidateSets << candidates;
+                }
+
+                std::sort(candidateSets.begin(), candidateSets.end(), [](const QSet<QString>& lhs, const QSet<QString>& rhs)
+                {
+                    return lhs.count() < rhs.count();
+                });
+
+                // Intersect candidates.
+                for (const QString& key : candidateSets.first())
+                {
+                    bool match = true;
+
+                    for (int i = 1; i < candidateSets.count() && match; ++i)
+                    {
+                        match = candidateSets[i].contains(key);
+                    }
+
+                    if (match)
+                    {
+                        keys << key;
+                    }
+                }
+
+                return keys;
+            }
+
+            /**
+             * @brief Adds the entry with the specified key to the index, replacing any previous text of that entry.
+             * @param key Key of the entry to add.
+             * @param text Text to find the entry by.
+             */
+            void insert(const QString& key, const QString& text)
+            {
+                this->remove(key);
+
+                const QStringList words = getWords(text);
+
+                if (words.isEmpty())
+                {
+                    return;
+                }
+
+                for (const QString& word : words)
+                {
+                    this->wordKeys[word].insert(key);
+                }
+
+                this->entryWords.insert(key, words);
+            }
+
+            /**
+             * @brief Removes the entry with the specified key from the index, if it exists.
+             * @param key Key of the entry to remove.
+             */
+            void remove(const QString& key)
+            {
+                QHash<QString, QStringList>::iterator it = this->entryWords.find(key);
+
+                if (it == this->entryWords.end())
+                {
+                    return;
+                }
+
+                for (const QString& word : it.value())
+                {
+                    QMap<QString, QSet<QString>>::iterator itKeys = this->wordKeys.find(word);
+
+                    if (itKeys != this->wordKeys.end())
+                    {
+                        itKeys.value().remove(key);
+
+                        if (itKeys.value().isEmpty())
+                        {
+                            this->wordKeys.erase(itKeys);
+                        }
+                    }
+                }
+
+                this->entryWords.erase(it);
+            }
+
+        private:
+            // Distinct case-folded words by entry key, and entry keys by word, sorted for looking up prefixes.
+            QHash<QString, QStringList> entryWords;
+            QMap<QString, QSet<QString>> wordKeys;
+
+            static QStringList getWords(const QString& text)
+            {
+                const QString foldedText = text.toCaseFolded();
+
+                QSet<QString> words;
+                int wordStart = -1;
+
+                for (int i = 0; i <= foldedText.length(); ++i)
+                {
+                    const bool letterOrNumber = i < foldedText.length() && foldedText[i].isLetterOrNumber();
+
+                    if (letterOrNumber && wordStart < 0)
+                    {
+                        wordStart = i;
+                    }
+                    else if (!letterOrNumber && wordStart >= 0)
+                    {
+                        words.insert(foldedText.mid(wordStart, i - wordStart));
+                        wordStart = -1;
+                    }
+                }
+
+                return words.toList();
+            }
+    };
+}
+
+#endif // FULLTEXTINDEX_H
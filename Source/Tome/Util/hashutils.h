@@ -0,0 +1,60 @@
+#ifndef HASHUTILS_H
+#define HASHUTILS_H
+
+#include <QByteArray>
+#include <QString>
+#include <QtGlobal>
+
+namespace Tome
+{
+    /**
+     * @brief Initial value for computing 64-bit FNV-1a hashes.
+     */
+    const quint64 Fnv1aOffsetBasis = Q_UINT64_C(14695981039346656037);
+
+    /**
+     * @brief Computes a fast, non-cryptographic 64-bit FNV-1a hash of the passed data.
+     * @param data Data to hash.
+     * @param hash Hash to continue, or Fnv1aOffsetBasis for starting a new one.
+     * @return 64-bit FNV-1a hash of the passed data.
+     */
+    inline quint64 fnv1a64(const QByteArray& data, quint64 hash = Fnv1aOffsetBasis)
+    {
+        const quint64 prime = Q_UINT64_C(1099511628211);
+
+        for (int i = 0; i < data.size(); ++i)
+        {
+            hash ^= static_cast<quint8>(data[i]);
+            hash *= prime;
+        }
+
+        return hash;
+    }
+
+    /**
+     * @brief Scrambles the bits of the passed hash, so that the results of similar inputs can be safely added up.
+     * @param hash Hash to scramble.
+     * @return Scrambled hash.
+     */
+    inline quint64 mixHash(quint64 hash)
+    {
+        hash ^= hash >> 33;
+        hash *= Q_UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        hash *= Q_UINT64_C(0xc4ceb9fe1a85ec53);
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    /**
+     * @brief Converts the passed 64-bit hash to a hex string of fixed length.
+     * @param hash Hash to convert.
+     * @return 16 digit hex string representing the passed hash.
+     */
+    inline QString hashToString(quint64 hash)
+    {
+        return QString("%1").arg(hash, 16, 16, QChar('0'));
+    }
+}
+
+#endif // HASHUTILS_H
@@ -2,6 +2,11 @@
 #define MEMORYUTILS_H
 
 #include <QLayout>
+#include <QList>
+#include <QMap>
+#include <QPair>
+#include <QString>
+#include <QVariant>
 
 namespace Tome
 {
@@ -21,7 +26,99 @@ namespace Tome
 
         delete layout;
     }
+
+    /**
+     * @brief Approximate number of bytes used for managing a single heap allocation, e.g. a list or map node.
+     */
+    const qint64 ApproximateAllocationOverhead = 2 * sizeof(void*);
+
+    inline qint64 approximateSize(const QVariant& value);
+
+    /**
+     * @brief Approximates the number of bytes the passed string occupies in memory.
+     * @param value String to get the size of.
+     * @return Approximate number of bytes the passed string occupies in memory.
+     */
+    inline qint64 approximateSize(const QString& value)
+    {
+        return sizeof(QString) + ApproximateAllocationOverhead + value.size() * sizeof(QChar);
+    }
+
+    /**
+     * @brief Approximates the number of bytes the passed pair occupies in memory, including its contents.
+     * @param value Pair to get the size of.
+     * @return Approximate number of bytes the passed pair occupies in memory.
+     */
+    template<typename T1, typename T2>
+    inline qint64 approximateSize(const QPair<T1, T2>& value)
+    {
+        return approximateSize(value.first) + approximateSize(value.second);
+    }
+
+    /**
+     * @brief Approximates the number of bytes the passed list occupies in memory, including its contents.
+     * @param value List to get the size of.
+     * @return Approximate number of bytes the passed list occupies in memory.
+     */
+    template<typename T>
+    inline qint64 approximateSize(const QList<T>& value)
+    {
+        qint64 size = sizeof(QList<T>) + ApproximateAllocationOverhead;
+
+        for (const T& element : value)
+        {
+            size += sizeof(void*) + ApproximateAllocationOverhead + approximateSize(element);
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Approximates the number of bytes the passed map occupies in memory, including its contents.
+     * @param value Map to get the size of.
+     * @return Approximate number of bytes the passed map occupies in memory.
+     */
+    template<typename Key, typename T>
+    inline qint64 approximateSize(const QMap<Key, T>& value)
+    {
+        qint64 size = sizeof(QMap<Key, T>) + ApproximateAllocationOverhead;
+
+        for (typename QMap<Key, T>::const_iterator it = value.cbegin(); it != value.cend(); ++it)
+        {
+            size += 3 * sizeof(void*) + ApproximateAllocationOverhead + approximateSize(it.key()) + approximateSize(it.value());
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Approximates the number of bytes the passed variant occupies in memory, including its contents.
+     * @param value Variant to get the size of.
+     * @return Approximate number of bytes the passed variant occupies in memory.
+     */
+    inline qint64 approximateSize(const QVariant& value)
+    {
+        switch (value.type())
+        {
+            case QVariant::String:
+                return sizeof(QVariant) + approximateSize(value.toString());
+
+            case QVariant::StringList:
+                return sizeof(QVariant) + approximateSize(value.toStringList());
+
+            case QVariant::ByteArray:
+                return sizeof(QVariant) + ApproximateAllocationOverhead + value.toByteArray().size();
+
+            case QVariant::List:
+                return sizeof(QVariant) + approximateSize(value.toList());
+
+            case QVariant::Map:
+                return sizeof(QVariant) + approximateSize(value.toMap());
+
+            default:
+                return sizeof(QVariant);
+        }
+    }
 }
 
 #endif // MEMORYUTILS_H
-
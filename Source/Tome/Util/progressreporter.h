@@ -0,0 +1,244 @@
+#ifndef PROGRESSREPORTER_H
+#define PROGRESSREPORTER_H
+
+#include <atomic>
+#include <functional>
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QtGlobal>
+
+namespace Tome
+{
+    /**
+     * @brief Reports the progress of a long operation, limiting how often listeners are notified.
+     *
+     * Listeners are notified at most about 30 times per second, and only if progress has visibly changed, or the text
+     * hasn't been updated for a while. Reporters created while another one is active on the same thread become nested
+     * phases of that one, reporting their progress as part of the current step of the outer operation. Cancelling
+     * a reporter cancels all of its phases.
+     */
+    class ProgressReporter
+    {
+        public:
+            /**
+             * @brief Notifies listeners about progress, e.g. by emitting a progressChanged signal.
+             */
+            typedef std::function<void(const QString& title, const QString& text, int currentValue, int maximumValue)> Callback;
+
+            /**
+             * @brief Minimum time between two notifications, in milliseconds.
+             */
+            static const qint64 MinimumIntervalMilliseconds = 33;
+
+            /**
+             * @brief Time after which listeners are notified even if progress hasn't visibly changed, in milliseconds.
+             */
+            static const qint64 MaximumIntervalMilliseconds = 500;
+
+            /**
+             * @brief Maximum value reported by nested phases, which report their progress relative to the outermost operation.
+             */
+            static const int NestedMaximumValue = 1000;
+
+            /**
+             * @brief Starts reporting progress of a new operation, or of a new phase of the current operation.
+             * @param title Title of the operation to report the progress of.
+             * @param maximumValue Number of steps of the operation.
+             * @param callback Function for notifying listeners about progress.
+             * @param cancelable Whether the operation can be canceled by the user.
+             */
+            ProgressReporter(const QString& title, int maximumValue, Callback callback, bool cancelable = false)
+                : title(title),
+                  maximumValue(maximumValue),
+                  callback(callback),
+                  cancelable(cancelable),
+                  currentValue(0),
+                  canceled(false),
+                  notified(false),
+                  lastNotificationMilliseconds(0),
+                  lastNotificationFraction(0.0),
+                  finished(false)
+            {
+                this->parent = current();
+                current() = this;
+
+                if (this->parent == nullptr)
+                {
+                    this->timer.start();
+                }
+            }
+
+            /**
+             * @brief Finishes reporting progress, if not already done.
+             */
+            ~ProgressReporter()
+            {
+                this->finish();
+            }
+
+            /**
+             * @brief Reports progress of the operation, notifying listeners if enough time has passed since the last notification.
+             * @param currentValue Number of steps already completed.
+             * @param text Description of the current step.
+             * @return false, if the operation has been canceled, and true otherwise.
+             */
+            bool update(int currentValue, const QString& text = QString())
+            {
+                this->currentValue = currentValue;
+
+                ProgressReporter* root = this->getRoot();
+                const double fraction = this->toRootFraction(currentValue);
+                const qint64 elapsed = root->timer.elapsed();
+                const qint64 sinceLastNotification = elapsed - root->lastNotificationMilliseconds;
+
+                const bool notify = !root->notified ||
+                        (sinceLastNotification >= MinimumIntervalMilliseconds &&
+                         (fraction - root->lastNotificationFraction >= 0.005 ||
+                          sinceLastNotification >= MaximumIntervalMilliseconds));
+
+                if (notify)
+                {
+                    root->notified = true;
+                    root->lastNotificationMilliseconds = elapsed;
+                    root->lastNotificationFraction = fraction;
+
+                    if (this->parent == nullptr)
+                    {
+                        this->callback(this->title, text, currentValue, this->maximumValue);
+                    }
+                    else
+                    {
+                        this->callback(this->title, text, qRound(fraction * NestedMaximumValue), NestedMaximumValue);
+                    }
+                }
+
+                return !this->isCanceled();
+            }
+
+            /**
+             * @brief Finishes reporting progress. Notifies listeners that the whole operation has finished, if this isn't a nested phase.
+             */
+            void finish()
+            {
+                if (this->finished)
+                {
+                    return;
+                }
+
+                this->finished = true;
+
+                if (current() == this)
+                {
+                    current() = this->parent;
+                }
+
+                if (this->parent == nullptr)
+                {
+                    this->callback(this->title, QString(), 1, 1);
+                }
+            }
+
+            /**
+             * @brief Requests the operation to stop as soon as possible, including all of its phases.
+             */
+            void cancel()
+            {
+                this->getRoot()->canceled.store(true);
+            }
+
+            /**
+             * @brief Checks whether the operation has been requested to stop.
+             * @return true, if the operation has been canceled, and false otherwise.
+             */
+            bool isCanceled() const
+            {
+                return this->getRoot()->canceled.load();
+            }
+
+            /**
+             * @brief Checks whether the operation and all operations it is part of can be canceled by the user.
+             * @return true, if the operation can be canceled, and false otherwise.
+             */
+            bool isCancelable() const
+            {
+                return this->cancelable && (this->parent == nullptr || this->parent->isCancelable());
+            }
+
+            /**
+             * @brief Gets the innermost operation currently reporting progress on this thread.
+             * @return Innermost operation currently reporting progress, or nullptr if there is none.
+             */
+            static ProgressReporter*& current()
+            {
+                thread_local ProgressReporter* reporter = nullptr;
+                return reporter;
+            }
+
+            /**
+             * @brief Creates a callback that emits the specified progressChanged signal.
+             * @param emitter Object to emit the signal from.
+             * @param signal Signal to emit.
+             * @return Callback that emits the specified signal.
+             */
+            template<typename Emitter, typename Signal>
+            static Callback forSignal(Emitter* emitter, Signal signal)
+            {
+                return [emitter, signal](const QString& title, const QString& text, int currentValue, int maximumValue)
+                {
+                    emit (emitter->*signal)(title, text, currentValue, maximumValue);
+                };
+            }
+
+            /**
+             * @brief Requests the innermost operation currently reporting progress on this thread to stop, if it can be canceled.
+             */
+            static void cancelCurrent()
+            {
+                ProgressReporter* reporter = current();
+
+                if (reporter != nullptr && reporter->isCancelable())
+                {
+                    reporter->cancel();
+                }
+            }
+
+        private:
+            Q_DISABLE_COPY(ProgressReporter)
+
+            const QString title;
+            const int maximumValue;
+            const Callback callback;
+            const bool cancelable;
+
+            ProgressReporter* parent;
+            int currentValue;
+
+            // Only used by the outermost operation.
+            std::atomic<bool> canceled;
+            QElapsedTimer timer;
+            bool notified;
+            qint64 lastNotificationMilliseconds;
+            double lastNotificationFraction;
+
+            bool finished;
+
+            ProgressReporter* getRoot()
+            {
+                return this->parent == nullptr ? this : this->parent->getRoot();
+            }
+
+            const ProgressReporter* getRoot() const
+            {
+                return this->parent == nullptr ? this : this->parent->getRoot();
+            }
+
+            double toRootFraction(double value) const
+            {
+                const double fraction = this->maximumValue > 0 ? qBound(0.0, value / this->maximumValue, 1.0) : 1.0;
+                return this->parent == nullptr ? fraction : this->parent->toRootFraction(this->parent->currentValue + fraction);
+            }
+    };
+}
+
+#endif // PROGRESSREPORTER_H
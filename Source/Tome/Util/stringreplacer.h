@@ -0,0 +1,220 @@
+#ifndef STRINGREPLACER_H
+#define STRINGREPLACER_H
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace Tome
+{
+    /**
+     * @brief Replaces many patterns in a string at once, scanning it only once.
+     *
+     * Patterns are compiled into an Aho-Corasick automaton. Where patterns overlap, the match starting first wins,
+     * and of all matches starting there, the longest one. Replacements are never scanned again, so they can't cause
+     * further replacements, e.g. when escaping "\" and "\"" at the same time.
+     */
+    class StringReplacer
+    {
+        public:
+            /**
+             * @brief Constructs a new replacer that doesn't replace anything.
+             */
+            StringReplacer()
+            {
+                this->nodes << Node();
+            }
+
+            /**
+             * @brief Compiles the specified patterns and their replacements.
+             * @param replacements Replacements by pattern. Empty patterns are ignored.
+             */
+            explicit StringReplacer(const QMap<QString, QString>& replacements)
+            {
+                this->nodes << Node();
+
+                // Build trie of all patterns.
+                for (QMap<QString, QString>::const_iterator it = replacements.cbegin();
+                     it != replacements.cend();
+                     ++it)
+                {
+                    const QString& pattern = it.key();
+
+                    if (pattern.isEmpty())
+                    {
+                        continue;
+                    }
+
+                    int node = 0;
+
+                    for (const QChar& c : pattern)
+                    {
+                        int next = this->nodes[node].transitions.value(c.unicode(), 0);
+
+                        if (next == 0)
+                        {
+                            next = this->nodes.count();
+
+                            Node child;
+                            child.depth = this->nodes[node].depth + 1;
+                            this->nodes << child;
+
+                            this->nodes[node].transitions.insert(c.unicode(), next);
+                        }
+
+                        node = next;
+                    }
+
+                    this->nodes[node].replacementIndex = this->replacements.count();
+                    this->replacements << it.value();
+                }
+
+                // Link each node to the node of its longest proper suffix, and to the node of the longest pattern among its suffixes, parents first.
+                QVector<int> openNodes;
+
+                for (QHash<ushort, int>::const_iterator it = this->nodes[0].transitions.cbegin();
+                     it != this->nodes[0].transitions.cend();
+                     ++it)
+                {
+                    openNodes << it.value();
+                }
+
+                for (int i = 0; i < openNodes.count(); ++i)
+                {
+                    const int node = openNodes[i];
+                    const QHash<ushort, int> transitions = this->nodes[node].transitions;
+
+                    for (QHash<ushort, int>::const_iterator it = transitions.cbegin();
+                         it != transitions.cend();
+                         ++it)
+                    {
+                        const int child = it.value();
+                        const int suffix = this->step(this->nodes[node].suffixLink, it.key());
+
+                        this->nodes[child].suffixLink = suffix;
+                        this->nodes[child].matchLink = this->nodes[suffix].replacementIndex >= 0
+                                ? suffix
+                                : this->nodes[suffix].matchLink;
+
+                        openNodes << child;
+                    }
+                }
+            }
+
+            /**
+             * @brief Checks whether this replacer would replace anything at all.
+             * @return true, if no patterns have been compiled, and false otherwise.
+             */
+            bool isEmpty() const
+            {
+                return this->replacements.isEmpty();
+            }
+
+            /**
+             * @brief Replaces all occurrences of all patterns in the specified string.
+             * @param s String to replace patterns in.
+             * @return Passed string with all patterns replaced, leftmost-longest first.
+             */
+            QString replace(const QString& s) const
+            {
+                if (this->isEmpty())
+                {
+                    return s;
+                }
+
+                QString result;
+                int copiedLength = 0;
+
+                int node = 0;
+                int matchStart = -1;
+                int matchLength = 0;
+                int matchReplacementIndex = -1;
+
+                int i = 0;
+
+                while (i < s.length())
+                {
+                    node = this->step(node, s[i].unicode());
+
+                    // Check all patterns ending here, longest first.
+                    int match = this->nodes[node].replacementIndex >= 0 ? node : this->nodes[node].matchLink;
+
+                    while (match > 0)
+                    {
+                        const int start = i - this->nodes[match].depth + 1;
+
+                        if (matchStart < 0 || start < matchStart ||
+                                (start == matchStart && this->nodes[match].depth > matchLength))
+                        {
+                            matchStart = start;
+                            matchLength = this->nodes[match].depth;
+                            matchReplacementIndex = this->nodes[match].replacementIndex;
+                        }
+
+                        match = this->nodes[match].matchLink;
+                    }
+
+                    ++i;
+
+                    // Replace best match as soon as no longer match can start at the same position.
+                    if (matchStart >= 0 && (i - this->nodes[node].depth > matchStart || i == s.length()))
+                    {
+                        result.append(s.midRef(copiedLength, matchStart - copiedLength));
+                        result.append(this->replacements[matchReplacementIndex]);
+                        copiedLength = matchStart + matchLength;
+
+                        // Continue right after the match.
+                        i = copiedLength;
+                        node = 0;
+                        matchStart = -1;
+                    }
+                }
+
+                if (copiedLength == 0)
+                {
+                    return s;
+                }
+
+                result.append(s.midRef(copiedLength));
+                return result;
+            }
+
+        private:
+            class Node
+            {
+                public:
+                    QHash<ushort, int> transitions;
+                    int depth = 0;
+                    int suffixLink = 0;
+                    int matchLink = 0;
+                    int replacementIndex = -1;
+            };
+
+            QVector<Node> nodes;
+            QStringList replacements;
+
+            int step(int node, ushort c) const
+            {
+                while (true)
+                {
+                    QHash<ushort, int>::const_iterator it = this->nodes[node].transitions.constFind(c);
+
+                    if (it != this->nodes[node].transitions.cend())
+                    {
+                        return it.value();
+                    }
+
+                    if (node == 0)
+                    {
+                        return 0;
+                    }
+
+                    node = this->nodes[node].suffixLink;
+                }
+            }
+    };
+}
+
+#endif // STRINGREPLACER_H
@@ -0,0 +1,202 @@
+#ifndef TRIGRAMINDEX_H
+#define TRIGRAMINDEX_H
+
+#include <algorithm>
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+
+namespace Tome
+{
+    /**
+     * @brief Index of the substrings of three characters of the texts of many entries, for finding all entries containing a substring, ignoring case.
+     *
+     * Candidates are found by intersecting the entries containing each substring of three characters of the pattern,
+     * and verified afterwards. Patterns shorter than three characters are verified against all entries.
+     */
+    class TrigramIndex
+    {
+        public:
+            /**
+             * @brief Removes all entries from the index.
+             */
+            void clear()
+            {
+                this->texts.clear();
+                this->trigramKeys.clear();
+            }
+
+            /**
+             * @brief Gets the number of indexed entries.
+             * @return Number of indexed entries.
+             */
+            int count() const
+            {
+                return this->texts.count();
+            }
+
+            /**
+             * @brief Finds all entries with any text containing the specified pattern, ignoring case.
+             * @param pattern Pattern to look for.
+             * @return Keys of all entries with any text containing the specified pattern, in no particular order.
+             */
+            QStringList find(const QString& pattern) const
+            {
+                const QString foldedPattern = pattern.toCaseFolded();
+                QStringList keys;
+
+                // Short patterns can't be looked up, check all entries.
+                if (foldedPattern.length() < TrigramLength)
+                {
+                    for (QHash<QString, QStringList>::const_iterator it = this->texts.cbegin();
+                         it != this->texts.cend();
+                         ++it)
+                    {
+                        if (containsPattern(it.value(), foldedPattern))
+                        {
+                            keys << it.key();
+                        }
+                    }
+
+                    return keys;
+                }
+
+                // Collect entries for each trigram, smallest first.
+                QList<const QSet<QString>*> candidateSets;
+
+                for (const quint64 trigram : getTrigrams(foldedPattern))
+                {
+                    QHash<quint64, QSet<QString>>::const_iterator it = this->trigramKeys.constFind(trigram);
+
+                    if (it == this->trigramKeys.cend())
+                    {
+                        return keys;
+                    }
+
+                    candidateSets << &it.value();
+                }
+
+                std::sort(candidateSets.begin(), candidateSets.end(), [](const QSet<QString>* lhs, const QSet<QString>* rhs)
+                {
+                    return lhs->count() < rhs->count();
+                });
+
+                // Intersect candidates and verify them.
+                for (const QString& key : *candidateSets.first())
+                {
+                    bool candidate = true;
+
+                    for (int i = 1; i < candidateSets.count() && candidate; ++i)
+                    {
+                        candidate = candidateSets[i]->contains(key);
+                    }
+
+                    if (candidate && containsPattern(this->texts.value(key), foldedPattern))
+                    {
+                        keys << key;
+                    }
+                }
+
+                return keys;
+            }
+
+            /**
+             * @brief Adds the entry with the specified key to the index, replacing any previous texts of that entry.
+             * @param key Key of the entry to add.
+             * @param texts Texts to find the entry by.
+             */
+            void insert(const QString& key, const QStringList& texts)
+            {
+                this->remove(key);
+
+                QStringList foldedTexts;
+
+                for (const QString& text : texts)
+                {
+                    const QString foldedText = text.toCaseFolded();
+                    foldedTexts << foldedText;
+
+                    for (const quint64 trigram : getTrigrams(foldedText))
+                    {
+                        this->trigramKeys[trigram].insert(key);
+                    }
+                }
+
+                this->texts.insert(key, foldedTexts);
+            }
+
+            /**
+             * @brief Removes the entry with the specified key from the index, if it exists.
+             * @param key Key of the entry to remove.
+             */
+            void remove(const QString& key)
+            {
+                QHash<QString, QStringList>::iterator it = this->texts.find(key);
+
+                if (it == this->texts.end())
+                {
+                    return;
+                }
+
+                for (const QString& foldedText : it.value())
+                {
+                    for (const quint64 trigram : getTrigrams(foldedText))
+                    {
+                        QHash<quint64, QSet<QString>>::iterator itKeys = this->trigramKeys.find(trigram);
+
+                        if (itKeys != this->trigramKeys.end())
+                        {
+                            itKeys.value().remove(key);
+
+                            if (itKeys.value().isEmpty())
+                            {
+                                this->trigramKeys.erase(itKeys);
+                            }
+                        }
+                    }
+                }
+
+                this->texts.erase(it);
+            }
+
+        private:
+            static const int TrigramLength = 3;
+
+            // Case-folded texts by entry key, and entry keys by trigram.
+            QHash<QString, QStringList> texts;
+            QHash<quint64, QSet<QString>> trigramKeys;
+
+            static bool containsPattern(const QStringList& foldedTexts, const QString& foldedPattern)
+            {
+                for (const QString& foldedText : foldedTexts)
+                {
+                    if (foldedText.contains(foldedPattern))
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            static QSet<quint64> getTrigrams(const QString& s)
+            {
+                QSet<quint64> trigrams;
+
+                for (int i = 0; i + TrigramLength <= s.length(); ++i)
+                {
+                    trigrams.insert((quint64(s[i].unicode()) << 32) |
+                                    (quint64(s[i + 1].unicode()) << 16) |
+                                    quint64(s[i + 2].unicode()));
+                }
+
+                return trigrams;
+            }
+    };
+}
+
+#endif // TRIGRAMINDEX_H
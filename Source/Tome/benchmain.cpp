@@ -0,0 +1,208 @@
+#include <QBuffer>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QSysInfo>
+#include <QTextStream>
+
+#include "Benchmarks/benchmarkrunner.h"
+#include "Benchmarks/syntheticprojectgenerator.h"
+#include "Benchmarks/syntheticprojectoptions.h"
+#include "Core/commandlineoptions.h"
+#include "Core/controller.h"
+#include "Features/Diagnostics/Controller/tracer.h"
+#include "Features/Export/Controller/exportcontroller.h"
+#include "Features/Import/Controller/importcontroller.h"
+#include "Features/Projects/Controller/projectcontroller.h"
+#include "Features/Search/Controller/findrecordcontroller.h"
+#include "Features/Search/Controller/findusagescontroller.h"
+#include "Features/Tasks/Controller/taskscontroller.h"
+
+using namespace Tome;
+
+
+int main(int argc, char** argv)
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationVersion(APP_VERSION);
+    app.setOrganizationName("Tome");
+    app.setOrganizationDomain("tome-editor.org");
+    app.setApplicationName("TomeBench");
+
+    // Parse command line options.
+    SyntheticProjectOptions projectOptions;
+    QString projectPath = QDir::temp().absoluteFilePath("TomeBench");
+    QString outputPath;
+    QString traceOutputPath;
+    int iterations = 5;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const QString value = QString(argv[i + 1]);
+
+        if (!qstrcmp(argv[i], "-records"))
+        {
+            projectOptions.recordCount = value.toInt();
+        }
+        else if (!qstrcmp(argv[i], "-depth"))
+        {
+            projectOptions.hierarchyDepth = value.toInt();
+        }
+        else if (!qstrcmp(argv[i], "-fields"))
+        {
+            projectOptions.fieldsPerRecord = value.toInt();
+        }
+        else if (!qstrcmp(argv[i], "-lists"))
+        {
+            projectOptions.listFieldDensity = value.toDouble();
+        }
+        else if (!qstrcmp(argv[i], "-maps"))
+        {
+            projectOptions.mapFieldDensity = value.toDouble();
+        }
+        else if (!qstrcmp(argv[i], "-references"))
+        {
+            projectOptions.referenceFieldDensity = value.toDouble();
+        }
+        else if (!qstrcmp(argv[i], "-overrides"))
+        {
+            projectOptions.overriddenFieldDensity = value.toDouble();
+        }
+        else if (!qstrcmp(argv[i], "-types"))
+        {
+            projectOptions.customTypeCount = value.toInt();
+        }
+        else if (!qstrcmp(argv[i], "-import-rows"))
+        {
+            projectOptions.importRowCount = value.toInt();
+        }
+        else if (!qstrcmp(argv[i], "-seed"))
+        {
+            projectOptions.seed = value.toUInt();
+        }
+        else if (!qstrcmp(argv[i], "-iterations"))
+        {
+            iterations = value.toInt();
+        }
+        else if (!qstrcmp(argv[i], "-project-path"))
+        {
+            projectPath = value;
+        }
+        else if (!qstrcmp(argv[i], "-output"))
+        {
+            outputPath = value;
+        }
+        else if (!qstrcmp(argv[i], "-trace"))
+        {
+            traceOutputPath = value;
+        }
+        else
+        {
+            qWarning(qUtf8Printable(QString("Unknown option: %1").arg(argv[i])));
+        }
+    }
+
+    // Setup controllers without main window.
+    CommandLineOptions* options = new CommandLineOptions();
+    options->noGui = true;
+
+    QScopedPointer<Controller> controller(new Controller(options));
+    ProjectController& projectController = controller->getProjectController();
+
+    // Generate project.
+    SyntheticProjectGenerator generator(*controller);
+
+    try
+    {
+        generator.generateProject(projectPath, projectOptions);
+    }
+    catch (const std::exception& e)
+    {
+        qCritical(e.what());
+        return 1;
+    }
+
+    const QString projectFileName = projectController.getFullProjectPath();
+    const QString recordId = generator.getRecordIds().isEmpty() ? QString() : generator.getRecordIds().last();
+    const QString fieldId = generator.getFieldIds().isEmpty() ? QString() : generator.getFieldIds().first();
+    const QString typeName = generator.getTypeNames().isEmpty() ? QString() : generator.getTypeNames().first();
+
+    // Run benchmarks, optionally recording where they spend their time.
+    if (!traceOutputPath.isEmpty())
+    {
+        Tracer::start(traceOutputPath);
+    }
+
+    BenchmarkRunner runner(iterations);
+
+    runner.run("openProject", [&]() { projectController.openProject(projectFileName); });
+    runner.run("saveProject", [&]() { projectController.saveProject(); });
+
+    runner.run("exportRecords", [&]()
+    {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        controller->getExportController().exportRecords(generator.getExportTemplate(), buffer);
+    });
+
+    runner.run("runAllTasks", [&]() { controller->getTasksController().runAllTasks(); });
+    runner.run("runAllTasksInParallel", [&]() { controller->getTasksController().runAllTasksInParallel(); });
+
+    runner.run("findRecord", [&]() { controller->getFindRecordController().findRecord("Record 1"); });
+    runner.run("findUsagesOfRecord", [&]() { controller->getFindUsagesController().findUsagesOfRecord(recordId); });
+    runner.run("findUsagesOfField", [&]() { controller->getFindUsagesController().findUsagesOfField(fieldId); });
+    runner.run("findUsagesOfType", [&]() { controller->getFindUsagesController().findUsagesOfType(typeName); });
+
+    // Start every import from the generated project.
+    runner.run("importRecords",
+               [&]()
+    {
+        ImportController& importController = controller->getImportController();
+        importController.importRecords(importController.getRecordTableImportTemplate(generator.getImportTemplate().name),
+                                       generator.getImportFilePath());
+    },
+               [&]() { projectController.openProject(projectFileName); });
+
+    Tracer::stop();
+
+    // Write results.
+    QJsonObject tome;
+    tome["version"] = QString(APP_VERSION);
+    tome["versionName"] = QString(APP_VERSION_NAME);
+
+    QJsonObject machine;
+    machine["cpuArchitecture"] = QSysInfo::currentCpuArchitecture();
+    machine["os"] = QSysInfo::prettyProductName();
+    machine["hostName"] = QSysInfo::machineHostName();
+
+    QJsonObject report;
+    report["tome"] = tome;
+    report["machine"] = machine;
+    report["date"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    report["project"] = projectOptions.toJson();
+    report["iterations"] = iterations;
+    report["benchmarks"] = runner.getResults();
+
+    const QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+
+    if (outputPath.isEmpty())
+    {
+        QTextStream(stdout) << json;
+    }
+    else
+    {
+        QFile file(outputPath);
+
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            qCritical(qUtf8Printable(QString("Destination file could not be written: %1").arg(outputPath)));
+            return 1;
+        }
+
+        file.write(json);
+    }
+
+    return runner.hasFailed() ? 1 : 0;
+}
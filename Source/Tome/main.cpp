@@ -62,7 +62,8 @@ int main(int argc, char *argv[])
     QScopedPointer<Tome::Controller> controller(new Tome::Controller(options));
     int exitCode = controller->start();
 
-    if (exitCode != 0 || options->noGui)
+    // Keep running for serving requests, or for showing the main window.
+    if (exitCode != 0 || (options->noGui && !options->serve))
     {
         return exitCode;
     }
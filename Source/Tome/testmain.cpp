@@ -1,16 +1,40 @@
 #include <QtTest/QtTest>
 
+#include "Tests/testfilewatchercontroller.h"
+#include "Tests/testfulltextindex.h"
+#include "Tests/testhashutils.h"
 #include "Tests/testlistutils.h"
+#include "Tests/testmemoryutils.h"
+#include "Tests/testprogressreporter.h"
+#include "Tests/teststringreplacer.h"
 #include "Tests/teststringutils.h"
+#include "Tests/testtrigramindex.h"
+#include "Tests/testupdaterecordfieldvaluescommand.h"
 
 
 int main(int argc, char** argv)
 {
     QApplication app(argc, argv);
 
+    TestFileWatcherController testFileWatcherController;
+    TestFullTextIndex testFullTextIndex;
+    TestHashUtils testHashUtils;
     TestListUtils testListUtils;
+    TestMemoryUtils testMemoryUtils;
+    TestProgressReporter testProgressReporter;
+    TestStringReplacer testStringReplacer;
     TestStringUtils testStringUtils;
+    TestTrigramIndex testTrigramIndex;
+    TestUpdateRecordFieldValuesCommand testUpdateRecordFieldValuesCommand;
 
-    return QTest::qExec(&testListUtils, argc, argv) &
-           QTest::qExec(&testStringUtils, argc, argv);
+    return QTest::qExec(&testFileWatcherController, argc, argv) |
+           QTest::qExec(&testFullTextIndex, argc, argv) |
+           QTest::qExec(&testHashUtils, argc, argv) |
+           QTest::qExec(&testListUtils, argc, argv) |
+           QTest::qExec(&testMemoryUtils, argc, argv) |
+           QTest::qExec(&testProgressReporter, argc, argv) |
+           QTest::qExec(&testStringReplacer, argc, argv) |
+           QTest::qExec(&testStringUtils, argc, argv) |
+           QTest::qExec(&testTrigramIndex, argc, argv) |
+           QTest::qExec(&testUpdateRecordFieldValuesCommand, argc, argv);
 }